@@ -185,6 +185,12 @@ static int test_mp_hash(void)
       0xabae35c7872c107d,
       0xfec74888bcef5fcd,
       0x27ba96030abceda5
+#elif (MP_DIGIT_BIT == 64)
+      0xaf63bd4c8601b7df,
+      0xfdd7f9efa54c1610,
+      0x94670f18a2cdc1e4,
+      0xd766171e1f699c2d,
+      0xf3e955fd0c2d5846
 #elif (MP_DIGIT_BIT == 31)
       0xaf63bd4c8601b7df,
       0xec1be1c4749a7b86,
@@ -1416,6 +1422,94 @@ LBL_ERR:
    return EXIT_SUCCESS;
 #   endif /* LTM_DEMO_TEST_REDUCE_2K_L */
 }
+
+static int test_s_mp_solinas_mulmod(void)
+{
+   mp_int a, b, c, d, p;
+   int form, i, j;
+   const char *moduli[] = {
+      /* NIST P-192, P-224, Curve25519, NIST P-256, secp256k1, NIST P-384, Goldilocks, NIST P-521 */
+      "FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFEFFFFFFFFFFFFFFFF",
+      "FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF000000000000000000000001",
+      "7FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFED",
+      "FFFFFFFF00000001000000000000000000000000FFFFFFFFFFFFFFFFFFFFFFFF",
+      "FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFEFFFFFC2F",
+      "FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFE"
+      "FFFFFFFF0000000000000000FFFFFFFF",
+      "FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFE"
+      "FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF",
+      "1FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF"
+      "FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF"
+   };
+
+   DOR(mp_init_multi(&a, &b, &c, &d, &p, NULL));
+
+   for (i = 0; i < (int)(sizeof(moduli)/sizeof(moduli[0])); i++) {
+      DO(mp_read_radix(&p, moduli[i], 16));
+      EXPECT(s_mp_solinas_find(&p, &form));
+      EXPECT(form == i);
+
+      /* close misses */
+      DO(mp_add_d(&p, 2u, &a));
+      EXPECT(!s_mp_solinas_find(&a, &form));
+      DO(mp_2expt(&b, 32));
+      DO(mp_sub(&p, &b, &a));
+      EXPECT(!s_mp_solinas_find(&a, &form));
+      DO(mp_neg(&p, &a));
+      EXPECT(!s_mp_solinas_find(&a, &form));
+
+      for (j = 0; j < 100; j++) {
+         /* residues, the largest one, zero, negative and too long numbers */
+         DO(mp_rand(&a, p.used));
+         DO(mp_mod(&a, &p, &a));
+         DO(mp_rand(&b, p.used));
+         DO(mp_mod(&b, &p, &b));
+         if (j == 0) {
+            DO(mp_sub_d(&p, 1u, &a));
+            DO(mp_copy(&a, &b));
+         } else if (j == 1) {
+            mp_zero(&a);
+         } else if ((j % 3) == 2) {
+            DO(mp_neg(&a, &a));
+         } else if ((j % 10) == 3) {
+            DO(mp_rand(&b, 3 * p.used));
+         }
+         DO(mp_mul(&a, &b, &d));
+         DO(mp_mod(&d, &p, &d));
+         DO(s_mp_solinas_mulmod(&a, &b, &p, &c, form));
+         EXPECT(mp_cmp(&c, &d) == MP_EQ);
+         DO(mp_mulmod(&a, &b, &p, &c));
+         EXPECT(mp_cmp(&c, &d) == MP_EQ);
+
+         DO(mp_sqr(&a, &d));
+         DO(mp_mod(&d, &p, &d));
+         DO(mp_copy(&a, &c));
+         DO(s_mp_solinas_mulmod(&c, &c, &p, &c, form));
+         EXPECT(mp_cmp(&c, &d) == MP_EQ);
+         DO(mp_sqrmod(&a, &p, &c));
+         EXPECT(mp_cmp(&c, &d) == MP_EQ);
+
+         if (j < 5) {
+            DO(mp_rand(&b, 1 + (j * 2)));
+            if (j == 1) {
+               mp_zero(&b);
+            }
+            DO(s_mp_exptmod(&a, &b, &p, &d, 0));
+            DO(s_mp_exptmod_solinas(&a, &b, &p, &c, form));
+            EXPECT(mp_cmp(&c, &d) == MP_EQ);
+            DO(mp_exptmod(&a, &b, &p, &c));
+            EXPECT(mp_cmp(&c, &d) == MP_EQ);
+         }
+      }
+   }
+
+   mp_clear_multi(&a, &b, &c, &d, &p, NULL);
+   return EXIT_SUCCESS;
+LBL_ERR:
+   mp_clear_multi(&a, &b, &c, &d, &p, NULL);
+   return EXIT_FAILURE;
+}
+
 /* stripped down version of mp_radix_size. The faster version can be off by up to +3  */
 static mp_err s_rs(const mp_int *a, int radix, int *size)
 {
@@ -1962,9 +2056,7 @@ static int test_s_mp_sqr(void)
 
    DOR(mp_init_multi(&a, &b, &c, NULL));
 
-   /* s_mp_mul() has a hardcoded branch to s_mul_comba if s_mul_comba is available,
-      so test another 10 just in case. */
-   for (i = 1; i < MP_MAX_COMBA + 10; i++) {
+   for (i = 1; i < 300; i++) {
       DO(s_fill_with_ones(&a, i));
       DO(s_mp_sqr(&a, &b));
       DO(s_mp_mul(&a, &a, &c, 2*i + 1));
@@ -1989,7 +2081,7 @@ static int test_s_mp_sqr_comba(void)
 
    DOR(mp_init_multi(&a, &r1, &r2, NULL));
 
-   for (i = 1; i <= MP_MAX_COMBA; i++) {
+   for (i = 1; i <= 300; i++) {
       DO(s_fill_with_ones(&a, i));
       DO(s_mp_sqr_comba(&a, &r1));
       DO(s_mp_sqr(&a, &r2));
@@ -2009,9 +2101,325 @@ LBL_ERR:
    return EXIT_FAILURE;
 }
 
+static int test_s_mp_mul_comba(void)
+{
+   mp_int a, b, r1, r2;
+   mp_digit mp;
+   int i, j;
+   /* around the blocks of the accumulator and the stack array, above the former 512 digit limit */
+   const int size[] = { 1, 2, 3, 4, 5, 17, 63, 64, 65, 127, 128, 129, 255, 256, 257, 600, 1100 };
+
+   DOR(mp_init_multi(&a, &b, &r1, &r2, NULL));
+
+   for (i = 0; i < (int)(sizeof(size)/sizeof(size[0])); i++) {
+      for (j = 0; j < 4; j++) {
+         if (j == 0) {
+            DO(s_fill_with_ones(&a, size[i]));
+            DO(s_fill_with_ones(&b, size[i]));
+         } else {
+            DO(mp_rand(&a, size[i]));
+            DO(mp_rand(&b, 1 + (int)(rand_uint() % (unsigned)(2 * size[i]))));
+         }
+
+         /* also truncated products */
+         DO(s_mp_mul_comba(&a, &b, &r1, a.used + (b.used / 2)));
+         DO(s_mp_mul(&a, &b, &r2, a.used + (b.used / 2)));
+         EXPECT(mp_cmp_mag(&r1, &r2) == MP_EQ);
+         DO(s_mp_mul_comba(&a, &b, &r1, a.used + b.used + 1));
+         DO(s_mp_mul(&a, &b, &r2, a.used + b.used + 1));
+         EXPECT(mp_cmp_mag(&r1, &r2) == MP_EQ);
+
+         /* the destination is also a source */
+         DO(mp_copy(&a, &r1));
+         DO(s_mp_mul_comba(&r1, &b, &r1, a.used + b.used + 1));
+         EXPECT(mp_cmp_mag(&r1, &r2) == MP_EQ);
+         DO(s_mp_mul_high_comba(&a, &b, &r2, a.used));
+         DO(mp_copy(&a, &r1));
+         DO(s_mp_mul_high_comba(&r1, &b, &r1, a.used));
+         EXPECT(mp_cmp_mag(&r1, &r2) == MP_EQ);
+         DO(mp_copy(&a, &r1));
+         DO(s_mp_sqr_comba(&r1, &r1));
+         DO(s_mp_sqr(&a, &r2));
+         EXPECT(mp_cmp_mag(&r1, &r2) == MP_EQ);
+
+         /* x < b**(2n-1) <= a*R for Montgomery reduction, x/R*R == x mod a */
+         a.dp[0] |= 1u;
+         a.sign = MP_ZPOS;
+         DO(mp_montgomery_setup(&a, &mp));
+         DO(mp_montgomery_calc_normalization(&b, &a));
+         if (j == 0) {
+            DO(mp_sub_d(&a, 1u, &r1));
+            DO(mp_sqr(&r1, &r1));
+         } else {
+            DO(mp_rand(&r1, 1 + (int)(rand_uint() % (unsigned)((2 * size[i]) - 1))));
+         }
+         r1.sign = MP_ZPOS;
+         DO(mp_mod(&r1, &a, &r2));
+         DO(s_mp_montgomery_reduce_comba(&r1, &a, mp));
+         EXPECT(mp_cmp(&r1, &a) == MP_LT);
+         DO(mp_mulmod(&r1, &b, &a, &r1));
+         EXPECT(mp_cmp(&r1, &r2) == MP_EQ);
+      }
+   }
+
+   mp_clear_multi(&a, &b, &r1, &r2, NULL);
+   return EXIT_SUCCESS;
+LBL_ERR:
+   mp_clear_multi(&a, &b, &r1, &r2, NULL);
+   return EXIT_FAILURE;
+}
+
+static int test_s_mp_mul_adx(void)
+{
+   mp_int a, b, r1, r2;
+   mp_digit mp;
+   int i, j;
+
+   DOR(mp_init_multi(&a, &b, &r1, &r2, NULL));
+
+   /* the portable loop is tested without MP_ADX_ASM, the assembler needs the CPU */
+#ifdef MP_ADX_ASM
+   if (!s_mp_cpu_adx()) {
+      printf("CPU without BMI2/ADX, skipped");
+      mp_clear_multi(&a, &b, &r1, &r2, NULL);
+      return EXIT_SUCCESS;
+   }
+#endif
+
+   for (i = 1; i <= 70; i++) {
+      DO(s_fill_with_ones(&a, i));
+      DO(s_mp_sqr_adx(&a, &r1));
+      DO(s_mp_sqr(&a, &r2));
+      EXPECT(mp_cmp(&r1, &r2) == MP_EQ);
+      for (j = 0; j < 20; j++) {
+         DO(mp_rand(&a, i));
+         DO(mp_rand(&b, 1 + (int)(rand_uint() % 70u)));
+
+         /* also truncated products */
+         DO(s_mp_mul_adx(&a, &b, &r1, a.used + (b.used / 2)));
+         DO(s_mp_mul(&a, &b, &r2, a.used + (b.used / 2)));
+         EXPECT(mp_cmp_mag(&r1, &r2) == MP_EQ);
+         DO(s_mp_mul_adx(&a, &b, &r1, a.used + b.used + 1));
+         DO(s_mp_mul(&a, &b, &r2, a.used + b.used + 1));
+         EXPECT(mp_cmp_mag(&r1, &r2) == MP_EQ);
+         DO(s_mp_sqr_adx(&a, &r1));
+         DO(s_mp_sqr(&a, &r2));
+         EXPECT(mp_cmp(&r1, &r2) == MP_EQ);
+
+         /* x < b**(2n-1) <= a*R for Montgomery reduction, x/R*R == x mod a */
+         a.dp[0] |= 1u;
+         a.sign = MP_ZPOS;
+         DO(mp_montgomery_setup(&a, &mp));
+         DO(mp_montgomery_calc_normalization(&b, &a));
+         DO(mp_rand(&r1, 1 + (int)(rand_uint() % (unsigned)((2 * i) - 1))));
+         r1.sign = MP_ZPOS;
+         DO(mp_mod(&r1, &a, &r2));
+         DO(s_mp_montgomery_reduce_adx(&r1, &a, mp));
+         EXPECT(mp_cmp(&r1, &a) == MP_LT);
+         DO(mp_mulmod(&r1, &b, &a, &r1));
+         EXPECT(mp_cmp(&r1, &r2) == MP_EQ);
+      }
+   }
+
+   mp_clear_multi(&a, &b, &r1, &r2, NULL);
+   return EXIT_SUCCESS;
+LBL_ERR:
+   mp_clear_multi(&a, &b, &r1, &r2, NULL);
+   return EXIT_FAILURE;
+}
+
+static int test_s_mp_exptmod_ifma(void)
+{
+   mp_int a, b, c, d, e, rr;
+   int i, j;
+
+   DOR(mp_init_multi(&a, &b, &c, &d, &e, &rr, NULL));
+
+   if (!s_mp_cpu_ifma()) {
+      printf("CPU without AVX-512 IFMA, skipped");
+      goto LBL_OK;
+   }
+
+   for (i = 0; i < 20; i++) {
+      /* odd moduli of all sizes up to MP_IFMA_MAX_BITS bits */
+      DO(mp_rand(&c, 1 + (int)(rand_uint() % ((MP_IFMA_MAX_BITS / MP_DIGIT_BIT) - 1u))));
+      c.dp[0] |= 1u;
+      c.sign = MP_ZPOS;
+      DO(s_mp_ifma_rr(&c, &rr));
+      for (j = 0; j < 4; j++) {
+         DO(mp_rand(&a, 1 + (int)(rand_uint() % (2u * (unsigned)c.used))));
+         /* exponents up to 1024 bits, so all window sizes are used */
+         DO(mp_rand(&b, 1 + (int)(rand_uint() % (1024u / MP_DIGIT_BIT))));
+         b.sign = MP_ZPOS;
+         if (j == 0) {
+            mp_zero(&b);
+         }
+         DO(s_mp_exptmod_ifma(&a, &b, &c, NULL, &d));
+         DO(s_mp_exptmod(&a, &b, &c, &e, 0));
+         EXPECT(mp_cmp(&d, &e) == MP_EQ);
+         /* with R**2 mod P of a context */
+         DO(s_mp_exptmod_ifma(&a, &b, &c, &rr, &d));
+         EXPECT(mp_cmp(&d, &e) == MP_EQ);
+      }
+   }
+
+LBL_OK:
+   mp_clear_multi(&a, &b, &c, &d, &e, &rr, NULL);
+   return EXIT_SUCCESS;
+LBL_ERR:
+   mp_clear_multi(&a, &b, &c, &d, &e, &rr, NULL);
+   return EXIT_FAILURE;
+}
+
+static int test_s_mp_exptmod_lazy(void)
+{
+   mp_int a, b, c, d, e;
+   int i, j;
+
+   DOR(mp_init_multi(&a, &b, &c, &d, &e, NULL));
+
+   for (i = 0; i < 40; i++) {
+      /* odd moduli, with and without room for 4c in the top digit */
+      DO(mp_rand(&c, 1 + (int)(rand_uint() % 24u)));
+      c.dp[0] |= 1u;
+      if ((i & 1) == 0) {
+         c.dp[c.used - 1] |= (mp_digit)1 << (MP_DIGIT_BIT - 1);
+      } else {
+         c.dp[c.used - 1] >>= 2;
+         c.dp[c.used - 1] |= 1u;
+      }
+      if (i == 0) {
+         mp_set(&c, 3u);
+      }
+      for (j = 0; j < 5; j++) {
+         DO(mp_rand(&a, 1 + (int)(rand_uint() % (2u * (unsigned)c.used))));
+         DO(mp_rand(&b, 1 + (int)(rand_uint() % (1024u / MP_DIGIT_BIT))));
+         b.sign = MP_ZPOS;
+         if (j == 0) {
+            mp_zero(&b);
+         } else if (j == 1) {
+            DO(mp_sub_d(&c, 1u, &a));
+         } else if (j == 2) {
+            mp_zero(&a);
+         }
+         DO(s_mp_exptmod(&a, &b, &c, &e, 0));
+         DO(s_mp_exptmod_lazy(&a, &b, &c, &d));
+         EXPECT(mp_cmp(&d, &e) == MP_EQ);
+         DO(s_mp_exptmod_lazy(&a, &b, &c, &a));
+         EXPECT(mp_cmp(&a, &e) == MP_EQ);
+      }
+   }
+
+   mp_clear_multi(&a, &b, &c, &d, &e, NULL);
+   return EXIT_SUCCESS;
+LBL_ERR:
+   mp_clear_multi(&a, &b, &c, &d, &e, NULL);
+   return EXIT_FAILURE;
+}
+
+static int test_s_mp_exptmod_fast(void)
+{
+   mp_int a, b, c, d, e, x;
+   mp_digit mp;
+   int i, j, n, cutoffs[2];
+
+   DOR(mp_init_multi(&a, &b, &c, &d, &e, &x, NULL));
+
+   /* the Montgomery loop is for moduli above the squaring cutoff, with Karatsuba */
+   cutoffs[0] = MP_MUL_KARATSUBA_CUTOFF;
+   cutoffs[1] = MP_SQR_KARATSUBA_CUTOFF;
+   MP_MUL_KARATSUBA_CUTOFF = MP_SQR_KARATSUBA_CUTOFF = 8;
+
+   for (i = 0; i < 50; i++) {
+      n = 8 + (i % 10);
+      DO(mp_rand(&c, n));
+      switch (i % 5) {
+      case 0:
+         /* odd for Montgomery, even for Barrett */
+         c.dp[0] |= 1u;
+         break;
+      case 1:
+         c.dp[0] &= ~(mp_digit)1;
+         break;
+      case 2:
+         /* B**n - d */
+         for (j = 1; j < n; j++) {
+            c.dp[j] = MP_MASK;
+         }
+         c.dp[0] |= 1u;
+         break;
+      case 3:
+         /* 2**k - d, a single digit d */
+         DO(mp_2expt(&c, (n * MP_DIGIT_BIT) - 3));
+         DO(mp_sub_d(&c, (rand_uint() & MP_MASK) | 1u, &c));
+         break;
+      default:
+         /* 2**k - d, d of half the size */
+         DO(mp_rand(&d, n / 2));
+         DO(mp_2expt(&c, (n * MP_DIGIT_BIT) - 3));
+         DO(mp_sub(&c, &d, &c));
+         break;
+      }
+
+      for (j = 0; j < 3; j++) {
+         DO(mp_rand(&a, 1 + (int)(rand_uint() % (2u * (unsigned)n))));
+         DO(mp_rand(&b, 1 + j));
+         b.sign = MP_ZPOS;
+         if (j == 2) {
+            DO(mp_neg(&a, &a));
+         }
+
+         /* right to left with mp_mulmod() */
+         DO(mp_mod(&a, &c, &x));
+         DO(mp_copy(&b, &d));
+         mp_set(&e, 1u);
+         while (!mp_iszero(&d)) {
+            if (mp_isodd(&d)) {
+               DO(mp_mulmod(&e, &x, &c, &e));
+            }
+            DO(mp_sqrmod(&x, &c, &x));
+            DO(mp_div_2(&d, &d));
+         }
+
+         switch (i % 5) {
+         case 0:
+            DO(s_mp_exptmod_fast(&a, &b, &c, &d, 0));
+            break;
+         case 1:
+            DO(s_mp_exptmod(&a, &b, &c, &d, 0));
+            break;
+         case 2:
+            EXPECT(mp_dr_is_modulus(&c));
+            DO(s_mp_exptmod_fast(&a, &b, &c, &d, 1));
+            break;
+         case 3:
+            EXPECT(mp_reduce_is_2k(&c));
+            DO(mp_reduce_2k_setup(&c, &mp));
+            DO(s_mp_exptmod_fast(&a, &b, &c, &d, 2));
+            break;
+         default:
+            DO(s_mp_exptmod(&a, &b, &c, &d, 1));
+            break;
+         }
+         EXPECT(mp_cmp(&d, &e) == MP_EQ);
+      }
+   }
+
+   MP_MUL_KARATSUBA_CUTOFF = cutoffs[0];
+   MP_SQR_KARATSUBA_CUTOFF = cutoffs[1];
+   mp_clear_multi(&a, &b, &c, &d, &e, &x, NULL);
+   return EXIT_SUCCESS;
+LBL_ERR:
+   MP_MUL_KARATSUBA_CUTOFF = cutoffs[0];
+   MP_SQR_KARATSUBA_CUTOFF = cutoffs[1];
+   mp_clear_multi(&a, &b, &c, &d, &e, &x, NULL);
+   return EXIT_FAILURE;
+}
+
 static int test_s_mp_mul_balance(void)
 {
-   mp_int a, b, c;
+   mp_int a, b, c, d;
+   int i;
 
    const char *na =
       "4b0I5uMTujCysw+1OOuOyH2FX2WymrHUqi8BBDb7XpkV/4i7vXTbEYUy/kdIfCKu5jT5JEqYkdmnn3jAYo8XShPzNLxZx9yoLjxYRyptSuOI2B1DspvbIVYXY12sxPZ4/HCJ4Usm2MU5lO/006KnDMxuxiv1rm6YZJZ0eZU";
@@ -2019,7 +2427,7 @@ static int test_s_mp_mul_balance(void)
    const char *nc =
       "HzrSq9WVt1jDTVlwUxSKqxctu2GVD+N8+SVGaPFRqdxyld6IxDBbj27BPJzYUdR96k3sWpkO8XnDBvupGPnehpQe4KlO/KmN1PjFov/UTZYM+LYzkFcBPyV6hkkL8ePC1rlFLAHzgJMBCXVp4mRqtkQrDsZXXlcqlbTFu69wF6zDEysiX2cAtn/kP9ldblJiwYPCD8hG";
 
-   DOR(mp_init_multi(&a, &b, &c, NULL));
+   DOR(mp_init_multi(&a, &b, &c, &d, NULL));
 
    DO(mp_read_radix(&a, na, 64));
    DO(mp_read_radix(&b, nb, 64));
@@ -2030,10 +2438,19 @@ static int test_s_mp_mul_balance(void)
 
    EXPECT(mp_cmp(&b, &c) == MP_EQ);
 
-   mp_clear_multi(&a, &b, &c, NULL);
+   /* ratios from 5:2 up, the last slice is of any size */
+   for (i = 0; i < 20; i++) {
+      DO(mp_rand(&b, MP_MUL_KARATSUBA_CUTOFF + (rand_int() % 50)));
+      DO(mp_rand(&a, (((5 + i) * b.used) / 2) + (rand_int() % b.used)));
+      DO(s_mp_mul_balance(&a, &b, &c));
+      DO(s_mp_mul(&a, &b, &d, a.used + b.used + 1));
+      EXPECT(mp_cmp_mag(&c, &d) == MP_EQ);
+   }
+
+   mp_clear_multi(&a, &b, &c, &d, NULL);
    return EXIT_SUCCESS;
 LBL_ERR:
-   mp_clear_multi(&a, &b, &c, NULL);
+   mp_clear_multi(&a, &b, &c, &d, NULL);
    return EXIT_FAILURE;
 }
 
@@ -2047,7 +2464,7 @@ static int test_s_mp_mul_karatsuba(void)
    for (size = MP_MUL_KARATSUBA_CUTOFF; size < (MP_MUL_KARATSUBA_CUTOFF + 20); size++) {
       DO(mp_rand(&a, size));
       DO(mp_rand(&b, size));
-      DO(s_mp_mul_karatsuba(&a, &b, &c));
+      DO(s_mp_mul_karatsuba(&a, &b, &c, NULL));
       DO(s_mp_mul_full(&a,&b,&d));
       EXPECT(mp_cmp(&c, &d) == MP_EQ);
    }
@@ -2067,7 +2484,7 @@ static int test_s_mp_sqr_karatsuba(void)
    DOR(mp_init_multi(&a, &b, &c, NULL));
    for (size = MP_SQR_KARATSUBA_CUTOFF; size < (MP_SQR_KARATSUBA_CUTOFF + 20); size++) {
       DO(mp_rand(&a, size));
-      DO(s_mp_sqr_karatsuba(&a, &b));
+      DO(s_mp_sqr_karatsuba(&a, &b, NULL));
       DO(s_mp_sqr(&a, &c));
       EXPECT(mp_cmp(&b, &c) == MP_EQ);
    }
@@ -2111,7 +2528,7 @@ static int test_s_mp_mul_toom(void)
    for (size = MP_MUL_TOOM_CUTOFF; size < (MP_MUL_TOOM_CUTOFF + 20); size++) {
       DO(mp_rand(&a, size));
       DO(mp_rand(&b, size));
-      DO(s_mp_mul_toom(&a, &b, &c));
+      DO(s_mp_mul_toom(&a, &b, &c, NULL));
       DO(s_mp_mul_full(&a,&b,&d));
       EXPECT(mp_cmp(&c, &d) == MP_EQ);
    }
@@ -2131,7 +2548,7 @@ static int test_s_mp_sqr_toom(void)
    DOR(mp_init_multi(&a, &b, &c, NULL));
    for (size = MP_SQR_TOOM_CUTOFF; size < (MP_SQR_TOOM_CUTOFF + 20); size++) {
       DO(mp_rand(&a, size));
-      DO(s_mp_sqr_toom(&a, &b));
+      DO(s_mp_sqr_toom(&a, &b, NULL));
       DO(s_mp_sqr(&a, &c));
       EXPECT(mp_cmp(&b, &c) == MP_EQ);
    }
@@ -2143,39 +2560,143 @@ LBL_ERR:
    return EXIT_FAILURE;
 }
 
+/* Karatsuba and Toom-Cook 3-way several levels deep in one scratch space */
+static int test_s_mp_mul_scratch(void)
+{
+   mp_int a, b, c, d;
+   int size, cutoff, cutoffs[4];
 
-static int test_mp_radix_size(void)
+   cutoffs[0] = MP_MUL_KARATSUBA_CUTOFF;
+   cutoffs[1] = MP_SQR_KARATSUBA_CUTOFF;
+   cutoffs[2] = MP_MUL_TOOM_CUTOFF;
+   cutoffs[3] = MP_SQR_TOOM_CUTOFF;
+   DOR(mp_init_multi(&a, &b, &c, &d, NULL));
+   MP_MUL_KARATSUBA_CUTOFF = MP_SQR_KARATSUBA_CUTOFF = 8;
+   MP_MUL_TOOM_CUTOFF = MP_SQR_TOOM_CUTOFF = 40;
+   for (size = 8; size < 600; size += 1 + (size / 4)) {
+      DO(mp_rand(&a, size));
+      DO(mp_rand(&b, size + (int)(rand_uint() % (unsigned)((size / 2) + 1))));
+      DO(s_mp_mul_karatsuba(&a, &b, &c, NULL));
+      DO(s_mp_mul_full(&a, &b, &d));
+      EXPECT(mp_cmp(&c, &d) == MP_EQ);
+      DO(s_mp_mul_toom(&b, &a, &c, NULL));
+      EXPECT(mp_cmp(&c, &d) == MP_EQ);
+      DO(s_fill_with_ones(&a, size));
+      DO(s_mp_sqr_karatsuba(&a, &c, NULL));
+      DO(s_mp_sqr(&a, &d));
+      EXPECT(mp_cmp(&c, &d) == MP_EQ);
+      DO(s_mp_sqr_toom(&a, &c, NULL));
+      EXPECT(mp_cmp(&c, &d) == MP_EQ);
+   }
+
+   /* the smallest cutoffs recurse the deepest */
+   for (cutoff = 2; cutoff <= 4; cutoff++) {
+      MP_MUL_KARATSUBA_CUTOFF = MP_SQR_KARATSUBA_CUTOFF = cutoff;
+      MP_MUL_TOOM_CUTOFF = MP_SQR_TOOM_CUTOFF = (2 * cutoff) + 1;
+      for (size = 1; size < 120; size++) {
+         DO(mp_rand(&a, size));
+         DO(mp_rand(&b, size + (int)(rand_uint() % 3u)));
+         DO(mp_mul(&a, &b, &c));
+         DO(s_mp_mul_full(&a, &b, &d));
+         EXPECT(mp_cmp(&c, &d) == MP_EQ);
+         DO(mp_sqr(&a, &c));
+         DO(s_mp_sqr(&a, &d));
+         EXPECT(mp_cmp(&c, &d) == MP_EQ);
+      }
+   }
+
+   MP_MUL_KARATSUBA_CUTOFF = cutoffs[0];
+   MP_SQR_KARATSUBA_CUTOFF = cutoffs[1];
+   MP_MUL_TOOM_CUTOFF = cutoffs[2];
+   MP_SQR_TOOM_CUTOFF = cutoffs[3];
+   mp_clear_multi(&a, &b, &c, &d, NULL);
+   return EXIT_SUCCESS;
+LBL_ERR:
+   MP_MUL_KARATSUBA_CUTOFF = cutoffs[0];
+   MP_SQR_KARATSUBA_CUTOFF = cutoffs[1];
+   MP_MUL_TOOM_CUTOFF = cutoffs[2];
+   MP_SQR_TOOM_CUTOFF = cutoffs[3];
+   mp_clear_multi(&a, &b, &c, &d, NULL);
+   return EXIT_FAILURE;
+}
+
+static int test_mp_div_d(void)
 {
-   mp_int a;
-   int radix;
-   size_t size;
-/* *INDENT-OFF* */
-   size_t results[65] = {
-       0, 0, 1627, 1027, 814, 702, 630, 581, 543,
-       514, 491, 471, 455, 441, 428, 418, 408, 399,
-       391, 384, 378, 372, 366, 361, 356, 352, 347,
-       343, 340, 336, 333, 330, 327, 324, 321, 318,
-       316, 314, 311, 309, 307, 305, 303, 301, 299,
-       298, 296, 294, 293, 291, 290, 288, 287, 285,
-       284, 283, 281, 280, 279, 278, 277, 276, 275,
-       273, 272
+   mp_int a, b, q, r;
+   mp_digit d, rem;
+   int i, j, k;
+   const mp_digit divisors[] = {
+      5u, 7u, 10u, 255u, 1000000007u & MP_MASK, (MP_MASK >> 1) + 1u, (MP_MASK >> 1) + 3u, MP_MASK - 1u, MP_MASK
    };
-/* *INDENT-ON* */
+
+   DOR(mp_init_multi(&a, &b, &q, &r, NULL));
+
+   for (i = 0; i < (int)(sizeof(divisors)/sizeof(divisors[0])) + 8; i++) {
+      /* the table, then random ones */
+      if (i < (int)(sizeof(divisors)/sizeof(divisors[0]))) {
+         mp_set(&b, divisors[i]);
+      } else {
+         DO(mp_rand(&b, 1));
+      }
+      d = b.dp[0];
+      for (j = 1; j < 40; j += 3) {
+         for (k = 0; k < 3; k++) {
+            /* random, all ones and the top digit equal to d */
+            if (k == 0) {
+               DO(mp_rand(&a, j));
+            } else if (k == 1) {
+               DO(s_fill_with_ones(&a, j));
+            } else {
+               DO(mp_mul_d(&b, d, &a));
+               DO(mp_lshd(&a, j));
+            }
+            DO(mp_div_d(&a, d, &q, &rem));
+            DO(mp_div(&a, &b, &a, &r));
+            EXPECT(mp_cmp(&q, &a) == MP_EQ);
+            EXPECT(mp_cmp_d(&r, rem) == MP_EQ);
+         }
+      }
+   }
+
+   mp_clear_multi(&a, &b, &q, &r, NULL);
+   return EXIT_SUCCESS;
+LBL_ERR:
+   mp_clear_multi(&a, &b, &q, &r, NULL);
+   return EXIT_FAILURE;
+}
+
+static int test_s_mp_mod_d_multi(void)
+{
+   mp_int a;
+   mp_digit b[100], r[100], rem;
+   int i, j;
 
    DOR(mp_init(&a));
 
-   /* number to result in a different size for every base: 67^(4 * 67) */
-   mp_set(&a, 67);
-   DO(mp_expt_n(&a, 268, &a));
+   /* small primes first, then larger divisors that pack less well */
+   for (i = 0; i < 80; i++) {
+      b[i] = s_mp_prime_tab[i];
+   }
+   b[80] = 1u;
+   b[81] = MP_MASK;
+   b[82] = (MP_MASK >> 1) + 1u;
+   for (i = 83; i < 100; i++) {
+      DO(mp_rand(&a, 1));
+      b[i] = (a.dp[0] >> (i & 7)) | 1u;
+   }
 
-   for (radix = 2; radix < 65; radix++) {
-      DO(mp_radix_size(&a, radix, &size));
-      EXPECT(size == results[radix]);
-      a.sign = MP_NEG;
-      DO(mp_radix_size(&a, radix, &size));
-      EXPECT(size == (results[radix] + 1));
-      a.sign = MP_ZPOS;
+   for (i = 0; i < 40; i++) {
+      DO(mp_rand(&a, (i % 20) + 1));
+      if (i >= 20) {
+         DO(mp_neg(&a, &a));
+      }
+      DO(s_mp_mod_d_multi(&a, b, 100, r));
+      for (j = 0; j < 100; j++) {
+         DO(mp_mod_d(&a, b[j], &rem));
+         EXPECT(r[j] == rem);
+      }
    }
+   EXPECT(s_mp_mod_d_multi(&a, r, 100, r) == MP_VAL);
 
    mp_clear(&a);
    return EXIT_SUCCESS;
@@ -2184,49 +2705,1135 @@ LBL_ERR:
    return EXIT_FAILURE;
 }
 
-#define PRINTERR_V(...)
-
-/* Some larger values to test the fast division algorithm */
-static int test_s_mp_div_recursive(void)
+static int test_mp_divexact(void)
 {
-   mp_int a, b, c_q, c_r, d_q, d_r;
-   int size;
+   mp_int a, b, c, d;
+   mp_digit e;
+   int i, j, k;
+   const int sizes[] = { 1, 2, 3, 10, 50, 120, 300 };
 
-   DOR(mp_init_multi(&a, &b, &c_q, &c_r, &d_q, &d_r, NULL));
+   DOR(mp_init_multi(&a, &b, &c, &d, NULL));
 
-   for (size = MP_MUL_KARATSUBA_CUTOFF; size < (3 * MP_MUL_KARATSUBA_CUTOFF); size += 10) {
-      printf("\rsizes = %d / %d", 10 * size, size);
-      /* Relation 10:1 */
-      DO(mp_rand(&a, 10 * size));
-      DO(mp_rand(&b, size));
-      DO(s_mp_div_recursive(&a, &b, &c_q, &c_r));
-      DO(s_mp_div_school(&a, &b, &d_q, &d_r));
-      EXPECT(mp_cmp(&c_q, &d_q) == MP_EQ);
-      EXPECT(mp_cmp(&c_r, &d_r) == MP_EQ);
-      printf("\rsizes = %d / %d", 2 * size, size);
+   EXPECT(mp_divexact(&a, &b, &c) == MP_VAL);
+   EXPECT(mp_divexact_d(&a, 0u, &c) == MP_VAL);
+
+   for (i = 0; i < (int)(sizeof(sizes)/sizeof(sizes[0])); i++) {
+      for (j = 0; j < (int)(sizeof(sizes)/sizeof(sizes[0])); j++) {
+         for (k = 0; k < 4; k++) {
+            /* random, a power of two in b, all ones and negative ones */
+            DO(mp_rand(&a, sizes[i]));
+            DO(mp_rand(&b, sizes[j]));
+            if (k == 1) {
+               DO(mp_mul_2d(&b, (k * 37) + j, &b));
+            } else if (k == 2) {
+               DO(s_fill_with_ones(&a, sizes[i]));
+               DO(s_fill_with_ones(&b, sizes[j]));
+            } else if (k == 3) {
+               DO(mp_neg(&b, &b));
+               if ((i & 1) != 0) {
+                  DO(mp_neg(&a, &a));
+               }
+            }
+            DO(mp_mul(&a, &b, &c));
+            DO(mp_divexact(&c, &b, &d));
+            EXPECT(mp_cmp(&d, &a) == MP_EQ);
+
+            /* in place */
+            DO(mp_divexact(&c, &a, &c));
+            EXPECT(mp_cmp(&c, &b) == MP_EQ);
+
+            e = b.dp[0] | ((mp_digit)1 << (MP_DIGIT_BIT - 1));
+            DO(mp_mul_d(&a, e, &c));
+            DO(mp_divexact_d(&c, e, &c));
+            EXPECT(mp_cmp(&c, &a) == MP_EQ);
+         }
+      }
+   }
 
-      /* Relation 10:1 negative numerator*/
-      DO(mp_rand(&a, 10 * size));
-      DO(mp_neg(&a, &a));
-      DO(mp_rand(&b, size));
-      DO(s_mp_div_recursive(&a, &b, &c_q, &c_r));
-      DO(s_mp_div_school(&a, &b, &d_q, &d_r));
-      EXPECT(mp_cmp(&c_q, &d_q) == MP_EQ);
-      EXPECT(mp_cmp(&c_r, &d_r) == MP_EQ);
-      printf("\rsizes = %d / %d, negative numerator", 2 * size, size);
+   mp_zero(&a);
+   DO(mp_divexact(&a, &b, &c));
+   EXPECT(mp_iszero(&c));
 
-      /* Relation 10:1 negative denominator*/
-      DO(mp_rand(&a, 10 * size));
-      DO(mp_rand(&b, size));
-      DO(mp_neg(&b, &b));
-      DO(s_mp_div_recursive(&a, &b, &c_q, &c_r));
-      DO(s_mp_div_school(&a, &b, &d_q, &d_r));
-      EXPECT(mp_cmp(&c_q, &d_q) == MP_EQ);
-      EXPECT(mp_cmp(&c_r, &d_r) == MP_EQ);
-      printf("\rsizes = %d / %d, negative denominator", 2 * size, size);
+   mp_clear_multi(&a, &b, &c, &d, NULL);
+   return EXIT_SUCCESS;
+LBL_ERR:
+   mp_clear_multi(&a, &b, &c, &d, NULL);
+   return EXIT_FAILURE;
+}
 
-      /* Relation 2:1 */
-      DO(mp_rand(&a, 2 * size));
+static int test_s_mp_montgomery_reduce_mul(void)
+{
+   mp_int a, b, c, d, n, ninv;
+   mp_digit rho;
+   int i, j, cutoff = MP_REDUCE_MUL_CUTOFF;
+   const int sizes[] = { 1, 2, 3, 10, 40, 100, 300 };
+
+   DOR(mp_init_multi(&a, &b, &c, &d, &n, &ninv, NULL));
+
+   for (i = 0; i < (int)(sizeof(sizes)/sizeof(sizes[0])); i++) {
+      for (j = 0; j < 3; j++) {
+         /* random, all ones and one */
+         DO(mp_rand(&n, sizes[i]));
+         if (j == 1) {
+            DO(s_fill_with_ones(&n, sizes[i]));
+         }
+         n.dp[0] |= 1u;
+         if ((j == 2) && (i == 0)) {
+            mp_set(&n, 1u);
+         }
+         DO(mp_montgomery_setup(&n, &rho));
+         DO(s_mp_invmod_radix(&n, n.used, &ninv));
+
+         /* a product of two residues and the largest input n*R - 1 */
+         DO(mp_rand(&a, sizes[i]));
+         DO(mp_mod(&a, &n, &a));
+         DO(mp_rand(&b, sizes[i]));
+         DO(mp_mod(&b, &n, &b));
+         DO(mp_mul(&a, &b, &c));
+         DO(mp_copy(&c, &d));
+         DO(s_mp_montgomery_reduce_mul(&c, &n, &ninv));
+         DO(s_mp_montgomery_reduce_comba(&d, &n, rho));
+         EXPECT(mp_cmp(&c, &d) == MP_EQ);
+
+         DO(mp_lshd(&n, n.used));
+         DO(mp_sub_d(&n, 1u, &c));
+         mp_rshd(&n, n.used / 2);
+         DO(mp_copy(&c, &d));
+         DO(s_mp_montgomery_reduce_mul(&c, &n, &ninv));
+         DO(s_mp_montgomery_reduce_comba(&d, &n, rho));
+         EXPECT(mp_cmp(&c, &d) == MP_EQ);
+
+         /* the exponentiations with the reductions by multiplications, odd and even */
+         DO(mp_rand(&b, 2));
+         MP_REDUCE_MUL_CUTOFF = INT_MAX;
+         DO(mp_exptmod(&a, &b, &n, &c));
+         MP_REDUCE_MUL_CUTOFF = 1;
+         DO(mp_exptmod(&a, &b, &n, &d));
+         EXPECT(mp_cmp(&c, &d) == MP_EQ);
+         DO(mp_add_d(&n, 1u, &n));
+         MP_REDUCE_MUL_CUTOFF = INT_MAX;
+         DO(mp_exptmod(&a, &b, &n, &c));
+         MP_REDUCE_MUL_CUTOFF = 1;
+         DO(mp_exptmod(&a, &b, &n, &d));
+         EXPECT(mp_cmp(&c, &d) == MP_EQ);
+         MP_REDUCE_MUL_CUTOFF = cutoff;
+      }
+   }
+
+   mp_clear_multi(&a, &b, &c, &d, &n, &ninv, NULL);
+   return EXIT_SUCCESS;
+LBL_ERR:
+   MP_REDUCE_MUL_CUTOFF = cutoff;
+   mp_clear_multi(&a, &b, &c, &d, &n, &ninv, NULL);
+   return EXIT_FAILURE;
+}
+
+static int test_mp_barrett_ctx(void)
+{
+   mp_int a, b, c, d, m;
+   mp_barrett_ctx ctx;
+   int i, j, k;
+   const int sizes[] = { 1, 2, 5, 17, 40, 100, 200 };
+
+   DOR(mp_init_multi(&a, &b, &c, &d, &m, NULL));
+
+   /* zero and negative moduli */
+   EXPECT(mp_barrett_ctx_init(&ctx, &m) == MP_VAL);
+   mp_set(&m, 7u);
+   DO(mp_neg(&m, &m));
+   EXPECT(mp_barrett_ctx_init(&ctx, &m) == MP_VAL);
+
+   for (i = 0; i < (int)(sizeof(sizes)/sizeof(sizes[0])); i++) {
+      /* random, even, all ones and a power of two */
+      for (j = 0; j < 4; j++) {
+         DO(mp_rand(&m, sizes[i]));
+         if (j == 1) {
+            m.dp[0] &= ~(mp_digit)1;
+            mp_clamp(&m);
+            if (mp_iszero(&m)) {
+               mp_set(&m, 2u);
+            }
+         } else if (j == 2) {
+            DO(s_fill_with_ones(&m, sizes[i]));
+         } else if (j == 3) {
+            DO(mp_2expt(&m, (sizes[i] * MP_DIGIT_BIT) - 1));
+         }
+         DO(mp_barrett_ctx_init(&ctx, &m));
+
+         /* below m, below m**2 and beyond, positive and negative */
+         for (k = 0; k < 6; k++) {
+            DO(mp_rand(&a, ((k >> 1) + 1) * sizes[i]));
+            if ((k & 1) != 0) {
+               DO(mp_neg(&a, &a));
+            }
+            DO(mp_barrett_reduce(&ctx, &a, &c));
+            DO(mp_mod(&a, &m, &d));
+            EXPECT(mp_cmp(&c, &d) == MP_EQ);
+         }
+         DO(mp_sqr(&m, &a));
+         DO(mp_sub_d(&a, 1u, &a));
+         DO(mp_barrett_reduce(&ctx, &a, &c));
+         DO(mp_mod(&a, &m, &d));
+         EXPECT(mp_cmp(&c, &d) == MP_EQ);
+
+         DO(mp_rand(&a, sizes[i]));
+         DO(mp_rand(&b, sizes[i]));
+         DO(mp_neg(&b, &b));
+         DO(mp_barrett_mulmod(&ctx, &a, &b, &c));
+         DO(mp_mulmod(&a, &b, &m, &d));
+         EXPECT(mp_cmp(&c, &d) == MP_EQ);
+
+         /* a**b, a**0 and a negative base */
+         DO(mp_rand(&b, (i % 3) + 1));
+         DO(mp_barrett_exptmod(&ctx, &a, &b, &c));
+         DO(mp_exptmod(&a, &b, &m, &d));
+         EXPECT(mp_cmp(&c, &d) == MP_EQ);
+         mp_zero(&b);
+         DO(mp_barrett_exptmod(&ctx, &a, &b, &c));
+         DO(mp_exptmod(&a, &b, &m, &d));
+         EXPECT(mp_cmp(&c, &d) == MP_EQ);
+         DO(mp_rand(&b, 1));
+         DO(mp_neg(&a, &a));
+         DO(mp_barrett_exptmod(&ctx, &a, &b, &c));
+         DO(mp_exptmod(&a, &b, &m, &d));
+         EXPECT(mp_cmp(&c, &d) == MP_EQ);
+
+         DO(mp_neg(&b, &b));
+         EXPECT(mp_barrett_exptmod(&ctx, &a, &b, &c) == MP_VAL);
+         mp_barrett_ctx_clear(&ctx);
+      }
+   }
+
+   /* everything is zero modulo one */
+   mp_set(&m, 1u);
+   DO(mp_barrett_ctx_init(&ctx, &m));
+   mp_set(&a, 3u);
+   DO(mp_barrett_exptmod(&ctx, &a, &a, &c));
+   EXPECT(mp_iszero(&c));
+   mp_zero(&b);
+   DO(mp_barrett_exptmod(&ctx, &a, &b, &c));
+   EXPECT(mp_iszero(&c));
+   mp_barrett_ctx_clear(&ctx);
+
+   mp_clear_multi(&a, &b, &c, &d, &m, NULL);
+   return EXIT_SUCCESS;
+LBL_ERR:
+   mp_clear_multi(&a, &b, &c, &d, &m, NULL);
+   return EXIT_FAILURE;
+}
+
+static int test_mp_mont_ctx(void)
+{
+   mp_int a, b, c, d, e, n;
+   mp_mont_ctx ctx;
+   int i, j;
+   const int sizes[] = { 1, 2, 5, 17, 40, 100, 200 };
+
+   DOR(mp_init_multi(&a, &b, &c, &d, &e, &n, NULL));
+
+   /* even, zero and negative moduli */
+   mp_set(&n, 10u);
+   EXPECT(mp_mont_ctx_init(&ctx, &n) == MP_VAL);
+   mp_zero(&n);
+   EXPECT(mp_mont_ctx_init(&ctx, &n) == MP_VAL);
+   mp_set(&n, 7u);
+   DO(mp_neg(&n, &n));
+   EXPECT(mp_mont_ctx_init(&ctx, &n) == MP_VAL);
+
+   for (i = 0; i < (int)(sizeof(sizes)/sizeof(sizes[0])); i++) {
+      /* random, then all ones */
+      for (j = 0; j < 2; j++) {
+         if (j == 0) {
+            DO(mp_rand(&n, sizes[i]));
+         } else {
+            DO(s_fill_with_ones(&n, sizes[i]));
+         }
+         n.dp[0] |= 1u;
+         DO(mp_mont_ctx_init(&ctx, &n));
+
+         /* a larger than n and negative b must be reduced on the way in */
+         DO(mp_rand(&a, sizes[i] + 1));
+         DO(mp_rand(&b, sizes[i]));
+         DO(mp_neg(&b, &b));
+         DO(mp_mont_to(&ctx, &a, &c));
+         DO(mp_mont_to(&ctx, &b, &d));
+         DO(mp_mont_mul(&ctx, &c, &d, &e));
+         DO(mp_mont_from(&ctx, &e, &e));
+         DO(mp_mulmod(&a, &b, &n, &c));
+         EXPECT(mp_cmp(&e, &c) == MP_EQ);
+
+         DO(mp_mont_to(&ctx, &a, &c));
+         DO(mp_mont_sqr(&ctx, &c, &c));
+         DO(mp_mont_from(&ctx, &c, &c));
+         DO(mp_sqrmod(&a, &n, &d));
+         EXPECT(mp_cmp(&c, &d) == MP_EQ);
+
+         /* operands longer than n, beyond the room of the fused product */
+         DO(mp_rand(&a, sizes[i] + 50));
+         DO(mp_rand(&b, sizes[i]));
+         DO(mp_neg(&b, &b));
+         DO(mp_mont_mul(&ctx, &a, &b, &c));
+         DO(mp_mod(&a, &n, &d));
+         DO(mp_mod(&b, &n, &e));
+         DO(mp_mont_mul(&ctx, &d, &e, &e));
+         EXPECT(mp_cmp(&c, &e) == MP_EQ);
+         DO(mp_mont_sqr(&ctx, &a, &c));
+         DO(mp_mont_sqr(&ctx, &d, &e));
+         EXPECT(mp_cmp(&c, &e) == MP_EQ);
+
+         /* a**b, a**0 and a negative base */
+         DO(mp_rand(&b, (i % 3) + 1));
+         DO(mp_mont_exptmod(&ctx, &a, &b, &c));
+         DO(mp_exptmod(&a, &b, &n, &d));
+         EXPECT(mp_cmp(&c, &d) == MP_EQ);
+         mp_zero(&e);
+         DO(mp_mont_exptmod(&ctx, &a, &e, &c));
+         DO(mp_exptmod(&a, &e, &n, &d));
+         EXPECT(mp_cmp(&c, &d) == MP_EQ);
+         DO(mp_neg(&a, &a));
+         DO(mp_mont_exptmod(&ctx, &a, &b, &c));
+         DO(mp_exptmod(&a, &b, &n, &d));
+         EXPECT(mp_cmp(&c, &d) == MP_EQ);
+
+         DO(mp_neg(&b, &b));
+         EXPECT(mp_mont_exptmod(&ctx, &a, &b, &c) == MP_VAL);
+         mp_mont_ctx_clear(&ctx);
+      }
+   }
+
+   /* everything is zero modulo one */
+   mp_set(&n, 1u);
+   DO(mp_mont_ctx_init(&ctx, &n));
+   mp_set(&a, 3u);
+   DO(mp_mont_exptmod(&ctx, &a, &a, &c));
+   EXPECT(mp_iszero(&c));
+   mp_mont_ctx_clear(&ctx);
+
+   mp_clear_multi(&a, &b, &c, &d, &e, &n, NULL);
+   return EXIT_SUCCESS;
+LBL_ERR:
+   mp_clear_multi(&a, &b, &c, &d, &e, &n, NULL);
+   return EXIT_FAILURE;
+}
+
+static int test_mp_fixed_base_ctx(void)
+{
+   mp_int g, x, n, c, d;
+   mp_fixed_base_ctx ctx, imp;
+   mp_digit *buf = NULL;
+   size_t count = 0, written;
+   int i, j, k;
+   const int sizes[] = { 1, 2, 5, 17, 40 };
+   const int bits[] = { 1, 7, 64, 160, 0 };
+
+   DOR(mp_init_multi(&g, &x, &n, &c, &d, NULL));
+
+   /* even, zero and negative moduli, no bits */
+   mp_set(&g, 3u);
+   mp_set(&n, 10u);
+   EXPECT(mp_fixed_base_ctx_init(&ctx, &g, &n, 64) == MP_VAL);
+   mp_zero(&n);
+   EXPECT(mp_fixed_base_ctx_init(&ctx, &g, &n, 64) == MP_VAL);
+   mp_set(&n, 7u);
+   DO(mp_neg(&n, &n));
+   EXPECT(mp_fixed_base_ctx_init(&ctx, &g, &n, 64) == MP_VAL);
+   mp_set(&n, 7u);
+   EXPECT(mp_fixed_base_ctx_init(&ctx, &g, &n, 0) == MP_VAL);
+
+   for (i = 0; i < (int)(sizeof(sizes)/sizeof(sizes[0])); i++) {
+      for (j = 0; j < (int)(sizeof(bits)/sizeof(bits[0])); j++) {
+         /* the last comb is as long as n, the base negative and larger than n */
+         int b = (bits[j] != 0) ? bits[j] : sizes[i] * MP_DIGIT_BIT;
+         DO(mp_rand(&n, sizes[i]));
+         n.dp[0] |= 1u;
+         DO(mp_rand(&g, sizes[i] + 1));
+         if ((j & 1) == 1) {
+            DO(mp_neg(&g, &g));
+         }
+         DO(mp_fixed_base_ctx_init(&ctx, &g, &n, b));
+
+         /* exponents of all lengths up to the comb, longer ones and zero */
+         for (k = 0; k < 8; k++) {
+            DO(mp_rand(&x, (b + MP_DIGIT_BIT - 1) / MP_DIGIT_BIT));
+            if (k < 6) {
+               DO(mp_mod_2d(&x, (b * (k + 1)) / 6, &x));
+            } else if (k == 6) {
+               DO(mp_mul_2d(&x, 3, &x));
+               DO(mp_add_d(&x, 1u, &x));
+            } else {
+               mp_zero(&x);
+            }
+            DO(mp_fixed_base_exptmod(&ctx, &x, &c));
+            DO(mp_exptmod(&g, &x, &n, &d));
+            EXPECT(mp_cmp(&c, &d) == MP_EQ);
+         }
+         mp_set(&x, 1u);
+         DO(mp_neg(&x, &x));
+         EXPECT(mp_fixed_base_exptmod(&ctx, &x, &c) == MP_VAL);
+
+         /* the exported table makes the same context */
+         count = mp_fixed_base_count(&ctx);
+         buf = (mp_digit *) malloc(sizeof(mp_digit) * count);
+         EXPECT(buf != NULL);
+         EXPECT(mp_fixed_base_export(&ctx, buf, count - 1u, &written) == MP_BUF);
+         DO(mp_fixed_base_export(&ctx, buf, count, &written));
+         EXPECT(written == count);
+         EXPECT(mp_fixed_base_ctx_import(&imp, &g, &n, b, buf, count - 1u) == MP_VAL);
+         DO(mp_fixed_base_ctx_import(&imp, &g, &n, b, buf, count));
+         DO(mp_rand(&x, (b + MP_DIGIT_BIT - 1) / MP_DIGIT_BIT));
+         DO(mp_mod_2d(&x, b, &x));
+         DO(mp_fixed_base_exptmod(&imp, &x, &c));
+         DO(mp_exptmod(&g, &x, &n, &d));
+         EXPECT(mp_cmp(&c, &d) == MP_EQ);
+         mp_fixed_base_ctx_clear(&imp);
+
+         /* an entry that is not below n */
+         for (k = 0; k < n.used; k++) {
+            buf[k] = n.dp[k];
+         }
+         EXPECT(mp_fixed_base_ctx_import(&imp, &g, &n, b, buf, count) == MP_VAL);
+         free(buf);
+         buf = NULL;
+         mp_fixed_base_ctx_clear(&ctx);
+      }
+   }
+
+   /* everything is zero modulo one */
+   mp_set(&n, 1u);
+   mp_set(&g, 3u);
+   DO(mp_fixed_base_ctx_init(&ctx, &g, &n, 8));
+   DO(mp_fixed_base_exptmod(&ctx, &g, &c));
+   EXPECT(mp_iszero(&c));
+   mp_fixed_base_ctx_clear(&ctx);
+
+   mp_clear_multi(&g, &x, &n, &c, &d, NULL);
+   return EXIT_SUCCESS;
+LBL_ERR:
+   free(buf);
+   mp_clear_multi(&g, &x, &n, &c, &d, NULL);
+   return EXIT_FAILURE;
+}
+
+static int test_mp_crt_ctx(void)
+{
+   mp_int p, q, n, d, dp, dq, qinv, c, x, y;
+   mp_crt_ctx ctx;
+   int i, j, k;
+   const int bits[] = { 40, 130, 256, 700 };
+
+   DOR(mp_init_multi(&p, &q, &n, &d, &dp, &dq, &qinv, &c, &x, &y, NULL));
+
+   for (i = 0; i < (int)(sizeof(bits)/sizeof(bits[0])); i++) {
+      /* a key with primes of different lengths, d = 1/65537 mod lcm(p - 1, q - 1) */
+      DO(mp_prime_rand(&p, 8, bits[i], MP_PRIME_2MSB_ON));
+      do {
+         DO(mp_prime_rand(&q, 8, bits[i] + (i & 1) * 17, MP_PRIME_2MSB_ON));
+      } while (mp_cmp(&p, &q) == MP_EQ);
+      DO(mp_mul(&p, &q, &n));
+      DO(mp_sub_d(&p, 1u, &dp));
+      DO(mp_sub_d(&q, 1u, &dq));
+      DO(mp_lcm(&dp, &dq, &x));
+      mp_set_u32(&y, 65537u);
+      if (mp_invmod(&y, &x, &d) != MP_OKAY) {
+         continue;
+      }
+      DO(mp_mod(&d, &dp, &dp));
+      DO(mp_mod(&d, &dq, &dq));
+      DO(mp_invmod(&q, &p, &qinv));
+
+      /* without and with the second thread, the latter only if built with it */
+      for (j = 0; j < 2; j++) {
+         if (mp_crt_ctx_init(&ctx, &dp, &dq, &p, &q, &qinv, j == 1) == MP_VAL) {
+            EXPECT(j == 1);
+            continue;
+         }
+         for (k = 0; k < 6; k++) {
+            if (k == 0) {
+               mp_zero(&c);
+            } else if (k == 1) {
+               DO(mp_sub_d(&n, 1u, &c));
+            } else if (k == 2) {
+               /* larger than n */
+               DO(mp_mul_2d(&n, 3, &c));
+               DO(mp_add_d(&c, 5u, &c));
+            } else {
+               DO(mp_rand(&c, n.used));
+               DO(mp_mod(&c, &n, &c));
+            }
+            DO(mp_crt_exptmod(&ctx, &c, &x));
+            DO(mp_exptmod(&c, &d, &n, &y));
+            EXPECT(mp_cmp(&x, &y) == MP_EQ);
+         }
+         /* out may be c */
+         DO(mp_crt_exptmod(&ctx, &c, &c));
+         EXPECT(mp_cmp(&c, &y) == MP_EQ);
+         mp_crt_ctx_clear(&ctx);
+      }
+      DO(mp_rand(&c, n.used));
+      DO(mp_exptmod_crt(&c, &dp, &dq, &p, &q, &qinv, &x));
+      DO(mp_exptmod(&c, &d, &n, &y));
+      EXPECT(mp_cmp(&x, &y) == MP_EQ);
+   }
+
+   /* an even prime, a negative exponent and a wrong qinv */
+   DO(mp_add_d(&p, 1u, &x));
+   EXPECT(mp_crt_ctx_init(&ctx, &dp, &dq, &x, &q, &qinv, false) == MP_VAL);
+   DO(mp_neg(&dp, &x));
+   EXPECT(mp_crt_ctx_init(&ctx, &x, &dq, &p, &q, &qinv, false) == MP_VAL);
+   DO(mp_add_d(&qinv, 1u, &x));
+   EXPECT(mp_crt_ctx_init(&ctx, &dp, &dq, &p, &q, &x, false) == MP_VAL);
+   EXPECT(mp_exptmod_crt(&c, &dp, &dq, &p, &q, &x, &y) == MP_VAL);
+
+   mp_clear_multi(&p, &q, &n, &d, &dp, &dq, &qinv, &c, &x, &y, NULL);
+   return EXIT_SUCCESS;
+LBL_ERR:
+   mp_clear_multi(&p, &q, &n, &d, &dp, &dq, &qinv, &c, &x, &y, NULL);
+   return EXIT_FAILURE;
+}
+
+static int test_mp_exptmod_batch(void)
+{
+   mp_int g[40], x[40], p[40], y[40], m[4], t;
+   const mp_int *pg[40], *px[40], *pp[40];
+   mp_int *py[40];
+   mp_err errs[40];
+   int i, j, threads;
+
+   DOR(mp_init(&t));
+   for (i = 0; i < 40; i++) {
+      if (mp_init_multi(&g[i], &x[i], &p[i], &y[i], NULL) != MP_OKAY) {
+         while (i-- > 0) {
+            mp_clear_multi(&g[i], &x[i], &p[i], &y[i], NULL);
+         }
+         mp_clear(&t);
+         return EXIT_FAILURE;
+      }
+      pg[i] = &g[i];
+      px[i] = &x[i];
+      pp[i] = &p[i];
+      py[i] = &y[i];
+   }
+   for (i = 0; i < 4; i++) {
+      if (mp_init(&m[i]) != MP_OKAY) {
+         while (i-- > 0) {
+            mp_clear(&m[i]);
+         }
+         goto LBL_ERR;
+      }
+   }
+
+   EXPECT(mp_exptmod_batch(pg, px, pp, py, -1, NULL) == MP_VAL);
+   DO(mp_exptmod_batch(pg, px, pp, py, 0, NULL));
+
+   /* three shared odd moduli, an even one, one of each job */
+   DO(mp_rand(&m[0], 3));
+   DO(mp_rand(&m[1], 20));
+   DO(mp_rand(&m[2], 2));
+   DO(mp_rand(&m[3], 5));
+   m[0].dp[0] |= 1u;
+   m[1].dp[0] |= 1u;
+   m[2].dp[0] |= 1u;
+   m[3].dp[0] &= ~(mp_digit)1;
+
+   /* without and with worker threads, the latter only if built with them */
+   for (threads = 0; threads < 2; threads++) {
+      if ((threads == 1) && (mp_mul_threads(3) == MP_VAL)) {
+         break;
+      }
+      for (i = 0; i < 40; i++) {
+         if ((i % 5) < 4) {
+            DO(mp_copy(&m[(i * 7) % 4], &p[i]));
+         } else {
+            DO(mp_rand(&p[i], (i % 7) + 1));
+            p[i].dp[0] |= 1u;
+         }
+         DO(mp_rand(&g[i], p[i].used + 1));
+         DO(mp_rand(&x[i], (i % 4) + 1));
+         /* negative exponents need a base that is invertible */
+         if ((i % 6) == 1) {
+            mp_set(&g[i], 2u);
+            if (mp_isodd(&p[i])) {
+               DO(mp_neg(&x[i], &x[i]));
+            }
+         }
+      }
+
+      DO(mp_exptmod_batch(pg, px, pp, py, 40, errs));
+      for (i = 0; i < 40; i++) {
+         EXPECT(errs[i] == MP_OKAY);
+         DO(mp_exptmod(&g[i], &x[i], &p[i], &t));
+         EXPECT(mp_cmp(&y[i], &t) == MP_EQ);
+      }
+
+      /* the output may be the base of its job, failed jobs are reported one by one */
+      for (i = 0; i < 40; i++) {
+         py[i] = &g[i];
+         DO(mp_exptmod(&g[i], &x[i], &p[i], &y[i]));
+      }
+      mp_zero(&p[7]);
+      mp_zero(&p[13]);
+      EXPECT(mp_exptmod_batch(pg, px, pp, py, 40, errs) == MP_VAL);
+      for (i = 0; i < 40; i++) {
+         j = ((i == 7) || (i == 13)) ? 1 : 0;
+         EXPECT(errs[i] == (j ? MP_VAL : MP_OKAY));
+         EXPECT(j || (mp_cmp(&g[i], &y[i]) == MP_EQ));
+         py[i] = &y[i];
+      }
+      EXPECT(mp_exptmod_batch(pg, px, pp, py, 40, NULL) == MP_VAL);
+   }
+
+   DO(mp_mul_threads(0));
+   for (i = 0; i < 4; i++) {
+      mp_clear(&m[i]);
+   }
+   for (i = 0; i < 40; i++) {
+      mp_clear_multi(&g[i], &x[i], &p[i], &y[i], NULL);
+   }
+   mp_clear(&t);
+   return EXIT_SUCCESS;
+LBL_ERR:
+   DOR(mp_mul_threads(0));
+   for (i = 0; i < 4; i++) {
+      mp_clear(&m[i]);
+   }
+   for (i = 0; i < 40; i++) {
+      mp_clear_multi(&g[i], &x[i], &p[i], &y[i], NULL);
+   }
+   mp_clear(&t);
+   return EXIT_FAILURE;
+}
+
+static int test_mp_exptmod_multi(void)
+{
+   mp_int a[200], x[200], m, c, d, t;
+   const mp_int *pa[200], *px[200];
+   int i, j, k, cutoff = MP_SQR_KARATSUBA_CUTOFF;
+   const int counts[] = { 1, 2, 3, 8, 200 };
+
+   DOR(mp_init_multi(&m, &c, &d, &t, NULL));
+   for (i = 0; i < 200; i++) {
+      if (mp_init_multi(&a[i], &x[i], NULL) != MP_OKAY) {
+         while (i-- > 0) {
+            mp_clear_multi(&a[i], &x[i], NULL);
+         }
+         mp_clear_multi(&m, &c, &d, &t, NULL);
+         return EXIT_FAILURE;
+      }
+      pa[i] = &a[i];
+      px[i] = &x[i];
+   }
+
+   /* invalid moduli and no bases at all */
+   EXPECT(mp_exptmod_multi(pa, px, 1, &m, &c) == MP_VAL);
+   mp_set(&m, 7u);
+   EXPECT(mp_exptmod_multi(pa, px, -1, &m, &c) == MP_VAL);
+   DO(mp_exptmod_multi(pa, px, 0, &m, &c));
+   EXPECT(mp_cmp_d(&c, 1u) == MP_EQ);
+   mp_set(&a[0], 5u);
+   mp_zero(&x[0]);
+   DO(mp_exptmod_multi(pa, px, 1, &m, &c));
+   EXPECT(mp_cmp_d(&c, 1u) == MP_EQ);
+   mp_set(&m, 1u);
+   DO(mp_exptmod_multi(pa, px, 0, &m, &c));
+   EXPECT(mp_iszero(&c));
+
+   for (i = 0; i < (int)(sizeof(counts)/sizeof(counts[0])); i++) {
+      /* odd, odd with negative exponents of the invertible base 2, even and
+       * odd without the lazy products
+       */
+      for (j = 0; j < 4; j++) {
+         DO(mp_rand(&m, (j == 3) ? (8 + i) : (1 + ((i + j) % 5))));
+         if (j == 2) {
+            m.dp[0] &= ~(mp_digit)1;
+            mp_clamp(&m);
+            if (mp_iszero(&m)) {
+               mp_set(&m, 2u);
+            }
+         } else {
+            m.dp[0] |= 1u;
+         }
+
+         /* exponents of all sizes, zero and negative bases beyond m */
+         for (k = 0; k < counts[i]; k++) {
+            DO(mp_rand(&a[k], m.used + (k % 2)));
+            if ((k % 3) == 1) {
+               DO(mp_neg(&a[k], &a[k]));
+            }
+            if ((k % 7) == 3) {
+               mp_zero(&x[k]);
+            } else {
+               /* many short ones for the buckets */
+               DO(mp_rand(&x[k], (counts[i] > 8) ? 1 : (1 + (k % 3))));
+            }
+            if ((j == 1) && ((k % 2) == 0)) {
+               mp_set(&a[k], 2u);
+               DO(mp_neg(&x[k], &x[k]));
+            }
+         }
+
+         mp_set(&d, 1u);
+         DO(mp_mod(&d, &m, &d));
+         for (k = 0; k < counts[i]; k++) {
+            DO(mp_exptmod(&a[k], &x[k], &m, &t));
+            DO(mp_mulmod(&d, &t, &m, &d));
+         }
+         if (j == 3) {
+            MP_SQR_KARATSUBA_CUTOFF = 8;
+         }
+         DO(mp_exptmod_multi(pa, px, counts[i], &m, &c));
+         MP_SQR_KARATSUBA_CUTOFF = cutoff;
+         EXPECT(mp_cmp(&c, &d) == MP_EQ);
+      }
+   }
+
+   /* the result may be one of the inputs */
+   m.dp[0] |= 1u;
+   DO(mp_exptmod_multi(pa, px, 3, &m, &c));
+   DO(mp_exptmod_multi(pa, px, 3, &m, &a[0]));
+   EXPECT(mp_cmp(&a[0], &c) == MP_EQ);
+
+   for (i = 0; i < 200; i++) {
+      mp_clear_multi(&a[i], &x[i], NULL);
+   }
+   mp_clear_multi(&m, &c, &d, &t, NULL);
+   return EXIT_SUCCESS;
+LBL_ERR:
+   MP_SQR_KARATSUBA_CUTOFF = cutoff;
+   for (i = 0; i < 200; i++) {
+      mp_clear_multi(&a[i], &x[i], NULL);
+   }
+   mp_clear_multi(&m, &c, &d, &t, NULL);
+   return EXIT_FAILURE;
+}
+
+static int test_mp_div_ctx(void)
+{
+   mp_int a, b, c_q, c_r, d_q, d_r;
+   mp_div_ctx ctx;
+   int i, j, k;
+   const int bsizes[] = { 1, 2, 3, 5, 17, 60, 150, 320 };
+   const int asizes[] = { 1, 2, 4, 20, 150, 400, 1000 };
+
+   DOR(mp_init_multi(&a, &b, &c_q, &c_r, &d_q, &d_r, NULL));
+
+   EXPECT(mp_div_ctx_init(&ctx, &b) == MP_VAL);
+
+   for (i = 0; i < (int)(sizeof(bsizes)/sizeof(bsizes[0])); i++) {
+      for (k = 0; k < 4; k++) {
+         /* random, all ones, a small upper digit and a negative one */
+         DO(mp_rand(&b, bsizes[i]));
+         if (k == 1) {
+            DO(s_fill_with_ones(&b, bsizes[i]));
+         } else if (k == 2) {
+            DO(mp_2expt(&b, (bsizes[i] - 1) * MP_DIGIT_BIT));
+            DO(mp_add_d(&b, 1u, &b));
+         } else if (k == 3) {
+            DO(mp_neg(&b, &b));
+         }
+         DO(mp_div_ctx_init(&ctx, &b));
+         for (j = 0; j < (int)(sizeof(asizes)/sizeof(asizes[0])); j++) {
+            printf("\rsizes = %d / %d, case %d", asizes[j], bsizes[i], k);
+            DO(mp_rand(&a, asizes[j]));
+            if ((j & 1) != 0) {
+               DO(mp_neg(&a, &a));
+            }
+            DO(mp_div_ctx_divmod(&ctx, &a, &c_q, &c_r));
+            DO(mp_div(&a, &b, &d_q, &d_r));
+            EXPECT(mp_cmp(&c_q, &d_q) == MP_EQ);
+            EXPECT(mp_cmp(&c_r, &d_r) == MP_EQ);
+
+            /* an exact quotient, in place */
+            DO(mp_mul(&a, &b, &c_r));
+            DO(mp_div_ctx_divmod(&ctx, &c_r, &c_r, &d_r));
+            EXPECT(mp_cmp(&c_r, &a) == MP_EQ);
+            EXPECT(mp_iszero(&d_r));
+
+            /* one less */
+            DO(mp_mul(&a, &b, &a));
+            DO(mp_decr(&a));
+            DO(mp_div_ctx_divmod(&ctx, &a, &c_q, &c_r));
+            DO(mp_div(&a, &b, &d_q, &d_r));
+            EXPECT(mp_cmp(&c_q, &d_q) == MP_EQ);
+            EXPECT(mp_cmp(&c_r, &d_r) == MP_EQ);
+         }
+         mp_div_ctx_clear(&ctx);
+      }
+   }
+
+   mp_clear_multi(&a, &b, &c_q, &c_r, &d_q, &d_r, NULL);
+   return EXIT_SUCCESS;
+LBL_ERR:
+   mp_clear_multi(&a, &b, &c_q, &c_r, &d_q, &d_r, NULL);
+   return EXIT_FAILURE;
+}
+
+static int test_mp_mul_low_high(void)
+{
+   mp_int a, b, c, d, mu;
+   int size, digs, i, cutoff;
+
+   cutoff = MP_MUL_KARATSUBA_CUTOFF;
+   DOR(mp_init_multi(&a, &b, &c, &d, &mu, NULL));
+   MP_MUL_KARATSUBA_CUTOFF = 8;
+   for (size = 1; size < 300; size += 1 + (size / 4)) {
+      for (i = 0; i < 4; i++) {
+         DO(mp_rand(&a, size));
+         DO(mp_rand(&b, 1 + (int)(rand_uint() % (unsigned)(size + 8))));
+         if (i == 3) {
+            DO(s_fill_with_ones(&a, size));
+            DO(s_fill_with_ones(&b, size + (i & 1)));
+         }
+         if ((i & 1) != 0) {
+            DO(mp_neg(&a, &a));
+         }
+         digs = (int)(rand_uint() % (unsigned)(a.used + b.used + 2));
+
+         DO(mp_mul(&a, &b, &d));
+         DO(mp_mod_2d(&d, digs * MP_DIGIT_BIT, &d));
+         DO(mp_mul_low(&a, &b, digs, &c));
+         EXPECT(mp_cmp(&c, &d) == MP_EQ);
+
+         DO(mp_mul(&a, &b, &d));
+         mp_rshd(&d, digs);
+         DO(mp_mul_high(&a, &b, digs, &c));
+         EXPECT(mp_cmp(&c, &d) == MP_EQ);
+         DO(mp_mul_high(&a, &b, digs, &a));
+         EXPECT(mp_cmp(&a, &d) == MP_EQ);
+      }
+
+      /* Barrett uses both */
+      DO(mp_rand(&b, size));
+      b.sign = MP_ZPOS;
+      DO(mp_rand(&a, 2 * size));
+      a.sign = MP_ZPOS;
+      DO(mp_sqr(&b, &c));
+      DO(mp_mod(&a, &c, &a));
+      DO(mp_reduce_setup(&mu, &b));
+      DO(mp_mod(&a, &b, &d));
+      DO(mp_reduce(&a, &b, &mu));
+      EXPECT(mp_cmp(&a, &d) == MP_EQ);
+   }
+
+   MP_MUL_KARATSUBA_CUTOFF = cutoff;
+   mp_clear_multi(&a, &b, &c, &d, &mu, NULL);
+   return EXIT_SUCCESS;
+LBL_ERR:
+   MP_MUL_KARATSUBA_CUTOFF = cutoff;
+   mp_clear_multi(&a, &b, &c, &d, &mu, NULL);
+   return EXIT_FAILURE;
+}
+
+static int test_mp_mul_threads(void)
+{
+   mp_int a, b, c, d;
+   int size, cutoffs[7];
+
+   cutoffs[0] = MP_MUL_KARATSUBA_CUTOFF;
+   cutoffs[1] = MP_MUL_TOOM_CUTOFF;
+   cutoffs[2] = MP_MUL_PARALLEL_CUTOFF;
+   cutoffs[3] = MP_MUL_FFT_CUTOFF;
+   cutoffs[4] = MP_SQR_KARATSUBA_CUTOFF;
+   cutoffs[5] = MP_SQR_TOOM_CUTOFF;
+   cutoffs[6] = MP_SQR_FFT_CUTOFF;
+   DOR(mp_init_multi(&a, &b, &c, &d, NULL));
+
+   EXPECT(mp_mul_threads(-1) == MP_VAL);
+   if (mp_mul_threads(3) == MP_VAL) {
+      /* built without threads */
+      EXPECT(mp_mul_threads(0) == MP_OKAY);
+   }
+
+   MP_MUL_KARATSUBA_CUTOFF = 8;
+   MP_MUL_TOOM_CUTOFF = 40;
+   MP_MUL_PARALLEL_CUTOFF = 10;
+   /* the largest ones go to the NTT with its primes in parallel */
+   MP_MUL_FFT_CUTOFF = 600;
+   MP_SQR_KARATSUBA_CUTOFF = 8;
+   MP_SQR_TOOM_CUTOFF = 40;
+   MP_SQR_FFT_CUTOFF = 600;
+   for (size = 30; size < 2000; size += 1 + (size / 4)) {
+      DO(mp_rand(&a, size));
+      DO(mp_rand(&b, size + (int)(rand_uint() % (unsigned)((size / 5) + 1))));
+      DO(mp_mul(&a, &b, &c));
+      DO(s_mp_mul_full(&a, &b, &d));
+      EXPECT(mp_cmp(&c, &d) == MP_EQ);
+      DO(s_mp_mul_karatsuba(&b, &a, &c, NULL));
+      EXPECT(mp_cmp(&c, &d) == MP_EQ);
+      DO(mp_sqr(&a, &c));
+      DO(s_mp_mul_full(&a, &a, &d));
+      EXPECT(mp_cmp(&c, &d) == MP_EQ);
+   }
+
+   MP_MUL_KARATSUBA_CUTOFF = cutoffs[0];
+   MP_MUL_TOOM_CUTOFF = cutoffs[1];
+   MP_MUL_PARALLEL_CUTOFF = cutoffs[2];
+   MP_MUL_FFT_CUTOFF = cutoffs[3];
+   MP_SQR_KARATSUBA_CUTOFF = cutoffs[4];
+   MP_SQR_TOOM_CUTOFF = cutoffs[5];
+   MP_SQR_FFT_CUTOFF = cutoffs[6];
+   mp_clear_multi(&a, &b, &c, &d, NULL);
+   DOR(mp_mul_threads(0));
+   return EXIT_SUCCESS;
+LBL_ERR:
+   MP_MUL_KARATSUBA_CUTOFF = cutoffs[0];
+   MP_MUL_TOOM_CUTOFF = cutoffs[1];
+   MP_MUL_PARALLEL_CUTOFF = cutoffs[2];
+   MP_MUL_FFT_CUTOFF = cutoffs[3];
+   MP_SQR_KARATSUBA_CUTOFF = cutoffs[4];
+   MP_SQR_TOOM_CUTOFF = cutoffs[5];
+   MP_SQR_FFT_CUTOFF = cutoffs[6];
+   mp_clear_multi(&a, &b, &c, &d, NULL);
+   DOR(mp_mul_threads(0));
+   return EXIT_FAILURE;
+}
+
+static int test_s_mp_mul_toom4(void)
+{
+   mp_int a, b, c, d;
+   int size;
+
+   DOR(mp_init_multi(&a, &b, &c, &d, NULL));
+   for (size = 4; size < 400; size += 1 + (size / 8)) {
+      DO(mp_rand(&a, size));
+      DO(mp_rand(&b, size + (rand_int() & 15)));
+      DO(s_mp_mul_toom4(&a, &b, &c));
+      DO(s_mp_mul_full(&a, &b, &d));
+      EXPECT(mp_cmp(&c, &d) == MP_EQ);
+      DO(s_fill_with_ones(&a, size));
+      DO(s_fill_with_ones(&b, size + 1));
+      DO(s_mp_mul_toom4(&a, &b, &c));
+      DO(s_mp_mul_full(&a, &b, &d));
+      EXPECT(mp_cmp(&c, &d) == MP_EQ);
+   }
+   for (size = MP_MUL_TOOM4_CUTOFF; size < (MP_MUL_TOOM4_CUTOFF + 10); size++) {
+      DO(mp_rand(&a, size));
+      DO(mp_rand(&b, size));
+      DO(s_mp_mul_toom4(&a, &b, &c));
+      DO(s_mp_mul_full(&a, &b, &d));
+      EXPECT(mp_cmp(&c, &d) == MP_EQ);
+   }
+
+   mp_clear_multi(&a, &b, &c, &d, NULL);
+   return EXIT_SUCCESS;
+LBL_ERR:
+   mp_clear_multi(&a, &b, &c, &d, NULL);
+   return EXIT_FAILURE;
+}
+
+static int test_s_mp_sqr_toom4(void)
+{
+   mp_int a, b, c;
+   int size;
+
+   DOR(mp_init_multi(&a, &b, &c, NULL));
+   for (size = 4; size < 400; size += 1 + (size / 8)) {
+      DO(mp_rand(&a, size));
+      DO(s_mp_sqr_toom4(&a, &b));
+      DO(s_mp_sqr(&a, &c));
+      EXPECT(mp_cmp(&b, &c) == MP_EQ);
+      DO(s_fill_with_ones(&a, size));
+      DO(s_mp_sqr_toom4(&a, &b));
+      DO(s_mp_sqr(&a, &c));
+      EXPECT(mp_cmp(&b, &c) == MP_EQ);
+   }
+   for (size = MP_SQR_TOOM4_CUTOFF; size < (MP_SQR_TOOM4_CUTOFF + 10); size++) {
+      DO(mp_rand(&a, size));
+      DO(s_mp_sqr_toom4(&a, &b));
+      DO(s_mp_sqr(&a, &c));
+      EXPECT(mp_cmp(&b, &c) == MP_EQ);
+   }
+
+   mp_clear_multi(&a, &b, &c, NULL);
+   return EXIT_SUCCESS;
+LBL_ERR:
+   mp_clear_multi(&a, &b, &c, NULL);
+   return EXIT_FAILURE;
+}
+
+/* checks an unbalanced Toom-Cook variant with operands of a size ratio around num:den */
+static int s_test_mul_unbalanced(mp_err (*mul)(const mp_int *a, const mp_int *b, mp_int *c), int num, int den)
+{
+   mp_int a, b, c, d;
+   int size;
+
+   DOR(mp_init_multi(&a, &b, &c, &d, NULL));
+   for (size = den; size < 300; size += 1 + (size / 8)) {
+      DO(mp_rand(&a, ((size * num) / den) + (rand_int() % (1 + (size / 4)))));
+      DO(mp_rand(&b, size));
+      DO(mul(&a, &b, &c));
+      DO(s_mp_mul_full(&a, &b, &d));
+      EXPECT(mp_cmp_mag(&c, &d) == MP_EQ);
+      DO(s_fill_with_ones(&a, (size * num) / den));
+      DO(s_fill_with_ones(&b, size));
+      DO(mul(&a, &b, &c));
+      DO(s_mp_mul_full(&a, &b, &d));
+      EXPECT(mp_cmp_mag(&c, &d) == MP_EQ);
+      /* either order and any sign, the result is the magnitude */
+      DO(mp_neg(&b, &b));
+      DO(mul(&b, &a, &c));
+      DO(mp_mul(&b, &a, &d));
+      EXPECT(mp_cmp_mag(&c, &d) == MP_EQ);
+   }
+
+   mp_clear_multi(&a, &b, &c, &d, NULL);
+   return EXIT_SUCCESS;
+LBL_ERR:
+   mp_clear_multi(&a, &b, &c, &d, NULL);
+   return EXIT_FAILURE;
+}
+
+static int test_s_mp_mul_toom32(void)
+{
+   return s_test_mul_unbalanced(s_mp_mul_toom32, 3, 2);
+}
+
+static int test_s_mp_mul_toom42(void)
+{
+   return s_test_mul_unbalanced(s_mp_mul_toom42, 2, 1);
+}
+
+static int test_s_mp_mul_toom53(void)
+{
+   return s_test_mul_unbalanced(s_mp_mul_toom53, 5, 3);
+}
+
+static int test_s_mp_mul_fft(void)
+{
+   mp_int a, b, c, d;
+   int size, i;
+
+   DOR(mp_init_multi(&a, &b, &c, &d, NULL));
+   for (size = 1; size < 1000; size += 1 + (size / 4)) {
+      for (i = 1; i <= 3; i++) {
+         DO(mp_rand(&a, size));
+         DO(mp_rand(&b, (size * i) + (rand_int() & 7)));
+         DO(s_mp_mul_fft(&a, &b, &c));
+         DO(s_mp_mul_full(&a, &b, &d));
+         EXPECT(mp_cmp_mag(&c, &d) == MP_EQ);
+      }
+      /* worst case: all coefficients at their maximum */
+      DO(s_fill_with_ones(&a, size));
+      DO(s_fill_with_ones(&b, size + 3));
+      DO(s_mp_mul_fft(&a, &b, &c));
+      DO(s_mp_mul_full(&a, &b, &d));
+      EXPECT(mp_cmp_mag(&c, &d) == MP_EQ);
+   }
+
+   mp_clear_multi(&a, &b, &c, &d, NULL);
+   return EXIT_SUCCESS;
+LBL_ERR:
+   mp_clear_multi(&a, &b, &c, &d, NULL);
+   return EXIT_FAILURE;
+}
+
+static int test_s_mp_sqr_fft(void)
+{
+   mp_int a, b, c;
+   int size;
+
+   DOR(mp_init_multi(&a, &b, &c, NULL));
+   for (size = 1; size < 1000; size += 1 + (size / 4)) {
+      DO(mp_rand(&a, size));
+      DO(s_mp_sqr_fft(&a, &b));
+      DO(s_mp_sqr(&a, &c));
+      EXPECT(mp_cmp(&b, &c) == MP_EQ);
+      DO(s_fill_with_ones(&a, size));
+      DO(s_mp_sqr_fft(&a, &b));
+      DO(s_mp_sqr(&a, &c));
+      EXPECT(mp_cmp(&b, &c) == MP_EQ);
+   }
+
+   mp_clear_multi(&a, &b, &c, NULL);
+   return EXIT_SUCCESS;
+LBL_ERR:
+   mp_clear_multi(&a, &b, &c, NULL);
+   return EXIT_FAILURE;
+}
+
+
+static int test_mp_radix_size(void)
+{
+   mp_int a;
+   int radix;
+   size_t size;
+/* *INDENT-OFF* */
+   size_t results[65] = {
+       0, 0, 1627, 1027, 814, 702, 630, 581, 543,
+       514, 491, 471, 455, 441, 428, 418, 408, 399,
+       391, 384, 378, 372, 366, 361, 356, 352, 347,
+       343, 340, 336, 333, 330, 327, 324, 321, 318,
+       316, 314, 311, 309, 307, 305, 303, 301, 299,
+       298, 296, 294, 293, 291, 290, 288, 287, 285,
+       284, 283, 281, 280, 279, 278, 277, 276, 275,
+       273, 272
+   };
+/* *INDENT-ON* */
+
+   DOR(mp_init(&a));
+
+   /* number to result in a different size for every base: 67^(4 * 67) */
+   mp_set(&a, 67);
+   DO(mp_expt_n(&a, 268, &a));
+
+   for (radix = 2; radix < 65; radix++) {
+      DO(mp_radix_size(&a, radix, &size));
+      EXPECT(size == results[radix]);
+      a.sign = MP_NEG;
+      DO(mp_radix_size(&a, radix, &size));
+      EXPECT(size == (results[radix] + 1));
+      a.sign = MP_ZPOS;
+   }
+
+   mp_clear(&a);
+   return EXIT_SUCCESS;
+LBL_ERR:
+   mp_clear(&a);
+   return EXIT_FAILURE;
+}
+
+#define PRINTERR_V(...)
+
+/* Some larger values to test the fast division algorithm */
+static int test_s_mp_div_recursive(void)
+{
+   mp_int a, b, c_q, c_r, d_q, d_r;
+   int size;
+
+   DOR(mp_init_multi(&a, &b, &c_q, &c_r, &d_q, &d_r, NULL));
+
+   for (size = MP_MUL_KARATSUBA_CUTOFF; size < (3 * MP_MUL_KARATSUBA_CUTOFF); size += 10) {
+      printf("\rsizes = %d / %d", 10 * size, size);
+      /* Relation 10:1 */
+      DO(mp_rand(&a, 10 * size));
+      DO(mp_rand(&b, size));
+      DO(s_mp_div_recursive(&a, &b, &c_q, &c_r));
+      DO(s_mp_div_school(&a, &b, &d_q, &d_r));
+      EXPECT(mp_cmp(&c_q, &d_q) == MP_EQ);
+      EXPECT(mp_cmp(&c_r, &d_r) == MP_EQ);
+      printf("\rsizes = %d / %d", 2 * size, size);
+
+      /* Relation 10:1 negative numerator*/
+      DO(mp_rand(&a, 10 * size));
+      DO(mp_neg(&a, &a));
+      DO(mp_rand(&b, size));
+      DO(s_mp_div_recursive(&a, &b, &c_q, &c_r));
+      DO(s_mp_div_school(&a, &b, &d_q, &d_r));
+      EXPECT(mp_cmp(&c_q, &d_q) == MP_EQ);
+      EXPECT(mp_cmp(&c_r, &d_r) == MP_EQ);
+      printf("\rsizes = %d / %d, negative numerator", 2 * size, size);
+
+      /* Relation 10:1 negative denominator*/
+      DO(mp_rand(&a, 10 * size));
+      DO(mp_rand(&b, size));
+      DO(mp_neg(&b, &b));
+      DO(s_mp_div_recursive(&a, &b, &c_q, &c_r));
+      DO(s_mp_div_school(&a, &b, &d_q, &d_r));
+      EXPECT(mp_cmp(&c_q, &d_q) == MP_EQ);
+      EXPECT(mp_cmp(&c_r, &d_r) == MP_EQ);
+      printf("\rsizes = %d / %d, negative denominator", 2 * size, size);
+
+      /* Relation 2:1 */
+      DO(mp_rand(&a, 2 * size));
       DO(mp_rand(&b, size));
       DO(s_mp_div_recursive(&a, &b, &c_q, &c_r));
       DO(s_mp_div_school(&a, &b, &d_q, &d_r));
@@ -2249,6 +3856,66 @@ LBL_ERR:
    return EXIT_FAILURE;
 }
 
+/* The reciprocal is computed with Newton steps above the Karatsuba cut-off */
+static int test_s_mp_div_newton(void)
+{
+   mp_int a, b, c_q, c_r, d_q, d_r;
+   int i, j;
+   const int sizes[][2] = {
+      { 90, 90 }, { 400, 100 }, { 300, 200 }, { 401, 200 }, { 900, 600 }, { 600, 550 }, { 2100, 250 }, { 1500, 1100 }
+   };
+
+   DOR(mp_init_multi(&a, &b, &c_q, &c_r, &d_q, &d_r, NULL));
+
+   for (i = 0; i < (int)(sizeof(sizes)/sizeof(sizes[0])); i++) {
+      for (j = 0; j < 6; j++) {
+         printf("\rsizes = %d / %d, case %d", sizes[i][0], sizes[i][1], j);
+         DO(mp_rand(&a, sizes[i][0]));
+         DO(mp_rand(&b, sizes[i][1]));
+         if (mp_cmp_mag(&a, &b) == MP_LT) {
+            /* mp_div() handles that itself */
+            mp_exch(&a, &b);
+         }
+         switch (j) {
+         case 1:
+            /* top bit of the divisor set, nothing to normalize */
+            DO(s_fill_with_ones(&a, sizes[i][0]));
+            DO(s_fill_with_ones(&b, sizes[i][1]));
+            break;
+         case 2:
+            /* a small top digit and an exact quotient */
+            DO(mp_2expt(&b, (sizes[i][1] - 1) * MP_DIGIT_BIT));
+            DO(mp_add_d(&b, 1u, &b));
+            DO(mp_mul(&a, &b, &a));
+            break;
+         case 3:
+            /* remainder b - 1 */
+            DO(mp_mul(&a, &b, &a));
+            DO(mp_decr(&a));
+            break;
+         case 4:
+            DO(mp_neg(&a, &a));
+            break;
+         case 5:
+            DO(mp_neg(&b, &b));
+            break;
+         default:
+            break;
+         }
+         DO(s_mp_div_newton(&a, &b, &c_q, &c_r));
+         DO(s_mp_div_school(&a, &b, &d_q, &d_r));
+         EXPECT(mp_cmp(&c_q, &d_q) == MP_EQ);
+         EXPECT(mp_cmp(&c_r, &d_r) == MP_EQ);
+      }
+   }
+
+   mp_clear_multi(&a, &b, &c_q, &c_r, &d_q, &d_r, NULL);
+   return EXIT_SUCCESS;
+LBL_ERR:
+   mp_clear_multi(&a, &b, &c_q, &c_r, &d_q, &d_r, NULL);
+   return EXIT_FAILURE;
+}
+
 static int test_s_mp_div_small(void)
 {
    mp_int a, b, c_q, c_r, d_q, d_r;
@@ -2471,11 +4138,17 @@ static int unit_tests(int argc, char **argv)
       T2(mp_get_set_i32, MP_GET_I32, MP_GET_MAG_U32),
       T2(mp_get_set_i64, MP_GET_I64, MP_GET_MAG_U64),
       T1(mp_and, MP_AND),
+      T1(mp_barrett_ctx, MP_BARRETT_EXPTMOD),
       T1(mp_cnt_lsb, MP_CNT_LSB),
       T1(mp_complement, MP_COMPLEMENT),
       T1(mp_decr, MP_SUB_D),
       T2(s_mp_div_3, ONLY_PUBLIC_API, S_MP_DIV_3),
+      T1(mp_div_ctx, MP_DIV_CTX_DIVMOD),
+      T1(mp_div_d, MP_DIV_D),
+      T2(mp_divexact, MP_DIVEXACT, MP_DIVEXACT_D),
       T1(mp_dr_reduce, MP_DR_REDUCE),
+      T1(mp_exptmod_multi, MP_EXPTMOD_MULTI),
+      T1(mp_exptmod_batch, MP_EXPTMOD_BATCH),
       T2(mp_pack_unpack,MP_PACK, MP_UNPACK),
       T2(mp_fread_fwrite, MP_FREAD, MP_FWRITE),
       T1(mp_get_u32, MP_GET_I32),
@@ -2488,6 +4161,10 @@ static int unit_tests(int argc, char **argv)
       T1(mp_is_square, MP_IS_SQUARE),
       T1(mp_kronecker, MP_KRONECKER),
       T1(mp_montgomery_reduce, MP_MONTGOMERY_REDUCE),
+      T3(s_mp_montgomery_reduce_mul, ONLY_PUBLIC_API, S_MP_MONTGOMERY_REDUCE_MUL, S_MP_MONTGOMERY_REDUCE_COMBA),
+      T1(mp_mont_ctx, MP_MONT_EXPTMOD),
+      T1(mp_fixed_base_ctx, MP_FIXED_BASE_EXPTMOD),
+      T1(mp_crt_ctx, MP_CRT_EXPTMOD),
       T1(mp_root_n, MP_ROOT_N),
       T1(mp_or, MP_OR),
       T1(mp_prime_is_prime, MP_PRIME_IS_PRIME),
@@ -2499,6 +4176,7 @@ static int unit_tests(int argc, char **argv)
       T1(mp_read_write_sbin, MP_TO_SBIN),
       T1(mp_reduce_2k, MP_REDUCE_2K),
       T1(mp_reduce_2k_l, MP_REDUCE_2K_L),
+      T3(s_mp_solinas_mulmod, ONLY_PUBLIC_API, S_MP_SOLINAS_MULMOD, S_MP_EXPTMOD_SOLINAS),
       T1(mp_radix_size, MP_RADIX_SIZE),
       T2(s_mp_radix_size_overestimate, ONLY_PUBLIC_API, S_MP_RADIX_SIZE_OVERESTIMATE),
 #if defined(MP_HAS_SET_DOUBLE)
@@ -2508,16 +4186,32 @@ static int unit_tests(int argc, char **argv)
       T2(mp_sqrt, MP_SQRT, MP_ROOT_N),
       T1(mp_sqrtmod_prime, MP_SQRTMOD_PRIME),
       T1(mp_xor, MP_XOR),
+      T3(s_mp_div_newton, ONLY_PUBLIC_API, S_MP_DIV_NEWTON, S_MP_DIV_SCHOOL),
       T3(s_mp_div_recursive, ONLY_PUBLIC_API, S_MP_DIV_RECURSIVE, S_MP_DIV_SCHOOL),
       T3(s_mp_div_small, ONLY_PUBLIC_API, S_MP_DIV_SMALL, S_MP_DIV_SCHOOL),
+      T2(s_mp_mod_d_multi, ONLY_PUBLIC_API, S_MP_MOD_D_MULTI),
       T2(s_mp_sqr, ONLY_PUBLIC_API, S_MP_SQR),
-      /* s_mp_mul_comba not (yet) testable because s_mp_mul branches to s_mp_mul_comba automatically */
+      T3(s_mp_mul_comba, ONLY_PUBLIC_API, S_MP_MUL_COMBA, S_MP_MONTGOMERY_REDUCE_COMBA),
       T2(s_mp_sqr_comba, ONLY_PUBLIC_API, S_MP_SQR_COMBA),
+      T2(s_mp_mul_adx, ONLY_PUBLIC_API, S_MP_MUL_ADX),
+      T3(s_mp_exptmod_ifma, ONLY_PUBLIC_API, S_MP_EXPTMOD_IFMA, S_MP_EXPTMOD),
+      T3(s_mp_exptmod_lazy, ONLY_PUBLIC_API, S_MP_EXPTMOD_LAZY, S_MP_EXPTMOD),
+      T3(s_mp_exptmod_fast, ONLY_PUBLIC_API, S_MP_EXPTMOD_FAST, S_MP_EXPTMOD),
       T2(s_mp_mul_balance, ONLY_PUBLIC_API, S_MP_MUL_BALANCE),
       T2(s_mp_mul_karatsuba, ONLY_PUBLIC_API, S_MP_MUL_KARATSUBA),
       T2(s_mp_sqr_karatsuba, ONLY_PUBLIC_API, S_MP_SQR_KARATSUBA),
       T2(s_mp_mul_toom, ONLY_PUBLIC_API, S_MP_MUL_TOOM),
-      T2(s_mp_sqr_toom, ONLY_PUBLIC_API, S_MP_SQR_TOOM)
+      T2(s_mp_sqr_toom, ONLY_PUBLIC_API, S_MP_SQR_TOOM),
+      T3(s_mp_mul_scratch, ONLY_PUBLIC_API, S_MP_MUL_KARATSUBA, S_MP_MUL_TOOM),
+      T2(mp_mul_low_high, MP_MUL_LOW, MP_MUL_HIGH),
+      T3(mp_mul_threads, ONLY_PUBLIC_API, S_MP_MUL_KARATSUBA, S_MP_MUL_TOOM),
+      T2(s_mp_mul_toom4, ONLY_PUBLIC_API, S_MP_MUL_TOOM4),
+      T2(s_mp_sqr_toom4, ONLY_PUBLIC_API, S_MP_SQR_TOOM4),
+      T2(s_mp_mul_toom32, ONLY_PUBLIC_API, S_MP_MUL_TOOM32),
+      T2(s_mp_mul_toom42, ONLY_PUBLIC_API, S_MP_MUL_TOOM42),
+      T2(s_mp_mul_toom53, ONLY_PUBLIC_API, S_MP_MUL_TOOM53),
+      T2(s_mp_mul_fft, ONLY_PUBLIC_API, S_MP_MUL_FFT),
+      T2(s_mp_sqr_fft, ONLY_PUBLIC_API, S_MP_SQR_FFT)
 #undef T3
 #undef T2
 #undef T1
@@ -11,10 +11,11 @@
 #include "../demo/s_mp_rand_jenkins.c"
 
 /*
-   Please take in mind that both multiplicands are of the same size. The balancing
-   mechanism in mp_balance works well but has some overhead itself. You can test
-   the behaviour of it with the option "-o" followed by a (small) positive number 'x'
-   to generate ratios of the form 1:x.
+   Please take in mind that both multiplicands are of the same size. Unbalanced
+   operands are handled by the unbalanced Toom-Cook variants and s_mp_mul_balance,
+   chosen by the ratio of the sizes. You can test the behaviour of it with the
+   option "-o" followed by a (small) positive number 'x' to generate ratios of the
+   form 1:x.
 */
 
 static uint64_t s_timer_function(void);
@@ -238,11 +239,15 @@ static void s_usage(char *s)
    fprintf(stderr,"             (Not for computing the cut-offs!)\n");
    fprintf(stderr,"          -s 'preset' use values in 'preset' for printing.\n");
    fprintf(stderr,"             'preset' is a comma separated string with cut-offs for\n");
-   fprintf(stderr,"             ksm, kss, tc3m, tc3s in that order\n");
+   fprintf(stderr,"             ksm, kss, tc3m, tc3s, tc4m, tc4s, fftm, ffts in that order\n");
    fprintf(stderr,"             ksm  = karatsuba multiplication\n");
    fprintf(stderr,"             kss  = karatsuba squaring\n");
    fprintf(stderr,"             tc3m = Toom-Cook 3-way multiplication\n");
    fprintf(stderr,"             tc3s = Toom-Cook 3-way squaring\n");
+   fprintf(stderr,"             tc4m = Toom-Cook 4-way multiplication\n");
+   fprintf(stderr,"             tc4s = Toom-Cook 4-way squaring\n");
+   fprintf(stderr,"             fftm = NTT multiplication\n");
+   fprintf(stderr,"             ffts = NTT squaring\n");
    fprintf(stderr,"             Implies '-p'\n");
    fprintf(stderr,"          -h this message\n");
    exit(s_exit_code);
@@ -251,10 +256,12 @@ static void s_usage(char *s)
 struct cutoffs {
    int MUL_KARATSUBA, SQR_KARATSUBA;
    int MUL_TOOM, SQR_TOOM;
+   int MUL_TOOM4, SQR_TOOM4;
+   int MUL_FFT, SQR_FFT;
 };
 
 const struct cutoffs max_cutoffs =
-{ INT_MAX, INT_MAX, INT_MAX, INT_MAX };
+{ INT_MAX, INT_MAX, INT_MAX, INT_MAX, INT_MAX, INT_MAX, INT_MAX, INT_MAX };
 
 static void set_cutoffs(const struct cutoffs *c)
 {
@@ -262,6 +269,10 @@ static void set_cutoffs(const struct cutoffs *c)
    MP_SQR_KARATSUBA_CUTOFF = c->SQR_KARATSUBA;
    MP_MUL_TOOM_CUTOFF = c->MUL_TOOM;
    MP_SQR_TOOM_CUTOFF = c->SQR_TOOM;
+   MP_MUL_TOOM4_CUTOFF = c->MUL_TOOM4;
+   MP_SQR_TOOM4_CUTOFF = c->SQR_TOOM4;
+   MP_MUL_FFT_CUTOFF = c->MUL_FFT;
+   MP_SQR_FFT_CUTOFF = c->SQR_FFT;
 }
 
 static void get_cutoffs(struct cutoffs *c)
@@ -270,6 +281,10 @@ static void get_cutoffs(struct cutoffs *c)
    c->SQR_KARATSUBA  = MP_SQR_KARATSUBA_CUTOFF;
    c->MUL_TOOM = MP_MUL_TOOM_CUTOFF;
    c->SQR_TOOM = MP_SQR_TOOM_CUTOFF;
+   c->MUL_TOOM4 = MP_MUL_TOOM4_CUTOFF;
+   c->SQR_TOOM4 = MP_SQR_TOOM4_CUTOFF;
+   c->MUL_FFT = MP_MUL_FFT_CUTOFF;
+   c->SQR_FFT = MP_SQR_FFT_CUTOFF;
 
 }
 
@@ -416,13 +431,21 @@ int main(int argc, char **argv)
                s_usage(argv[0]);
             }
             str = argv[opt];
-            MP_MUL_KARATSUBA_CUTOFF = (int)s_strtol(str, &endptr, "[1/4] No value for MP_MUL_KARATSUBA_CUTOFF given");
+            MP_MUL_KARATSUBA_CUTOFF = (int)s_strtol(str, &endptr, "[1/8] No value for MP_MUL_KARATSUBA_CUTOFF given");
             str = endptr + 1;
-            MP_SQR_KARATSUBA_CUTOFF = (int)s_strtol(str, &endptr, "[2/4] No value for MP_SQR_KARATSUBA_CUTOFF given");
+            MP_SQR_KARATSUBA_CUTOFF = (int)s_strtol(str, &endptr, "[2/8] No value for MP_SQR_KARATSUBA_CUTOFF given");
             str = endptr + 1;
-            MP_MUL_TOOM_CUTOFF = (int)s_strtol(str, &endptr, "[3/4] No value for MP_MUL_TOOM_CUTOFF given");
+            MP_MUL_TOOM_CUTOFF = (int)s_strtol(str, &endptr, "[3/8] No value for MP_MUL_TOOM_CUTOFF given");
             str = endptr + 1;
-            MP_SQR_TOOM_CUTOFF = (int)s_strtol(str, &endptr, "[4/4] No value for MP_SQR_TOOM_CUTOFF given");
+            MP_SQR_TOOM_CUTOFF = (int)s_strtol(str, &endptr, "[4/8] No value for MP_SQR_TOOM_CUTOFF given");
+            str = endptr + 1;
+            MP_MUL_TOOM4_CUTOFF = (int)s_strtol(str, &endptr, "[5/8] No value for MP_MUL_TOOM4_CUTOFF given");
+            str = endptr + 1;
+            MP_SQR_TOOM4_CUTOFF = (int)s_strtol(str, &endptr, "[6/8] No value for MP_SQR_TOOM4_CUTOFF given");
+            str = endptr + 1;
+            MP_MUL_FFT_CUTOFF = (int)s_strtol(str, &endptr, "[7/8] No value for MP_MUL_FFT_CUTOFF given");
+            str = endptr + 1;
+            MP_SQR_FFT_CUTOFF = (int)s_strtol(str, &endptr, "[8/8] No value for MP_SQR_FFT_CUTOFF given");
             break;
          case 'h':
             s_exit_code = EXIT_SUCCESS;
@@ -449,24 +472,36 @@ int main(int argc, char **argv)
          const char *name;
          int *cutoff, *update;
          uint64_t (*fn)(int size);
+         int tiered;
       } test[] = {
-#define T_MUL_SQR(n, o, f)  { #n, &MP_##o##_CUTOFF, &(updated.o), MP_HAS(S_MP_##o) ? f : NULL }
+#define T_MUL_SQR(n, o, f, t)  { #n, &MP_##o##_CUTOFF, &(updated.o), MP_HAS(S_MP_##o) ? f : NULL, t }
          /*
             The influence of the Comba multiplication cannot be
             eradicated programmatically. It depends on the size
             of the macro MP_WPARRAY in tommath.h which needs to
             be changed manually (to 0 (zero)).
           */
-         T_MUL_SQR("Karatsuba multiplication", MUL_KARATSUBA, s_time_mul),
-         T_MUL_SQR("Karatsuba squaring", SQR_KARATSUBA, s_time_sqr),
-         T_MUL_SQR("Toom-Cook 3-way multiplying", MUL_TOOM, s_time_mul),
-         T_MUL_SQR("Toom-Cook 3-way squaring", SQR_TOOM, s_time_sqr),
+         T_MUL_SQR("Karatsuba multiplication", MUL_KARATSUBA, s_time_mul, 0),
+         T_MUL_SQR("Karatsuba squaring", SQR_KARATSUBA, s_time_sqr, 0),
+         T_MUL_SQR("Toom-Cook 3-way multiplying", MUL_TOOM, s_time_mul, 0),
+         T_MUL_SQR("Toom-Cook 3-way squaring", SQR_TOOM, s_time_sqr, 0),
+         /*
+            The higher tiers have to beat the cut-offs found so far,
+            not Comba, so these are timed with the lower tiers enabled.
+          */
+         T_MUL_SQR("Toom-Cook 4-way multiplying", MUL_TOOM4, s_time_mul, 1),
+         T_MUL_SQR("Toom-Cook 4-way squaring", SQR_TOOM4, s_time_sqr, 1),
+         T_MUL_SQR("NTT multiplying", MUL_FFT, s_time_mul, 1),
+         T_MUL_SQR("NTT squaring", SQR_FFT, s_time_sqr, 1),
 #undef T_MUL_SQR
       };
       /* Turn all limits from bncore.c to the max */
       set_cutoffs(&max_cutoffs);
       for (n = 0; n < sizeof(test)/sizeof(test[0]); ++n) {
          if (test[n].fn != NULL) {
+            if (test[n].tiered == 1) {
+               set_cutoffs(&updated);
+            }
             s_run(test[n].name, test[n].fn, test[n].cutoff);
             *test[n].update = *test[n].cutoff;
             *test[n].cutoff = INT_MAX;
@@ -474,16 +509,24 @@ int main(int argc, char **argv)
       }
    }
    if (args.terse == 1) {
-      printf("%d %d %d %d\n",
+      printf("%d %d %d %d %d %d %d %d\n",
              updated.MUL_KARATSUBA,
              updated.SQR_KARATSUBA,
              updated.MUL_TOOM,
-             updated.SQR_TOOM);
+             updated.SQR_TOOM,
+             updated.MUL_TOOM4,
+             updated.SQR_TOOM4,
+             updated.MUL_FFT,
+             updated.SQR_FFT);
    } else {
       printf("MUL_KARATSUBA_CUTOFF = %d\n", updated.MUL_KARATSUBA);
       printf("SQR_KARATSUBA_CUTOFF = %d\n", updated.SQR_KARATSUBA);
       printf("MUL_TOOM_CUTOFF = %d\n", updated.MUL_TOOM);
       printf("SQR_TOOM_CUTOFF = %d\n", updated.SQR_TOOM);
+      printf("MUL_TOOM4_CUTOFF = %d\n", updated.MUL_TOOM4);
+      printf("SQR_TOOM4_CUTOFF = %d\n", updated.SQR_TOOM4);
+      printf("MUL_FFT_CUTOFF = %d\n", updated.MUL_FFT);
+      printf("SQR_FFT_CUTOFF = %d\n", updated.SQR_FFT);
    }
 
    if (args.print == 1) {
@@ -527,16 +570,24 @@ int main(int argc, char **argv)
       if (args.verbose == 1) {
          set_cutoffs(&orig);
          if (args.terse == 1) {
-            printf("%d %d %d %d\n",
+            printf("%d %d %d %d %d %d %d %d\n",
                    MP_MUL_KARATSUBA_CUTOFF,
                    MP_SQR_KARATSUBA_CUTOFF,
                    MP_MUL_TOOM_CUTOFF,
-                   MP_SQR_TOOM_CUTOFF);
+                   MP_SQR_TOOM_CUTOFF,
+                   MP_MUL_TOOM4_CUTOFF,
+                   MP_SQR_TOOM4_CUTOFF,
+                   MP_MUL_FFT_CUTOFF,
+                   MP_SQR_FFT_CUTOFF);
          } else {
             printf("MUL_KARATSUBA_CUTOFF = %d\n", MP_MUL_KARATSUBA_CUTOFF);
             printf("SQR_KARATSUBA_CUTOFF = %d\n", MP_SQR_KARATSUBA_CUTOFF);
             printf("MUL_TOOM_CUTOFF = %d\n", MP_MUL_TOOM_CUTOFF);
             printf("SQR_TOOM_CUTOFF = %d\n", MP_SQR_TOOM_CUTOFF);
+            printf("MUL_TOOM4_CUTOFF = %d\n", MP_MUL_TOOM4_CUTOFF);
+            printf("SQR_TOOM4_CUTOFF = %d\n", MP_SQR_TOOM4_CUTOFF);
+            printf("MUL_FFT_CUTOFF = %d\n", MP_MUL_FFT_CUTOFF);
+            printf("SQR_FFT_CUTOFF = %d\n", MP_SQR_FFT_CUTOFF);
          }
       }
    }
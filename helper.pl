@@ -476,6 +476,13 @@ EXPORTS
     MP_SQR_KARATSUBA_CUTOFF
     MP_MUL_TOOM_CUTOFF
     MP_SQR_TOOM_CUTOFF
+    MP_MUL_TOOM4_CUTOFF
+    MP_SQR_TOOM4_CUTOFF
+    MP_MUL_FFT_CUTOFF
+    MP_SQR_FFT_CUTOFF
+    MP_MUL_PARALLEL_CUTOFF
+    MP_DIV_NEWTON_CUTOFF
+    MP_REDUCE_MUL_CUTOFF
 ";
     return 0;
 }
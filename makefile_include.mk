@@ -67,6 +67,12 @@ else
 LTM_CFLAGS += -Wsystem-headers
 endif
 
+ifdef COMPILE_PTHREADS
+#worker threads for huge multiplications, see mp_mul_threads()
+LTM_CFLAGS += -DMP_USE_PTHREADS -pthread
+LTM_LDFLAGS += -pthread
+endif
+
 ifdef COMPILE_DEBUG
 #debug
 LTM_CFLAGS += -g3
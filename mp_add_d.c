@@ -13,7 +13,7 @@ mp_err mp_add_d(const mp_int *a, mp_digit b, mp_int *c)
    if (a == c) {
       if (!mp_isneg(c) &&
           !mp_iszero(c) &&
-          ((c->dp[0] + b) < MP_DIGIT_MAX)) {
+          (((mp_word)c->dp[0] + (mp_word)b) < (mp_word)MP_DIGIT_MAX)) {
          c->dp[0] += b;
          return MP_OKAY;
       }
@@ -56,9 +56,9 @@ mp_err mp_add_d(const mp_int *a, mp_digit b, mp_int *c)
       int i;
       mp_digit mu = b;
       for (i = 0; i < a->used; i++) {
-         c->dp[i] = a->dp[i] + mu;
-         mu = c->dp[i] >> MP_DIGIT_BIT;
-         c->dp[i] &= MP_MASK;
+         mp_word t = (mp_word)a->dp[i] + (mp_word)mu;
+         mu = (mp_digit)(t >> (mp_word)MP_DIGIT_BIT);
+         c->dp[i] = (mp_digit)(t & (mp_word)MP_MASK);
       }
       /* set final carry */
       c->dp[i] = mu;
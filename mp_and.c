@@ -8,7 +8,7 @@ mp_err mp_and(const mp_int *a, const mp_int *b, mp_int *c)
 {
    int used = MP_MAX(a->used, b->used) + 1, i;
    mp_err err;
-   mp_digit ac = 1, bc = 1, cc = 1;
+   mp_word ac = 1, bc = 1, cc = 1;
    bool neg = (mp_isneg(a) && mp_isneg(b));
 
    if ((err = mp_grow(c, used)) != MP_OKAY) {
@@ -21,7 +21,7 @@ mp_err mp_and(const mp_int *a, const mp_int *b, mp_int *c)
       /* convert to two complement if negative */
       if (mp_isneg(a)) {
          ac += (i >= a->used) ? MP_MASK : (~a->dp[i] & MP_MASK);
-         x = ac & MP_MASK;
+         x = (mp_digit)(ac & MP_MASK);
          ac >>= MP_DIGIT_BIT;
       } else {
          x = (i >= a->used) ? 0uL : a->dp[i];
@@ -30,7 +30,7 @@ mp_err mp_and(const mp_int *a, const mp_int *b, mp_int *c)
       /* convert to two complement if negative */
       if (mp_isneg(b)) {
          bc += (i >= b->used) ? MP_MASK : (~b->dp[i] & MP_MASK);
-         y = bc & MP_MASK;
+         y = (mp_digit)(bc & MP_MASK);
          bc >>= MP_DIGIT_BIT;
       } else {
          y = (i >= b->used) ? 0uL : b->dp[i];
@@ -41,7 +41,7 @@ mp_err mp_and(const mp_int *a, const mp_int *b, mp_int *c)
       /* convert to to sign-magnitude if negative */
       if (neg) {
          cc += ~c->dp[i] & MP_MASK;
-         c->dp[i] = cc & MP_MASK;
+         c->dp[i] = (mp_digit)(cc & MP_MASK);
          cc >>= MP_DIGIT_BIT;
       }
    }
@@ -0,0 +1,33 @@
+#include "tommath_private.h"
+#ifdef MP_BARRETT_CTX_INIT_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+
+/* prepares ctx for the Barrett reduction modulo m > 0
+ *
+ * mu = floor(B**(2k) / m) for the k digits of m, the one division all
+ * reductions modulo m share.  Unlike the Montgomery arithmetic this works
+ * for even moduli, too.
+ */
+mp_err mp_barrett_ctx_init(mp_barrett_ctx *ctx, const mp_int *m)
+{
+   mp_err err;
+
+   if (mp_isneg(m) || mp_iszero(m)) {
+      return MP_VAL;
+   }
+
+   if ((err = mp_init_multi(&ctx->m, &ctx->mu, NULL)) != MP_OKAY) {
+      return err;
+   }
+
+   if ((err = mp_copy(m, &ctx->m)) != MP_OKAY)                            goto LBL_ERR;
+   if ((err = mp_reduce_setup(&ctx->mu, m)) != MP_OKAY)                   goto LBL_ERR;
+
+   return MP_OKAY;
+
+LBL_ERR:
+   mp_clear_multi(&ctx->m, &ctx->mu, NULL);
+   return err;
+}
+#endif
@@ -0,0 +1,88 @@
+#include "tommath_private.h"
+#ifdef MP_BARRETT_EXPTMOD_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+
+/* Y = G**X mod m for X >= 0 with the modulus m of ctx
+ *
+ * Sliding window of s_mp_exptmod_window() like mp_mont_exptmod(), for any
+ * modulus.  Nothing about m is computed again.
+ */
+
+#ifdef MP_LOW_MEM
+#   define MAX_WINSIZE 5
+#else
+#   define MAX_WINSIZE 8
+#endif
+
+static mp_err s_mul(const void *ctx, const void *a, const void *b, void *c)
+{
+   return mp_barrett_mulmod((const mp_barrett_ctx *)ctx, (const mp_int *)a, (const mp_int *)b, (mp_int *)c);
+}
+
+static mp_err s_sqr(const void *ctx, const void *a, void *c)
+{
+   return mp_barrett_mulmod((const mp_barrett_ctx *)ctx, (const mp_int *)a, (const mp_int *)a, (mp_int *)c);
+}
+
+static mp_err s_copy(const void *ctx, const void *a, void *c)
+{
+   (void)ctx;
+   return mp_copy((const mp_int *)a, (mp_int *)c);
+}
+
+mp_err mp_barrett_exptmod(const mp_barrett_ctx *ctx, const mp_int *G, const mp_int *X, mp_int *Y)
+{
+   mp_int    M[1 << (MAX_WINSIZE - 1)], res, one;
+   mp_window w;
+   mp_err    err;
+   int       winsize, x;
+
+   if (mp_isneg(X)) {
+      return MP_VAL;
+   }
+
+   winsize = MP_MIN(MAX_WINSIZE, s_mp_exptmod_winsize(mp_count_bits(X)));
+
+   if ((err = mp_init_size(&res, (2 * ctx->m.used) + 1)) != MP_OKAY) {
+      return err;
+   }
+   if ((err = mp_init(&one)) != MP_OKAY) {
+      mp_clear(&res);
+      return err;
+   }
+   for (x = 0; x < (1 << (winsize - 1)); x++) {
+      if ((err = mp_init_size(&M[x], ctx->m.used)) != MP_OKAY) {
+         while (x-- > 0) {
+            mp_clear(&M[x]);
+         }
+         mp_clear_multi(&one, &res, NULL);
+         return err;
+      }
+   }
+
+   w.mul = s_mul;
+   w.sqr = s_sqr;
+   w.copy = s_copy;
+   w.ctx = ctx;
+   w.one = &one;
+   w.M = M;
+   w.res = &res;
+   w.size = sizeof(mp_int);
+
+   /* 1 mod m for X = 0 */
+   mp_set(&one, 1u);
+   if ((err = mp_barrett_reduce(ctx, &one, &one)) != MP_OKAY)             goto LBL_ERR;
+   if ((err = mp_barrett_reduce(ctx, G, &M[0])) != MP_OKAY)               goto LBL_ERR;
+   if ((err = s_mp_exptmod_window(&w, X, winsize)) != MP_OKAY)            goto LBL_ERR;
+   mp_exch(&res, Y);
+
+LBL_ERR:
+   for (x = 0; x < (1 << (winsize - 1)); x++) {
+      mp_clear(&M[x]);
+   }
+   mp_clear_multi(&one, &res, NULL);
+   return err;
+}
+#undef MAX_WINSIZE
+#endif
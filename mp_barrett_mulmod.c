@@ -0,0 +1,16 @@
+#include "tommath_private.h"
+#ifdef MP_BARRETT_MULMOD_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+
+/* c = a * b mod m with the m and mu of ctx, a squaring for a == b */
+mp_err mp_barrett_mulmod(const mp_barrett_ctx *ctx, const mp_int *a, const mp_int *b, mp_int *c)
+{
+   mp_err err;
+
+   if ((err = mp_mul(a, b, c)) != MP_OKAY) {
+      return err;
+   }
+   return mp_barrett_reduce(ctx, c, c);
+}
+#endif
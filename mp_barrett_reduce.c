@@ -0,0 +1,72 @@
+#include "tommath_private.h"
+#ifdef MP_BARRETT_REDUCE_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+
+/* c = a mod m with the m and mu of ctx, 0 <= c < m
+ *
+ * HAC pp.604 Algorithm 14.42 for |a| < B**(2k) like mp_reduce(), bigger
+ * ones are left to mp_mod().  The quotient estimate takes the upper digits
+ * of floor(|a| / B**(k-1)) * mu only, the short product leaves out the
+ * columns below k - 1.  That makes the estimate smaller by one at most,
+ * which costs a subtraction of m now and then.  From MP_REDUCE_MUL_CUTOFF
+ * digits on the upper digits are exact, mp_mul_high() chooses between
+ * Mulders' short product and the full one.  The product of the estimate
+ * and m is needed modulo B**(k+1) only, another short product.
+ */
+mp_err mp_barrett_reduce(const mp_barrett_ctx *ctx, const mp_int *a, mp_int *c)
+{
+   mp_int q;
+   mp_err err;
+   int    k = ctx->m.used;
+   bool   neg = mp_isneg(a);
+
+   if (a->used > (2 * k)) {
+      return mp_mod(a, &ctx->m, c);
+   }
+
+   if ((err = mp_init_size(&q, a->used)) != MP_OKAY) {
+      return err;
+   }
+
+   if (mp_cmp_mag(a, &ctx->m) == MP_LT) {
+      if ((err = mp_abs(a, c)) != MP_OKAY)                                goto LBL_ERR;
+   } else {
+      /* q = floor(floor(|a| / B**(k-1)) * mu / B**(k+1)) */
+      if ((err = mp_abs(a, &q)) != MP_OKAY)                               goto LBL_ERR;
+      mp_rshd(&q, k - 1);
+      if (MP_HAS(MP_MUL_HIGH) && (k >= MP_REDUCE_MUL_CUTOFF)) {
+         if ((err = mp_mul_high(&q, &ctx->mu, k + 1, &q)) != MP_OKAY)     goto LBL_ERR;
+      } else {
+         if (MP_HAS(S_MP_MUL_HIGH)) {
+            if ((err = s_mp_mul_high(&q, &ctx->mu, &q, k - 1)) != MP_OKAY) goto LBL_ERR;
+         } else {
+            if ((err = mp_mul(&q, &ctx->mu, &q)) != MP_OKAY)              goto LBL_ERR;
+         }
+         mp_rshd(&q, k + 1);
+      }
+
+      /* c = |a| - q * m mod B**(k+1) */
+      if ((err = mp_mul_low(&q, &ctx->m, k + 1, &q)) != MP_OKAY)          goto LBL_ERR;
+      if ((err = mp_abs(a, c)) != MP_OKAY)                                goto LBL_ERR;
+      if ((err = mp_mod_2d(c, MP_DIGIT_BIT * (k + 1), c)) != MP_OKAY)     goto LBL_ERR;
+      if ((err = mp_sub(c, &q, c)) != MP_OKAY)                            goto LBL_ERR;
+      if (mp_isneg(c)) {
+         if ((err = mp_2expt(&q, MP_DIGIT_BIT * (k + 1))) != MP_OKAY)     goto LBL_ERR;
+         if ((err = mp_add(c, &q, c)) != MP_OKAY)                         goto LBL_ERR;
+      }
+      while (mp_cmp_mag(c, &ctx->m) != MP_LT) {
+         if ((err = s_mp_sub(c, &ctx->m, c)) != MP_OKAY)                  goto LBL_ERR;
+      }
+   }
+
+   /* -|a| mod m = m - (|a| mod m) */
+   if (neg && !mp_iszero(c)) {
+      err = mp_sub(&ctx->m, c, c);
+   }
+
+LBL_ERR:
+   mp_clear(&q);
+   return err;
+}
+#endif
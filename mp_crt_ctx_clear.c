@@ -0,0 +1,12 @@
+#include "tommath_private.h"
+#ifdef MP_CRT_CTX_CLEAR_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+
+void mp_crt_ctx_clear(mp_crt_ctx *ctx)
+{
+   mp_clear_multi(&ctx->dp, &ctx->dq, &ctx->qinv, NULL);
+   mp_mont_ctx_clear(&ctx->q);
+   mp_mont_ctx_clear(&ctx->p);
+}
+#endif
@@ -0,0 +1,56 @@
+#include "tommath_private.h"
+#ifdef MP_CRT_CTX_INIT_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+
+/* prepares ctx for c**d mod p*q with the CRT components of an RSA key
+ *
+ * The odd primes p and q get their Montgomery contexts, qinv is checked
+ * against q and kept in the Montgomery domain of p, which makes the
+ * multiplication of Garner's formula a single mp_mont_mul().  threads asks
+ * for the two halves on two threads, which is only possible if the library
+ * was built with MP_USE_PTHREADS.
+ */
+mp_err mp_crt_ctx_init(mp_crt_ctx *ctx, const mp_int *dp, const mp_int *dq, const mp_int *p, const mp_int *q,
+                       const mp_int *qinv, bool threads)
+{
+   mp_err err;
+
+   if (mp_isneg(dp) || mp_isneg(dq)) {
+      return MP_VAL;
+   }
+#ifndef MP_USE_PTHREADS
+   if (threads) {
+      return MP_VAL;
+   }
+#endif
+   ctx->threads = threads;
+
+   if ((err = mp_mont_ctx_init(&ctx->p, p)) != MP_OKAY) {
+      return err;
+   }
+   if ((err = mp_mont_ctx_init(&ctx->q, q)) != MP_OKAY)                   goto LBL_P;
+   if ((err = mp_init_multi(&ctx->dp, &ctx->dq, &ctx->qinv, NULL)) != MP_OKAY) goto LBL_Q;
+
+   if ((err = mp_copy(dp, &ctx->dp)) != MP_OKAY)                          goto LBL_ERR;
+   if ((err = mp_copy(dq, &ctx->dq)) != MP_OKAY)                          goto LBL_ERR;
+
+   /* q * qinv = 1 mod p */
+   if ((err = mp_mulmod(q, qinv, p, &ctx->qinv)) != MP_OKAY)              goto LBL_ERR;
+   if (mp_cmp_d(&ctx->qinv, 1u) != MP_EQ) {
+      err = MP_VAL;
+      goto LBL_ERR;
+   }
+   if ((err = mp_mont_to(&ctx->p, qinv, &ctx->qinv)) != MP_OKAY)          goto LBL_ERR;
+
+   return MP_OKAY;
+
+LBL_ERR:
+   mp_clear_multi(&ctx->dp, &ctx->dq, &ctx->qinv, NULL);
+LBL_Q:
+   mp_mont_ctx_clear(&ctx->q);
+LBL_P:
+   mp_mont_ctx_clear(&ctx->p);
+   return err;
+}
+#endif
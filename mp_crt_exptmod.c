@@ -0,0 +1,83 @@
+#include "tommath_private.h"
+#ifdef MP_CRT_EXPTMOD_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+
+/* out = c**d mod p*q with the CRT key of ctx
+ *
+ * m1 = c**dp mod p and m2 = c**dq mod q are exponentiations with half the
+ * modulus and half the exponent, about an eighth of the work each.  Garner's
+ * formula puts them together: out = m2 + q * (qinv * (m1 - m2) mod p).
+ * With the threads of ctx m2 is computed on a second thread while the
+ * calling one computes m1, if the thread cannot be started it is computed
+ * after m1.
+ */
+
+#ifdef MP_USE_PTHREADS
+/* one half for the second thread */
+typedef struct {
+   const mp_mont_ctx *ctx;
+   const mp_int *G, *X;
+   mp_int *Y;
+   mp_err err;
+} s_half;
+
+static void *s_run(void *arg)
+{
+   s_half *h = (s_half *)arg;
+   h->err = mp_mont_exptmod(h->ctx, h->G, h->X, h->Y);
+   return NULL;
+}
+#endif
+
+mp_err mp_crt_exptmod(const mp_crt_ctx *ctx, const mp_int *c, mp_int *out)
+{
+   mp_int m1, m2;
+   mp_err err;
+   bool   half = false;
+#ifdef MP_USE_PTHREADS
+   pthread_t thread;
+   s_half h;
+#endif
+
+   if ((err = mp_init_multi(&m1, &m2, NULL)) != MP_OKAY) {
+      return err;
+   }
+
+#ifdef MP_USE_PTHREADS
+   if (ctx->threads) {
+      h.ctx = &ctx->q;
+      h.G = c;
+      h.X = &ctx->dq;
+      h.Y = &m2;
+      half = (pthread_create(&thread, NULL, s_run, &h) == 0);
+   }
+#endif
+
+   err = mp_mont_exptmod(&ctx->p, c, &ctx->dp, &m1);
+
+#ifdef MP_USE_PTHREADS
+   if (half) {
+      pthread_join(thread, NULL);
+      if (err == MP_OKAY) {
+         err = h.err;
+      }
+   }
+#endif
+   if (err != MP_OKAY)                                                    goto LBL_ERR;
+   if (!half) {
+      if ((err = mp_mont_exptmod(&ctx->q, c, &ctx->dq, &m2)) != MP_OKAY)  goto LBL_ERR;
+   }
+
+   /* m1 = qinv * (m1 - m2) mod p, m2 + q * m1 */
+   if ((err = mp_sub(&m1, &m2, &m1)) != MP_OKAY)                          goto LBL_ERR;
+   if ((err = mp_mod(&m1, &ctx->p.n, &m1)) != MP_OKAY)                    goto LBL_ERR;
+   if ((err = mp_mont_mul(&ctx->p, &m1, &ctx->qinv, &m1)) != MP_OKAY)     goto LBL_ERR;
+   if ((err = mp_mul(&m1, &ctx->q.n, &m1)) != MP_OKAY)                    goto LBL_ERR;
+   if ((err = mp_add(&m1, &m2, out)) != MP_OKAY)                          goto LBL_ERR;
+
+LBL_ERR:
+   mp_clear_multi(&m1, &m2, NULL);
+   return err;
+}
+#endif
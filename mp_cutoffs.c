@@ -8,7 +8,14 @@
 int MP_MUL_KARATSUBA_CUTOFF = MP_DEFAULT_MUL_KARATSUBA_CUTOFF,
     MP_SQR_KARATSUBA_CUTOFF = MP_DEFAULT_SQR_KARATSUBA_CUTOFF,
     MP_MUL_TOOM_CUTOFF = MP_DEFAULT_MUL_TOOM_CUTOFF,
-    MP_SQR_TOOM_CUTOFF = MP_DEFAULT_SQR_TOOM_CUTOFF;
+    MP_SQR_TOOM_CUTOFF = MP_DEFAULT_SQR_TOOM_CUTOFF,
+    MP_MUL_TOOM4_CUTOFF = MP_DEFAULT_MUL_TOOM4_CUTOFF,
+    MP_SQR_TOOM4_CUTOFF = MP_DEFAULT_SQR_TOOM4_CUTOFF,
+    MP_MUL_FFT_CUTOFF = MP_DEFAULT_MUL_FFT_CUTOFF,
+    MP_SQR_FFT_CUTOFF = MP_DEFAULT_SQR_FFT_CUTOFF,
+    MP_MUL_PARALLEL_CUTOFF = MP_DEFAULT_MUL_PARALLEL_CUTOFF,
+    MP_DIV_NEWTON_CUTOFF = MP_DEFAULT_DIV_NEWTON_CUTOFF,
+    MP_REDUCE_MUL_CUTOFF = MP_DEFAULT_REDUCE_MUL_CUTOFF;
 #endif
 
 #endif
@@ -6,6 +6,7 @@
 mp_err mp_div(const mp_int *a, const mp_int *b, mp_int *c, mp_int *d)
 {
    mp_err err;
+   bool balanced;
 
    /* is divisor zero ? */
    if (mp_iszero(b)) {
@@ -25,7 +26,21 @@ mp_err mp_div(const mp_int *a, const mp_int *b, mp_int *c, mp_int *d)
       return MP_OKAY;
    }
 
-   if (MP_HAS(S_MP_DIV_RECURSIVE)
+   /* A quotient of about the length of the divisor, as in the reduction of a
+    * product, is a single balanced step of the recursive division.  That is
+    * faster than the reciprocal from Toom-3 sizes on, only a few percent away
+    * from it the reciprocal wins again.
+    */
+   balanced = MP_HAS(S_MP_DIV_RECURSIVE)
+              && (b->used >= (2 * MP_MUL_TOOM_CUTOFF))
+              && ((a->used - b->used) >= (b->used - (b->used / 32)))
+              && ((a->used - b->used) <= (b->used + (b->used / 32)));
+
+   if (MP_HAS(S_MP_DIV_NEWTON)
+       && (b->used >= MP_DIV_NEWTON_CUTOFF)
+       && !balanced) {
+      err = s_mp_div_newton(a, b, c, d);
+   } else if (MP_HAS(S_MP_DIV_RECURSIVE)
        && (b->used > (2 * MP_MUL_KARATSUBA_CUTOFF))
        && (b->used <= ((a->used/3)*2))) {
       err = s_mp_div_recursive(a, b, c, d);
@@ -0,0 +1,10 @@
+#include "tommath_private.h"
+#ifdef MP_DIV_CTX_CLEAR_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+
+void mp_div_ctx_clear(mp_div_ctx *ctx)
+{
+   mp_clear_multi(&ctx->b, &ctx->x, NULL);
+}
+#endif
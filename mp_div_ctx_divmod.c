@@ -0,0 +1,116 @@
+#include "tommath_private.h"
+#ifdef MP_DIV_CTX_DIVMOD_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+
+/* x = x mod y, q = x / y for the normalized y with the reciprocal v of its
+ * upper two digits, see s_mp_div_3by2()
+ *
+ * This is the schoolbook division of HAC pp.598 Algorithm 14.20 but the
+ * digit of the quotient from the upper three digits of x and the upper two
+ * of y is exact, not an estimate to correct.  It is at most one too big
+ * for all of y, then y is added back once.
+ */
+static mp_err s_div_school(mp_int *x, const mp_int *y, mp_digit v, mp_int *q)
+{
+   int n = y->used, m = x->used - n, i, j;
+   mp_digit d1 = y->dp[n - 1], d0 = (n > 1) ? y->dp[n - 2] : 0u;
+   mp_err err;
+
+   if ((err = mp_grow(x, x->used + 1)) != MP_OKAY) {
+      return err;
+   }
+   if ((err = mp_grow(q, m + 1)) != MP_OKAY) {
+      return err;
+   }
+   x->dp[x->used] = 0u;
+
+   for (j = m; j >= 0; j--) {
+      mp_digit *xj = x->dp + j, qj, u, c;
+      mp_word t;
+
+      /* the upper two digits of x can't exceed those of y, if they are equal the
+       * digit is B - 1
+       */
+      if ((xj[n] == d1) && (xj[n - 1] == d0)) {
+         qj = MP_MASK;
+      } else {
+         qj = s_mp_div_3by2(xj[n], xj[n - 1], (n > 1) ? xj[n - 2] : 0u, d1, d0, v);
+      }
+
+      /* x = x - qj * y * B**j */
+      u = c = 0u;
+      for (i = 0; i < n; i++) {
+         t = ((mp_word)qj * (mp_word)y->dp[i]) + (mp_word)c;
+         c = (mp_digit)(t >> MP_DIGIT_BIT);
+         t = (mp_word)xj[i] - (t & (mp_word)MP_MASK) - (mp_word)u;
+         u = (mp_digit)(t >> (MP_SIZEOF_BITS(mp_word) - 1u));
+         xj[i] = (mp_digit)(t & (mp_word)MP_MASK);
+      }
+      t = (mp_word)xj[n] - (mp_word)c - (mp_word)u;
+      u = (mp_digit)(t >> (MP_SIZEOF_BITS(mp_word) - 1u));
+      xj[n] = (mp_digit)(t & (mp_word)MP_MASK);
+
+      /* if x < 0 then { x = x + y * B**j; qj -= 1; } */
+      if (u != 0u) {
+         c = 0u;
+         for (i = 0; i < n; i++) {
+            t = (mp_word)xj[i] + (mp_word)y->dp[i] + (mp_word)c;
+            c = (mp_digit)(t >> MP_DIGIT_BIT);
+            xj[i] = (mp_digit)(t & (mp_word)MP_MASK);
+         }
+         xj[n] = (xj[n] + c) & MP_MASK;
+         qj--;
+      }
+      q->dp[j] = qj;
+   }
+
+   q->used = m + 1;
+   mp_clamp(q);
+   mp_clamp(x);
+   return MP_OKAY;
+}
+
+/* c = a / b, d = a mod b like mp_div() with the b of ctx
+ *
+ * Nothing about b needs to be computed again, a is normalized and divided
+ * by the schoolbook division or with the reciprocal of b.
+ */
+mp_err mp_div_ctx_divmod(const mp_div_ctx *ctx, const mp_int *a, mp_int *c, mp_int *d)
+{
+   mp_int A, Q;
+   mp_err err;
+   mp_sign sign = a->sign;
+   bool neg = (a->sign != ctx->sign);
+
+   if ((err = mp_init_multi(&A, &Q, NULL)) != MP_OKAY) {
+      return err;
+   }
+
+   if ((err = mp_mul_2d(a, ctx->norm, &A)) != MP_OKAY)                    goto LBL_ERR;
+   A.sign = MP_ZPOS;
+
+   if (mp_cmp_mag(&A, &ctx->b) == MP_LT) {
+      /* q = 0, r = a */
+   } else if (!mp_iszero(&ctx->x)) {
+      err = s_mp_div_barrett(&A, &ctx->b, &ctx->x, ctx->b.used, &Q, &A);
+   } else {
+      err = s_div_school(&A, &ctx->b, ctx->v, &Q);
+   }
+   if (err != MP_OKAY)                                                    goto LBL_ERR;
+
+   if (c != NULL) {
+      mp_exch(&Q, c);
+      c->sign = ((!mp_iszero(c) && neg) ? MP_NEG : MP_ZPOS);
+   }
+   if (d != NULL) {
+      if ((err = mp_div_2d(&A, ctx->norm, &A, NULL)) != MP_OKAY)          goto LBL_ERR;
+      A.sign = (mp_iszero(&A) ? MP_ZPOS : sign);
+      mp_exch(&A, d);
+   }
+
+LBL_ERR:
+   mp_clear_multi(&A, &Q, NULL);
+   return err;
+}
+#endif
@@ -0,0 +1,55 @@
+#include "tommath_private.h"
+#ifdef MP_DIV_CTX_INIT_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+
+/* prepares ctx for the divisions by b, see mp_div_ctx_divmod()
+ *
+ * b is normalized such that the top bit of its upper digit is set.
+ * The reciprocal v of its upper two digits gives the digits of the
+ * quotient in the schoolbook division, a divisor of MP_DIV_NEWTON_CUTOFF
+ * digits gets the reciprocal x of all of them, too.
+ */
+mp_err mp_div_ctx_init(mp_div_ctx *ctx, const mp_int *b)
+{
+   mp_int t, d;
+   mp_err err;
+
+   if (mp_iszero(b)) {
+      return MP_VAL;
+   }
+
+   if ((err = mp_init_multi(&ctx->b, &ctx->x, NULL)) != MP_OKAY) {
+      return err;
+   }
+   if ((err = mp_init_multi(&t, &d, NULL)) != MP_OKAY)                    goto LBL_ERR;
+
+   ctx->sign = b->sign;
+   ctx->norm = (MP_DIGIT_BIT - 1) - ((mp_count_bits(b) - 1) % MP_DIGIT_BIT);
+   if ((err = mp_mul_2d(b, ctx->norm, &ctx->b)) != MP_OKAY)               goto LBL_ERR;
+   ctx->b.sign = MP_ZPOS;
+
+   /* v = (B**3 - 1) / <d1,d0> - B */
+   if ((err = mp_copy(&ctx->b, &d)) != MP_OKAY)                           goto LBL_ERR;
+   if (d.used == 1) {
+      if ((err = mp_lshd(&d, 1)) != MP_OKAY)                              goto LBL_ERR;
+   } else {
+      mp_rshd(&d, d.used - 2);
+   }
+   if ((err = mp_2expt(&t, 3 * MP_DIGIT_BIT)) != MP_OKAY)                 goto LBL_ERR;
+   if ((err = mp_decr(&t)) != MP_OKAY)                                    goto LBL_ERR;
+   if ((err = mp_div(&t, &d, &t, NULL)) != MP_OKAY)                       goto LBL_ERR;
+   ctx->v = t.dp[0];
+
+   if (MP_HAS(S_MP_DIV_BARRETT) && (ctx->b.used >= MP_DIV_NEWTON_CUTOFF)) {
+      if ((err = s_mp_div_recip(&ctx->b, ctx->b.used, &ctx->x)) != MP_OKAY) goto LBL_ERR;
+   }
+
+   mp_clear_multi(&t, &d, NULL);
+   return MP_OKAY;
+
+LBL_ERR:
+   mp_clear_multi(&t, &d, &ctx->b, &ctx->x, NULL);
+   return err;
+}
+#endif
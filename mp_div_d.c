@@ -7,9 +7,9 @@
 mp_err mp_div_d(const mp_int *a, mp_digit b, mp_int *c, mp_digit *d)
 {
    mp_int  q;
-   mp_word w;
+   mp_digit w, v;
    mp_err err;
-   int ix;
+   int ix, s;
 
    /* cannot divide by zero */
    if (b == 0u) {
@@ -50,26 +50,30 @@ mp_err mp_div_d(const mp_int *a, mp_digit b, mp_int *c, mp_digit *d)
       return s_mp_div_3(a, c, d);
    }
 
-   /* no easy answer [c'est la vie].  Just division */
+   /* no easy answer [c'est la vie].  Just division, but by multiplying with
+    * the reciprocal of the normalized b, see MP_DIV_2BY1.  The digits of a
+    * are shifted on the fly, w is the remainder times 2**s.
+    */
    if ((err = mp_init_size(&q, a->used)) != MP_OKAY) {
       return err;
    }
 
+   for (s = 0; (b << s) <= (MP_MASK >> 1); s++) {}
+   b <<= s;
+   v = MP_DIV_2BY1_RECIP(b);
+
    q.used = a->used;
    q.sign = a->sign;
    w = 0;
    for (ix = a->used; ix --> 0;) {
-      mp_digit t = 0;
-      w = (w << (mp_word)MP_DIGIT_BIT) | (mp_word)a->dp[ix];
-      if (w >= b) {
-         t = (mp_digit)(w / b);
-         w -= (mp_word)t * (mp_word)b;
-      }
-      q.dp[ix] = t;
+      mp_digit x = a->dp[ix],
+               u1 = (mp_digit)(w + ((x >> 1) >> (MP_DIGIT_BIT - 1 - s))),
+               u0 = (x << s) & MP_MASK;
+      MP_DIV_2BY1(q.dp[ix], w, u1, u0, b, v);
    }
 
    if (d != NULL) {
-      *d = (mp_digit)w;
+      *d = w >> s;
    }
 
    if (c != NULL) {
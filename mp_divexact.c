@@ -0,0 +1,157 @@
+#include "tommath_private.h"
+#ifdef MP_DIVEXACT_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+
+/* A = A / B for an odd B, n is the number of digits of the quotient
+ *
+ * Every digit of the quotient is the lowest digit of what is left of A times
+ * the inverse of B mod B, it replaces that digit.  Only the lower n digits
+ * of A are touched.
+ */
+static mp_err s_div_hensel(mp_int *A, const mp_int *B, int n)
+{
+   mp_digit binv, rho;
+   mp_err err;
+   int i, j;
+
+   if ((err = mp_montgomery_setup(B, &rho)) != MP_OKAY) {
+      return err;
+   }
+   binv = ((mp_digit)0 - rho) & MP_MASK;
+
+   for (i = 0; i < n; i++) {
+      mp_digit q = (mp_digit)((mp_word)A->dp[i] * (mp_word)binv) & MP_MASK, c = 0, u = 0;
+      int m = MP_MIN(B->used, n - i);
+      mp_word t;
+
+      /* A = A - q * B * B**i mod B**n */
+      for (j = 0; j < m; j++) {
+         t = ((mp_word)q * (mp_word)B->dp[j]) + (mp_word)c;
+         c = (mp_digit)(t >> MP_DIGIT_BIT);
+         t = (mp_word)A->dp[i + j] - (t & (mp_word)MP_MASK) - (mp_word)u;
+         u = (mp_digit)(t >> (MP_SIZEOF_BITS(mp_word) - 1u));
+         A->dp[i + j] = (mp_digit)(t & (mp_word)MP_MASK);
+      }
+      for (j = i + m; (j < n) && ((c | u) != 0u); j++) {
+         t = (mp_word)A->dp[j] - (mp_word)c - (mp_word)u;
+         c = 0;
+         u = (mp_digit)(t >> (MP_SIZEOF_BITS(mp_word) - 1u));
+         A->dp[j] = (mp_digit)(t & (mp_word)MP_MASK);
+      }
+
+      /* the digit i of A is zero now, it takes the digit of the quotient */
+      A->dp[i] = q;
+   }
+   s_mp_zero_digs(A->dp + n, A->used - n);
+   A->used = n;
+   mp_clamp(A);
+   return MP_OKAY;
+}
+
+/* Q = A / B for an odd B, n is the number of digits of the quotient
+ *
+ * Blocks of k digits of the quotient are the lower digits of what is left
+ * of A times the inverse of B mod B**k, A is changed.
+ */
+static mp_err s_div_hensel_newton(mp_int *A, const mp_int *B, int n, mp_int *Q)
+{
+   mp_int X, T;
+   mp_err err;
+   int i, k = MP_MIN(n, B->used);
+
+   if ((err = mp_init_multi(&X, &T, NULL)) != MP_OKAY) {
+      return err;
+   }
+   if ((err = mp_grow(Q, n)) != MP_OKAY)                                  goto LBL_ERR;
+   if ((err = s_mp_invmod_radix(B, k, &X)) != MP_OKAY)                    goto LBL_ERR;
+
+   mp_zero(Q);
+   for (i = 0; i < n; i += k) {
+      int kk = MP_MIN(k, n - i);
+      if ((err = mp_mod_2d(A, kk * MP_DIGIT_BIT, &T)) != MP_OKAY)         goto LBL_ERR;
+      if ((err = mp_mul_low(&T, &X, kk, &T)) != MP_OKAY)                  goto LBL_ERR;
+      s_mp_copy_digs(Q->dp + i, T.dp, T.used);
+
+      /* A = (A - T * B) / B**kk */
+      if ((i + kk) < n) {
+         if ((err = mp_mul(&T, B, &T)) != MP_OKAY)                        goto LBL_ERR;
+         if ((err = mp_sub(A, &T, A)) != MP_OKAY)                         goto LBL_ERR;
+         mp_rshd(A, kk);
+      }
+   }
+   Q->used = n;
+   mp_clamp(Q);
+
+LBL_ERR:
+   mp_clear_multi(&X, &T, NULL);
+   return err;
+}
+
+/* c = a / b for a b that divides a, the result is wrong otherwise
+ *
+ * Hensel (2-adic) division, see: Jebelean, Tudor. "An algorithm for exact
+ * division." Journal of Symbolic Computation 15.2 (1993)
+ *
+ * The quotient is computed from the low end with the inverse of b mod B,
+ * no remainder is formed and only the lower m - n + 1 digits of a are
+ * touched, that is about half the work of the schoolbook division.  For
+ * long b and much longer quotients the inverse of b mod B**n is computed by
+ * Newton iteration instead and the quotient taken n digits at a time.
+ */
+mp_err mp_divexact(const mp_int *a, const mp_int *b, mp_int *c)
+{
+   mp_int A, B, Q;
+   mp_err err;
+   bool neg = (a->sign != b->sign);
+   int s, n, k;
+
+   if (mp_iszero(b)) {
+      return MP_VAL;
+   }
+
+   if (b->used == 1) {
+      if ((err = mp_divexact_d(a, b->dp[0], c)) != MP_OKAY) {
+         return err;
+      }
+      c->sign = ((!mp_iszero(c) && neg) ? MP_NEG : MP_ZPOS);
+      return MP_OKAY;
+   }
+
+   if (mp_cmp_mag(a, b) == MP_LT) {
+      mp_zero(c);
+      return MP_OKAY;
+   }
+
+   if ((err = mp_init_multi(&A, &B, &Q, NULL)) != MP_OKAY) {
+      return err;
+   }
+
+   /* make b odd */
+   s = mp_cnt_lsb(b);
+   if ((err = mp_div_2d(a, s, &A, NULL)) != MP_OKAY)                      goto LBL_ERR;
+   if ((err = mp_div_2d(b, s, &B, NULL)) != MP_OKAY)                      goto LBL_ERR;
+   A.sign = B.sign = MP_ZPOS;
+
+   /* the number of digits of the quotient */
+   n = (A.used - B.used) + 1;
+
+   /* The inverse pays off for many blocks of the quotient, a single one needs
+    * to be much longer.
+    */
+   k = MP_MIN(n, B.used);
+   if (MP_HAS(MP_MUL_LOW) && (k >= MP_DIV_NEWTON_CUTOFF) &&
+       ((n >= (2 * B.used)) || (k >= (16 * MP_DIV_NEWTON_CUTOFF)))) {
+      if ((err = s_div_hensel_newton(&A, &B, n, &Q)) != MP_OKAY)          goto LBL_ERR;
+      mp_exch(&Q, c);
+   } else {
+      if ((err = s_div_hensel(&A, &B, n)) != MP_OKAY)                     goto LBL_ERR;
+      mp_exch(&A, c);
+   }
+   c->sign = ((!mp_iszero(c) && neg) ? MP_NEG : MP_ZPOS);
+
+LBL_ERR:
+   mp_clear_multi(&A, &B, &Q, NULL);
+   return err;
+}
+#endif
@@ -0,0 +1,50 @@
+#include "tommath_private.h"
+#ifdef MP_DIVEXACT_D_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+
+/* c = a / b for a digit b that divides a, the result is wrong otherwise
+ *
+ * Hensel division from the low end: every digit of the quotient is the
+ * lowest digit of what is left times the inverse of b mod B, no division
+ * and no remainder.  Powers of two in b are shifted out first.
+ */
+mp_err mp_divexact_d(const mp_int *a, mp_digit b, mp_int *c)
+{
+   mp_err   err;
+   mp_digit x, cv;
+   int      ix, s;
+
+   if (b == 0u) {
+      return MP_VAL;
+   }
+
+   for (s = 0; ((b >> s) & 1u) == 0u; s++) {}
+   if ((err = mp_div_2d(a, s, c, NULL)) != MP_OKAY) {
+      return err;
+   }
+   b >>= s;
+   if (b == 1u) {
+      return MP_OKAY;
+   }
+
+   /* x = 1/b mod B, each step doubles the correct bits, see mp_montgomery_setup() */
+   x = b;
+   for (s = 3; s < MP_DIGIT_BIT; s *= 2) {
+      x = (x * (mp_digit)(2u - (b * x))) & MP_MASK;
+   }
+
+   cv = 0;
+   for (ix = 0; ix < c->used; ix++) {
+      mp_digit l = c->dp[ix], q;
+      mp_word t = (mp_word)l - (mp_word)cv;
+      q = (mp_digit)(((mp_word)((mp_digit)t & MP_MASK) * (mp_word)x)) & MP_MASK;
+      c->dp[ix] = q;
+      /* q * b is l - cv plus a multiple of B, carry that and the borrow */
+      cv = (mp_digit)(((mp_word)q * (mp_word)b) >> MP_DIGIT_BIT) + (mp_digit)(t >> (MP_SIZEOF_BITS(mp_word) - 1u));
+   }
+
+   mp_clamp(c);
+   return MP_OKAY;
+}
+#endif
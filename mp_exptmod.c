@@ -10,7 +10,7 @@
  */
 mp_err mp_exptmod(const mp_int *G, const mp_int *X, const mp_int *P, mp_int *Y)
 {
-   int dr;
+   int dr, form;
 
    /* modulus P must be positive */
    if (mp_isneg(P)) {
@@ -47,6 +47,18 @@ LBL_ERR:
       return err;
    }
 
+   /* generalized Mersenne moduli are reduced with word shifts and additions,
+    * the Montgomery reduction of digits larger than the 32-bit words is faster
+    */
+   if (MP_HAS(S_MP_SOLINAS_FIND) && s_mp_solinas_find(P, &form)) {
+      if (MP_HAS(S_MP_EXPTMOD_SOLINAS) && (MP_DIGIT_BIT <= 32)) {
+         return s_mp_exptmod_solinas(G, X, P, Y, form);
+      }
+      if (MP_HAS(S_MP_EXPTMOD_FAST)) {
+         return s_mp_exptmod_fast(G, X, P, Y, 0);
+      }
+   }
+
    /* modified diminished radix reduction */
    if (MP_HAS(MP_REDUCE_IS_2K_L) && MP_HAS(MP_REDUCE_2K_L) && MP_HAS(S_MP_EXPTMOD) &&
        mp_reduce_is_2k_l(P)) {
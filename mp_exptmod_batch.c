@@ -0,0 +1,238 @@
+#include "tommath_private.h"
+#ifdef MP_EXPTMOD_BATCH_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+
+/* Y[i] = G[i]**X[i] mod P[i] for the n independent jobs, errs[i] the result of job i
+ *
+ * Jobs with the same odd modulus and X[i] >= 0 share one Montgomery context
+ * and use mp_mont_exptmod(), all others mp_exptmod().  The moduli are
+ * sorted to find them.
+ *
+ * With the worker threads of mp_mul_threads() the jobs are dealt out in
+ * ranges to the workers and the calling thread, each takes the jobs of its
+ * own range from the front.  One that is done steals single jobs from the
+ * back of the longest range left, until all are taken.  Otherwise the jobs
+ * are run one after the other.
+ *
+ * Returns the error of the first failed job, errs may be NULL then.  The
+ * Y[i] must be distinct and no Y[i] an input of another job.
+ */
+
+typedef struct {
+   const mp_int *P;
+   int job;
+} s_modulus;
+
+typedef struct {
+   const mp_int **G, **X, **P;
+   mp_int **Y;
+   mp_err *errs;
+   const mp_mont_ctx **ctx;
+#ifdef MP_USE_PTHREADS
+   pthread_mutex_t lock;
+   int *lo, *hi, parts;
+#endif
+} s_batch;
+
+static int s_cmp(const s_modulus *x, const s_modulus *y)
+{
+   mp_ord ord = mp_cmp(x->P, y->P);
+   if (ord != MP_EQ) {
+      return (ord == MP_LT) ? -1 : 1;
+   }
+   return (x->job < y->job) ? -1 : ((x->job > y->job) ? 1 : 0);
+}
+
+/* Shell sort with the gaps 1, 4, 13, 40, ... */
+static void s_sort(s_modulus *m, int n)
+{
+   int gap, i, j;
+
+   for (gap = 1; gap < (n / 3); gap = (3 * gap) + 1) {}
+   for (; gap > 0; gap /= 3) {
+      for (i = gap; i < n; i++) {
+         s_modulus t = m[i];
+         for (j = i; (j >= gap) && (s_cmp(&m[j - gap], &t) > 0); j -= gap) {
+            m[j] = m[j - gap];
+         }
+         m[j] = t;
+      }
+   }
+}
+
+static void s_job(const s_batch *b, int i)
+{
+   if ((b->ctx[i] != NULL) && !mp_isneg(b->X[i])) {
+      b->errs[i] = mp_mont_exptmod(b->ctx[i], b->G[i], b->X[i], b->Y[i]);
+   } else {
+      b->errs[i] = mp_exptmod(b->G[i], b->X[i], b->P[i], b->Y[i]);
+   }
+}
+
+#ifdef MP_USE_PTHREADS
+/* one participant of the batch, the index of its range */
+typedef struct {
+   s_batch *b;
+   int part;
+} s_part;
+
+static void s_run(void *arg)
+{
+   s_part *p = (s_part *)arg;
+   s_batch *b = p->b;
+
+   for (;;) {
+      int i = -1, k, most = 0;
+
+      pthread_mutex_lock(&b->lock);
+      if (b->lo[p->part] < b->hi[p->part]) {
+         i = b->lo[p->part]++;
+      } else {
+         for (k = 0; k < b->parts; k++) {
+            if ((b->hi[k] - b->lo[k]) > most) {
+               most = b->hi[k] - b->lo[k];
+               i = k;
+            }
+         }
+         if (i >= 0) {
+            i = --b->hi[i];
+         }
+      }
+      pthread_mutex_unlock(&b->lock);
+
+      if (i < 0) {
+         return;
+      }
+      s_job(b, i);
+   }
+}
+
+/* deals the n jobs out to b->parts participants, the calling thread is one of them */
+static mp_err s_parallel(s_batch *b, int n)
+{
+   mp_mul_task *task;
+   s_part *part;
+   size_t size;
+   int i;
+
+   size = (sizeof(mp_mul_task) + sizeof(s_part) + (2u * sizeof(int))) * (size_t)b->parts;
+   if ((task = (mp_mul_task *) MP_MALLOC(size)) == NULL) {
+      return MP_MEM;
+   }
+   if (pthread_mutex_init(&b->lock, NULL) != 0) {
+      MP_FREE_BUF(task, size);
+      return MP_ERR;
+   }
+   part = (s_part *)(void *)(task + b->parts);
+   b->lo = (int *)(void *)(part + b->parts);
+   b->hi = b->lo + b->parts;
+
+   for (i = 0; i < b->parts; i++) {
+      b->lo[i] = (int)(((long)n * i) / b->parts);
+      b->hi[i] = (int)(((long)n * (i + 1)) / b->parts);
+      part[i].b = b;
+      part[i].part = i;
+      task[i].run = s_run;
+      task[i].arg = &part[i];
+   }
+   s_mp_mul_pool_run(task, b->parts);
+
+   pthread_mutex_destroy(&b->lock);
+   MP_FREE_BUF(task, size);
+   return MP_OKAY;
+}
+#endif
+
+mp_err mp_exptmod_batch(const mp_int **G, const mp_int **X, const mp_int **P, mp_int **Y, int n, mp_err *errs)
+{
+   s_batch   b;
+   s_modulus *m;
+   mp_mont_ctx *ctx = NULL;
+   size_t    size;
+   int       i, j, count = 0, groups = 0;
+   mp_err    err = MP_OKAY;
+   bool      threaded;
+
+   if (n < 0) {
+      return MP_VAL;
+   }
+   if (n == 0) {
+      return MP_OKAY;
+   }
+
+   /* the moduli sorted, the context of each job and its error */
+   size = ((sizeof(s_modulus) + sizeof(mp_mont_ctx *) + sizeof(mp_err)) * (size_t)n);
+   if ((m = (s_modulus *) MP_MALLOC(size)) == NULL) {
+      return MP_MEM;
+   }
+   b.G = G;
+   b.X = X;
+   b.P = P;
+   b.Y = Y;
+   b.ctx = (const mp_mont_ctx **)(void *)(m + n);
+   b.errs = (mp_err *)(void *)(b.ctx + n);
+
+   for (i = 0; i < n; i++) {
+      m[i].P = P[i];
+      m[i].job = i;
+      b.ctx[i] = NULL;
+   }
+   s_sort(m, n);
+
+   /* one context for every odd modulus of more than one job */
+   for (i = 0; i < n; i = j) {
+      for (j = i + 1; (j < n) && (mp_cmp(m[i].P, m[j].P) == MP_EQ); j++) {}
+      if (((j - i) > 1) && mp_isodd(m[i].P) && !mp_isneg(m[i].P)) {
+         count++;
+      }
+   }
+   if (count > 0) {
+      ctx = (mp_mont_ctx *) MP_MALLOC(sizeof(mp_mont_ctx) * (size_t)count);
+   }
+   if (ctx != NULL) {
+      for (i = 0; i < n; i = j) {
+         for (j = i + 1; (j < n) && (mp_cmp(m[i].P, m[j].P) == MP_EQ); j++) {}
+         if (((j - i) > 1) && mp_isodd(m[i].P) && !mp_isneg(m[i].P)) {
+            /* without it the jobs simply use mp_exptmod() */
+            if (mp_mont_ctx_init(&ctx[groups], m[i].P) == MP_OKAY) {
+               int k;
+               for (k = i; k < j; k++) {
+                  b.ctx[m[k].job] = &ctx[groups];
+               }
+               groups++;
+            }
+         }
+      }
+   }
+
+   threaded = false;
+#ifdef MP_USE_PTHREADS
+   b.parts = MP_MIN(MP_MUL_WORKERS + 1, n);
+   if (b.parts > 1) {
+      threaded = (s_parallel(&b, n) == MP_OKAY);
+   }
+#endif
+   if (!threaded) {
+      for (i = 0; i < n; i++) {
+         s_job(&b, i);
+      }
+   }
+
+   for (i = 0; i < n; i++) {
+      if ((err == MP_OKAY) && (b.errs[i] != MP_OKAY)) {
+         err = b.errs[i];
+      }
+      if (errs != NULL) {
+         errs[i] = b.errs[i];
+      }
+   }
+
+   for (i = 0; i < groups; i++) {
+      mp_mont_ctx_clear(&ctx[i]);
+   }
+   MP_FREE_BUF(ctx, sizeof(mp_mont_ctx) * (size_t)count);
+   MP_FREE_BUF(m, size);
+   return err;
+}
+#endif
@@ -0,0 +1,24 @@
+#include "tommath_private.h"
+#ifdef MP_EXPTMOD_CRT_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+
+/* out = c**d mod p*q from the CRT components of an RSA key
+ *
+ * mp_crt_exptmod() with a context for this call only, keys that are used
+ * more than once should keep one with mp_crt_ctx_init().
+ */
+mp_err mp_exptmod_crt(const mp_int *c, const mp_int *dp, const mp_int *dq, const mp_int *p, const mp_int *q,
+                      const mp_int *qinv, mp_int *out)
+{
+   mp_crt_ctx ctx;
+   mp_err err;
+
+   if ((err = mp_crt_ctx_init(&ctx, dp, dq, p, q, qinv, false)) != MP_OKAY) {
+      return err;
+   }
+   err = mp_crt_exptmod(&ctx, c, out);
+   mp_crt_ctx_clear(&ctx);
+   return err;
+}
+#endif
@@ -0,0 +1,357 @@
+#include "tommath_private.h"
+#ifdef MP_EXPTMOD_MULTI_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+
+/* Y = bases[0]**exps[0] * ... * bases[n-1]**exps[n-1] (mod P)
+ *
+ * All powers share one Montgomery context and one chain of squarings.  A few
+ * bases get interleaved sliding windows over their own odd powers (Straus,
+ * HAC pp.618, Algorithm 14.88 with windows), many the buckets of Pippenger:
+ * per window of c bits each base is multiplied into the bucket of its digit
+ * and the buckets are summed up as B[2**c - 1]**(2**c - 1) * ... * B[1] with
+ * two multiplications each.  The one with fewer multiplications is taken.
+ *
+ * Moduli below the Karatsuba squaring cutoff get the lazily reduced products
+ * of s_mp_mont_mul_lazy() on nu digits with R = B**nu like s_mp_exptmod_lazy(),
+ * the values are then only kept below 2P.
+ *
+ * Negative exponents take the inverse of their base like mp_exptmod().  Even
+ * moduli have no Montgomery form, they get one mp_exptmod() per base.
+ */
+
+#ifdef MP_LOW_MEM
+#   define MAX_WINSIZE 5
+#   define MAX_BUCKET_BITS 6
+#else
+#   define MAX_WINSIZE 8
+#   define MAX_BUCKET_BITS 16
+#endif
+
+/* window size for an exponent of the given bits, capped for the memory */
+static int s_winsize(int bits)
+{
+   return MP_MIN(MAX_WINSIZE, s_mp_exptmod_winsize(bits));
+}
+
+/* c = a * b in the Montgomery domain of ctx, with the lazy products if N is
+ * not NULL: P padded to nu digits and after it the 2 * nu + 1 digits of
+ * room s_mp_mont_mul_lazy() needs.  The ints have room for nu digits then.
+ */
+static mp_err s_mul(const mp_mont_ctx *ctx, mp_digit *N, int nu, const mp_int *a, const mp_int *b, mp_int *c)
+{
+   if (N == NULL) {
+      return (a == b) ? mp_mont_sqr(ctx, a, c) : mp_mont_mul(ctx, a, b, c);
+   }
+   s_mp_mont_mul_lazy(a->dp, b->dp, c->dp, N, nu, ctx->rho, N + nu);
+   c->used = nu;
+   mp_clamp(c);
+   return MP_OKAY;
+}
+
+/* c = c * b, only a copy of b while c is still the one */
+static mp_err s_mul_one(const mp_mont_ctx *ctx, mp_digit *N, int nu, bool *one, const mp_int *b, mp_int *c)
+{
+   if (*one) {
+      *one = false;
+      return mp_copy(b, c);
+   }
+   return s_mul(ctx, N, nu, c, b, c);
+}
+
+/* interleaved sliding windows, each base with its own table of odd powers */
+static mp_err s_straus(const mp_mont_ctx *ctx, mp_digit *N, int nu, const mp_int *g, const mp_int **X, int n, int bits, mp_int *res)
+{
+   mp_int *M;
+   int    *win, *next, *at, *val, *off, size = 0, inited, k, x, i, j;
+   bool   one = true;
+   mp_err err = MP_OKAY;
+
+   for (k = 0; k < n; k++) {
+      size += 1 << (s_winsize(mp_count_bits(X[k])) - 1);
+   }
+
+   /* the tables and after them the state of the windows of every base */
+   M = (mp_int *) MP_MALLOC((sizeof(mp_int) * (size_t)size) + (sizeof(int) * 5u * (size_t)n));
+   if (M == NULL) {
+      return MP_MEM;
+   }
+   win = (int *)(M + size);
+   next = win + n;
+   at = next + n;
+   val = at + n;
+   off = val + n;
+
+   for (inited = 0; inited < size; inited++) {
+      if ((err = mp_init_size(&M[inited], nu)) != MP_OKAY)               goto LBL_ERR;
+   }
+
+   /* M[off[k] + x] = g[k]**(2x + 1), res = g[k]**2 for now */
+   for (k = 0, x = 0; k < n; k++) {
+      win[k] = s_winsize(mp_count_bits(X[k]));
+      next[k] = mp_count_bits(X[k]) - 1;
+      at[k] = -1;
+      off[k] = x;
+      x += 1 << (win[k] - 1);
+
+      if ((err = mp_copy(&g[k], &M[off[k]])) != MP_OKAY)                 goto LBL_ERR;
+      if ((err = s_mul(ctx, N, nu, &g[k], &g[k], res)) != MP_OKAY)       goto LBL_ERR;
+      for (j = off[k] + 1; j < x; j++) {
+         if ((err = s_mul(ctx, N, nu, &M[j - 1], res, &M[j])) != MP_OKAY) goto LBL_ERR;
+      }
+   }
+
+   for (i = bits - 1; i >= 0; i--) {
+      if (!one) {
+         if ((err = s_mul(ctx, N, nu, res, res, res)) != MP_OKAY)        goto LBL_ERR;
+      }
+      for (k = 0; k < n; k++) {
+         if (next[k] == i) {
+            if (!s_mp_get_bit(X[k], i)) {
+               next[k]--;
+            } else {
+               /* the longest window X[i..j] of at most win bits that ends with a one,
+                * multiplied in when the squarings got down to j
+                */
+               j = MP_MAX(i - win[k] + 1, 0);
+               while (!s_mp_get_bit(X[k], j)) {
+                  j++;
+               }
+               for (val[k] = 0, x = i; x >= j; x--) {
+                  val[k] = (val[k] << 1) | (s_mp_get_bit(X[k], x) ? 1 : 0);
+               }
+               at[k] = j;
+               next[k] = j - 1;
+            }
+         }
+         if (at[k] == i) {
+            if ((err = s_mul_one(ctx, N, nu, &one, &M[off[k] + (val[k] >> 1)], res)) != MP_OKAY) goto LBL_ERR;
+         }
+      }
+   }
+
+   /* res = 1 if all exponents were zero */
+   if (one) {
+      err = mp_copy(&ctx->r, res);
+   }
+
+LBL_ERR:
+   while (inited-- > 0) {
+      mp_clear(&M[inited]);
+   }
+   MP_FREE_BUF(M, (sizeof(mp_int) * (size_t)size) + (sizeof(int) * 5u * (size_t)n));
+   return err;
+}
+
+/* the buckets of Pippenger for windows of c bits */
+static mp_err s_pippenger(const mp_mont_ctx *ctx, mp_digit *N, int nu, const mp_int *g, const mp_int **X, int n, int bits, int c, mp_int *res)
+{
+   mp_int *B, run, sum;
+   bool   *full, one = true, runone, sumone;
+   int    size = (1 << c) - 1, inited = 0, k, x, i, d;
+   mp_err err;
+
+   /* the buckets for the digits 1 .. 2**c - 1 and their flags */
+   B = (mp_int *) MP_MALLOC((sizeof(mp_int) + sizeof(bool)) * (size_t)size);
+   if (B == NULL) {
+      return MP_MEM;
+   }
+   full = (bool *)(B + size);
+
+   if ((err = mp_init_size(&run, nu)) != MP_OKAY)                         goto LBL_B;
+   if ((err = mp_init_size(&sum, nu)) != MP_OKAY)                         goto LBL_RUN;
+   for (inited = 0; inited < size; inited++) {
+      if ((err = mp_init_size(&B[inited], nu)) != MP_OKAY)                goto LBL_ERR;
+   }
+
+   for (i = ((bits + c - 1) / c) - 1; i >= 0; i--) {
+      if (!one) {
+         for (x = 0; x < c; x++) {
+            if ((err = s_mul(ctx, N, nu, res, res, res)) != MP_OKAY)     goto LBL_ERR;
+         }
+      }
+
+      /* B[d - 1] = product of the bases with the digit d in this window */
+      for (x = 0; x < size; x++) {
+         full[x] = false;
+      }
+      for (k = 0; k < n; k++) {
+         for (d = 0, x = c - 1; x >= 0; x--) {
+            d = (d << 1) | (s_mp_get_bit(X[k], (i * c) + x) ? 1 : 0);
+         }
+         if (d != 0) {
+            bool empty = !full[d - 1];
+            full[d - 1] = true;
+            if ((err = s_mul_one(ctx, N, nu, &empty, &g[k], &B[d - 1])) != MP_OKAY) goto LBL_ERR;
+         }
+      }
+
+      /* sum = B[1] * B[2]**2 * ... from the running products of the top buckets */
+      runone = sumone = true;
+      for (d = size; d > 0; d--) {
+         if (full[d - 1]) {
+            if ((err = s_mul_one(ctx, N, nu, &runone, &B[d - 1], &run)) != MP_OKAY) goto LBL_ERR;
+         }
+         if (!runone) {
+            if ((err = s_mul_one(ctx, N, nu, &sumone, &run, &sum)) != MP_OKAY) goto LBL_ERR;
+         }
+      }
+      if (!sumone) {
+         if ((err = s_mul_one(ctx, N, nu, &one, &sum, res)) != MP_OKAY)  goto LBL_ERR;
+      }
+   }
+
+   /* res = 1 if all exponents were zero */
+   if (one) {
+      err = mp_copy(&ctx->r, res);
+   }
+
+LBL_ERR:
+   while (inited-- > 0) {
+      mp_clear(&B[inited]);
+   }
+   mp_clear(&sum);
+LBL_RUN:
+   mp_clear(&run);
+LBL_B:
+   MP_FREE_BUF(B, (sizeof(mp_int) + sizeof(bool)) * (size_t)size);
+   return err;
+}
+
+mp_err mp_exptmod_multi(const mp_int **bases, const mp_int **exps, int n, const mp_int *P, mp_int *Y)
+{
+   mp_mont_ctx ctx;
+   mp_int   *g, res;
+   mp_digit *N = NULL;
+   uint64_t straus, cost;
+   int      nu, bits = 0, c = 0, k, x;
+   mp_err   err;
+
+   /* modulus P must be positive */
+   if ((n < 0) || mp_isneg(P) || mp_iszero(P)) {
+      return MP_VAL;
+   }
+
+   /* the one mod P times one mp_exptmod() per base */
+   if ((n == 0) || mp_iseven(P) || (mp_cmp_d(P, 1u) == MP_EQ)) {
+      mp_int t;
+      if ((err = mp_init_multi(&res, &t, NULL)) != MP_OKAY) {
+         return err;
+      }
+      mp_set(&res, 1u);
+      if ((err = mp_mod(&res, P, &res)) != MP_OKAY)                       goto LBL_T;
+      for (k = 0; k < n; k++) {
+         if ((err = mp_exptmod(bases[k], exps[k], P, &t)) != MP_OKAY)    goto LBL_T;
+         if ((err = mp_mulmod(&res, &t, P, &res)) != MP_OKAY)             goto LBL_T;
+      }
+      mp_exch(&res, Y);
+LBL_T:
+      mp_clear_multi(&res, &t, NULL);
+      return err;
+   }
+
+   nu = P->used;
+   if (MP_HAS(S_MP_MONT_MUL_LAZY) && (P->used < MP_SQR_KARATSUBA_CUTOFF)) {
+      /* one digit more if the top digit of P leaves no room for 4P */
+      if (mp_count_bits(P) > ((nu * MP_DIGIT_BIT) - 2)) {
+         nu++;
+      }
+
+      /* the context for R = B**nu, P padded to nu digits and the digits mu */
+      if ((err = mp_init_multi(&ctx.n, &ctx.r, &ctx.rr, &ctx.ninv, &ctx.ifma, NULL)) != MP_OKAY) {
+         return err;
+      }
+      if ((err = mp_copy(P, &ctx.n)) != MP_OKAY)                          goto LBL_CTX;
+      if ((err = mp_montgomery_setup(P, &ctx.rho)) != MP_OKAY)            goto LBL_CTX;
+      if ((err = mp_2expt(&ctx.r, nu * MP_DIGIT_BIT)) != MP_OKAY)         goto LBL_CTX;
+      if ((err = mp_mod(&ctx.r, P, &ctx.r)) != MP_OKAY)                   goto LBL_CTX;
+      if ((err = mp_sqrmod(&ctx.r, P, &ctx.rr)) != MP_OKAY)               goto LBL_CTX;
+      if ((err = mp_grow(&ctx.rr, nu)) != MP_OKAY)                        goto LBL_CTX;
+
+      N = (mp_digit *) MP_MALLOC(sizeof(mp_digit) * ((3u * (size_t)nu) + 1u));
+      if (N == NULL) {
+         err = MP_MEM;
+         goto LBL_CTX;
+      }
+      s_mp_copy_digs(N, P->dp, P->used);
+      s_mp_zero_digs(N + P->used, nu - P->used);
+   } else if ((err = mp_mont_ctx_init(&ctx, P)) != MP_OKAY) {
+      return err;
+   }
+
+   if ((err = mp_init_size(&res, nu)) != MP_OKAY)                         goto LBL_CTX;
+
+   g = (mp_int *) MP_MALLOC(sizeof(mp_int) * (size_t)n);
+   if (g == NULL) {
+      err = MP_MEM;
+      goto LBL_RES;
+   }
+   for (x = 0; x < n; x++) {
+      if ((err = mp_init(&g[x])) != MP_OKAY)                              goto LBL_G;
+   }
+
+   /* the bases in the Montgomery domain */
+   for (k = 0; k < n; k++) {
+      if (mp_isneg(exps[k])) {
+         if (!MP_HAS(MP_INVMOD)) {
+            err = MP_VAL;
+            goto LBL_G;
+         }
+         if ((err = mp_invmod(bases[k], P, &g[k])) != MP_OKAY)            goto LBL_G;
+      } else {
+         if ((err = mp_mod(bases[k], P, &g[k])) != MP_OKAY)               goto LBL_G;
+      }
+      if ((err = mp_grow(&g[k], nu)) != MP_OKAY)                          goto LBL_G;
+      if ((err = s_mul(&ctx, N, nu, &g[k], &ctx.rr, &g[k])) != MP_OKAY)   goto LBL_G;
+      bits = MP_MAX(bits, mp_count_bits(exps[k]));
+   }
+
+   /* the multiplications apart from the shared squarings: the tables and
+    * one per window with Straus, per window of c bits one for each base
+    * and two for each bucket with Pippenger
+    */
+   straus = 0u;
+   for (k = 0; k < n; k++) {
+      int b = mp_count_bits(exps[k]), w = s_winsize(b);
+      straus += (uint64_t)((1 << (w - 1)) + (b / (w + 1)));
+   }
+   for (k = 2, cost = straus; k <= MAX_BUCKET_BITS; k++) {
+      uint64_t ck = (uint64_t)((bits + k - 1) / k) * ((uint64_t)n + (uint64_t)(2 << k));
+      if (ck < cost) {
+         cost = ck;
+         c = k;
+      }
+   }
+
+   if (c == 0) {
+      err = s_straus(&ctx, N, nu, g, exps, n, bits, &res);
+   } else {
+      err = s_pippenger(&ctx, N, nu, g, exps, n, bits, c, &res);
+   }
+   if (err != MP_OKAY)                                                    goto LBL_G;
+
+   /* out of the Montgomery domain times one, the lazy product is at most P */
+   mp_set(&g[0], 1u);
+   if ((err = s_mul(&ctx, N, nu, &res, &g[0], &res)) != MP_OKAY)         goto LBL_G;
+   if (mp_cmp_mag(&res, P) != MP_LT) {
+      if ((err = s_mp_sub(&res, P, &res)) != MP_OKAY)                     goto LBL_G;
+   }
+   mp_exch(&res, Y);
+
+LBL_G:
+   while (x-- > 0) {
+      mp_clear(&g[x]);
+   }
+   MP_FREE_BUF(g, sizeof(mp_int) * (size_t)n);
+LBL_RES:
+   mp_clear(&res);
+LBL_CTX:
+   if (N != NULL) {
+      MP_FREE_DIGS(N, (3 * nu) + 1);
+   }
+   mp_mont_ctx_clear(&ctx);
+   return err;
+}
+#undef MAX_WINSIZE
+#undef MAX_BUCKET_BITS
+#endif
@@ -0,0 +1,11 @@
+#include "tommath_private.h"
+#ifdef MP_FIXED_BASE_COUNT_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+
+/* v * (2**h - 1) entries of n.used digits */
+size_t mp_fixed_base_count(const mp_fixed_base_ctx *ctx)
+{
+   return (size_t)ctx->v * (((size_t)1 << ctx->h) - 1u) * (size_t)ctx->mont.n.used;
+}
+#endif
@@ -0,0 +1,12 @@
+#include "tommath_private.h"
+#ifdef MP_FIXED_BASE_CTX_CLEAR_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+
+void mp_fixed_base_ctx_clear(mp_fixed_base_ctx *ctx)
+{
+   MP_FREE_BUF(ctx->table, sizeof(mp_digit) * mp_fixed_base_count(ctx));
+   mp_clear(&ctx->g);
+   mp_mont_ctx_clear(&ctx->mont);
+}
+#endif
@@ -0,0 +1,48 @@
+#include "tommath_private.h"
+#ifdef MP_FIXED_BASE_CTX_IMPORT_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+
+/* prepares ctx like mp_fixed_base_ctx_init() with the table of mp_fixed_base_export()
+ *
+ * Only the squarings and multiplications of the table are saved, G, n and
+ * bits must be the ones of the exported context.  A buf of another length
+ * or with an entry not below n is refused with MP_VAL, any other mismatch
+ * gives wrong powers.
+ */
+mp_err mp_fixed_base_ctx_import(mp_fixed_base_ctx *ctx, const mp_int *G, const mp_int *n, int bits,
+                                const mp_digit *buf, size_t count)
+{
+   mp_int e;
+   mp_err err;
+   int    nu, x, entries;
+
+   if ((err = s_mp_fixed_base_setup(ctx, G, n, bits)) != MP_OKAY) {
+      return err;
+   }
+   if (count != mp_fixed_base_count(ctx)) {
+      err = MP_VAL;
+      goto LBL_ERR;
+   }
+
+   nu = ctx->mont.n.used;
+   entries = ctx->v * ((1 << ctx->h) - 1);
+   s_mp_copy_digs(ctx->table, buf, entries * nu);
+   for (x = 0; x < entries; x++) {
+      e.dp = ctx->table + (x * nu);
+      e.used = nu;
+      e.alloc = nu;
+      e.sign = MP_ZPOS;
+      mp_clamp(&e);
+      if (mp_cmp_mag(&e, &ctx->mont.n) != MP_LT) {
+         err = MP_VAL;
+         goto LBL_ERR;
+      }
+   }
+   return MP_OKAY;
+
+LBL_ERR:
+   mp_fixed_base_ctx_clear(ctx);
+   return err;
+}
+#endif
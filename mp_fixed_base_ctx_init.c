@@ -0,0 +1,83 @@
+#include "tommath_private.h"
+#ifdef MP_FIXED_BASE_CTX_INIT_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+
+/* prepares ctx for g**X mod n with g = G mod n, odd n > 0 and X of up to bits bits
+ *
+ * The Lim-Lee comb, HAC pp.627, Algorithm 14.117: X is cut into h rows of
+ * a bits and each row into v columns of b bits.  Column j has an entry for
+ * each index u = u[h-1]...u[0] of h bits, the product of g**(2**(i*a + j*b))
+ * over the bits u[i] that are set.  The generators of the rows and columns
+ * are found on one chain of squarings, every other entry with a single
+ * multiplication of two entries before it.
+ */
+
+/* the entry u of column j */
+static void s_entry(const mp_fixed_base_ctx *ctx, int j, int u, mp_int *e)
+{
+   int nu = ctx->mont.n.used;
+   e->dp = ctx->table + ((((j * ((1 << ctx->h) - 1)) + u) - 1) * nu);
+   e->used = nu;
+   e->alloc = nu;
+   e->sign = MP_ZPOS;
+   mp_clamp(e);
+}
+
+/* stores t < n as the entry u of column j */
+static void s_store(const mp_fixed_base_ctx *ctx, int j, int u, const mp_int *t)
+{
+   int nu = ctx->mont.n.used;
+   mp_digit *d = ctx->table + ((((j * ((1 << ctx->h) - 1)) + u) - 1) * nu);
+   s_mp_copy_digs(d, t->dp, t->used);
+   s_mp_zero_digs(d + t->used, nu - t->used);
+}
+
+mp_err mp_fixed_base_ctx_init(mp_fixed_base_ctx *ctx, const mp_int *G, const mp_int *n, int bits)
+{
+   mp_int t, e, f;
+   mp_err err;
+   int    a, b, i, j, u, p = 0;
+
+   if ((err = s_mp_fixed_base_setup(ctx, G, n, bits)) != MP_OKAY) {
+      return err;
+   }
+   a = (ctx->bits + ctx->h - 1) / ctx->h;
+   b = (a + ctx->v - 1) / ctx->v;
+
+   if ((err = mp_init_size(&t, ctx->mont.n.used + 1)) != MP_OKAY)          goto LBL_CTX;
+
+   /* t = g**(2**p) for p = i*a + j*b is the entry 2**i of column j */
+   if ((err = mp_mont_to(&ctx->mont, &ctx->g, &t)) != MP_OKAY)            goto LBL_ERR;
+   for (i = 0; i < ctx->h; i++) {
+      for (j = 0; j < ctx->v; j++) {
+         for (; p < ((i * a) + (j * b)); p++) {
+            if ((err = mp_mont_sqr(&ctx->mont, &t, &t)) != MP_OKAY)       goto LBL_ERR;
+         }
+         s_store(ctx, j, 1 << i, &t);
+      }
+   }
+
+   /* the entry u is the entry of u without its lowest bit times that of the bit */
+   for (j = 0; j < ctx->v; j++) {
+      for (u = 3; u < (1 << ctx->h); u++) {
+         if ((u & (u - 1)) == 0) {
+            continue;
+         }
+         s_entry(ctx, j, u & (u - 1), &e);
+         s_entry(ctx, j, u ^ (u & (u - 1)), &f);
+         if ((err = mp_mont_mul(&ctx->mont, &e, &f, &t)) != MP_OKAY)      goto LBL_ERR;
+         s_store(ctx, j, u, &t);
+      }
+   }
+
+   mp_clear(&t);
+   return MP_OKAY;
+
+LBL_ERR:
+   mp_clear(&t);
+LBL_CTX:
+   mp_fixed_base_ctx_clear(ctx);
+   return err;
+}
+#endif
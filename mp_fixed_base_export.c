@@ -0,0 +1,24 @@
+#include "tommath_private.h"
+#ifdef MP_FIXED_BASE_EXPORT_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+
+/* copies the mp_fixed_base_count() digits of the table of ctx to buf
+ *
+ * The digits only mean something to mp_fixed_base_ctx_import() with the same
+ * G, n and bits in a build with the same digit size.
+ */
+mp_err mp_fixed_base_export(const mp_fixed_base_ctx *ctx, mp_digit *buf, size_t maxcount, size_t *written)
+{
+   size_t count = mp_fixed_base_count(ctx);
+
+   if (count > maxcount) {
+      return MP_BUF;
+   }
+   s_mp_copy_digs(buf, ctx->table, (int)count);
+   if (written != NULL) {
+      *written = count;
+   }
+   return MP_OKAY;
+}
+#endif
@@ -0,0 +1,75 @@
+#include "tommath_private.h"
+#ifdef MP_FIXED_BASE_EXPTMOD_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+
+/* Y = g**X mod n for X >= 0 with the comb of ctx, HAC pp.627, Algorithm 14.117
+ *
+ * The bits k of the b columns of all rows are read at once, b - 1 squarings
+ * and at most v * b multiplications with entries of the table instead of a
+ * squaring per bit of X.  Exponents longer than the comb get the sliding
+ * window of mp_mont_exptmod().
+ */
+mp_err mp_fixed_base_exptmod(const mp_fixed_base_ctx *ctx, const mp_int *X, mp_int *Y)
+{
+   mp_int res, e;
+   mp_err err;
+   int    nu = ctx->mont.n.used, a, b, i, j, k, u;
+   bool   first = true;
+
+   if (mp_isneg(X)) {
+      return MP_VAL;
+   }
+   if (mp_count_bits(X) > ctx->bits) {
+      return mp_mont_exptmod(&ctx->mont, &ctx->g, X, Y);
+   }
+
+   a = (ctx->bits + ctx->h - 1) / ctx->h;
+   b = (a + ctx->v - 1) / ctx->v;
+
+   if ((err = mp_init_size(&res, nu + 1)) != MP_OKAY) {
+      return err;
+   }
+
+   for (k = b - 1; k >= 0; k--) {
+      if (!first) {
+         if ((err = mp_mont_sqr(&ctx->mont, &res, &res)) != MP_OKAY)       goto LBL_ERR;
+      }
+      for (j = ctx->v - 1; j >= 0; j--) {
+         /* the last column can be shorter */
+         if (((j * b) + k) >= a) {
+            continue;
+         }
+         for (u = 0, i = ctx->h - 1; i >= 0; i--) {
+            u = (u << 1) | (s_mp_get_bit(X, (i * a) + (j * b) + k) ? 1 : 0);
+         }
+         if (u == 0) {
+            continue;
+         }
+
+         e.dp = ctx->table + ((((j * ((1 << ctx->h) - 1)) + u) - 1) * nu);
+         e.used = nu;
+         e.alloc = nu;
+         e.sign = MP_ZPOS;
+         mp_clamp(&e);
+         if (first) {
+            /* nothing to multiply with the one yet */
+            if ((err = mp_copy(&e, &res)) != MP_OKAY)                      goto LBL_ERR;
+            first = false;
+         } else {
+            if ((err = mp_mont_mul(&ctx->mont, &res, &e, &res)) != MP_OKAY) goto LBL_ERR;
+         }
+      }
+   }
+
+   /* g**0 */
+   if (first) {
+      if ((err = mp_copy(&ctx->mont.r, &res)) != MP_OKAY)                 goto LBL_ERR;
+   }
+   err = mp_mont_from(&ctx->mont, &res, Y);
+
+LBL_ERR:
+   mp_clear(&res);
+   return err;
+}
+#endif
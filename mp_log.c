@@ -146,13 +146,8 @@ mp_err mp_log(const mp_int *a, const mp_int *b, int *lb)
    /* But it can overestimate, too, for example if "a" is closely below some "b^k" */
    if (cmp == MP_GT) {
       do {
-         if (b->used == 1) {
-            /* These are cheaper exact divisions, but that function is not available in LTM */
-            if ((err = mp_div_d(&bn, b->dp[0], &bn, NULL)) != MP_OKAY)                                    goto LTM_ERR;
-
-         } else {
-            if ((err = mp_div(&bn, b, &bn, NULL)) != MP_OKAY)                                             goto LTM_ERR;
-         }
+         /* bn is a power of b */
+         if ((err = mp_divexact(&bn, b, &bn)) != MP_OKAY)                                                 goto LTM_ERR;
          n--;
       } while ((cmp = mp_cmp(&bn, a)) == MP_GT);
    }
@@ -0,0 +1,10 @@
+#include "tommath_private.h"
+#ifdef MP_MONT_CTX_CLEAR_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+
+void mp_mont_ctx_clear(mp_mont_ctx *ctx)
+{
+   mp_clear_multi(&ctx->n, &ctx->r, &ctx->rr, &ctx->ninv, &ctx->ifma, NULL);
+}
+#endif
@@ -0,0 +1,46 @@
+#include "tommath_private.h"
+#ifdef MP_MONT_CTX_INIT_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+
+/* prepares ctx for the Montgomery arithmetic modulo the odd n > 0
+ *
+ * Everything mp_exptmod() computes for the modulus on every call is done
+ * here once: rho, R mod n and R**2 mod n that takes numbers into the
+ * Montgomery domain with a single multiplication.  Both are divisions, not
+ * the shifts and subtractions of mp_montgomery_calc_normalization().
+ * Large moduli get 1/n mod R for s_mp_montgomery_reduce_mul(), too, and
+ * moduli for s_mp_exptmod_ifma() the R**2 mod n of its 52-bit limbs.
+ */
+mp_err mp_mont_ctx_init(mp_mont_ctx *ctx, const mp_int *n)
+{
+   mp_err err;
+
+   if (mp_isneg(n) || mp_iseven(n)) {
+      return MP_VAL;
+   }
+
+   if ((err = mp_init_multi(&ctx->n, &ctx->r, &ctx->rr, &ctx->ninv, &ctx->ifma, NULL)) != MP_OKAY) {
+      return err;
+   }
+
+   if ((err = mp_copy(n, &ctx->n)) != MP_OKAY)                            goto LBL_ERR;
+   if ((err = mp_montgomery_setup(n, &ctx->rho)) != MP_OKAY)              goto LBL_ERR;
+   if ((err = mp_2expt(&ctx->r, n->used * MP_DIGIT_BIT)) != MP_OKAY)      goto LBL_ERR;
+   if ((err = mp_mod(&ctx->r, n, &ctx->r)) != MP_OKAY)                    goto LBL_ERR;
+   if ((err = mp_sqrmod(&ctx->r, n, &ctx->rr)) != MP_OKAY)                goto LBL_ERR;
+   if (MP_HAS(S_MP_MONTGOMERY_REDUCE_MUL) && (n->used >= MP_REDUCE_MUL_CUTOFF)) {
+      if ((err = s_mp_invmod_radix(n, n->used, &ctx->ninv)) != MP_OKAY)   goto LBL_ERR;
+   }
+   if (MP_HAS(S_MP_EXPTMOD_IFMA) && s_mp_cpu_ifma() &&
+       (mp_count_bits(n) >= MP_IFMA_MIN_BITS) && (mp_count_bits(n) <= MP_IFMA_MAX_BITS)) {
+      if ((err = s_mp_ifma_rr(n, &ctx->ifma)) != MP_OKAY)                 goto LBL_ERR;
+   }
+
+   return MP_OKAY;
+
+LBL_ERR:
+   mp_clear_multi(&ctx->n, &ctx->r, &ctx->rr, &ctx->ninv, &ctx->ifma, NULL);
+   return err;
+}
+#endif
@@ -0,0 +1,126 @@
+#include "tommath_private.h"
+#ifdef MP_MONT_EXPTMOD_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+
+/* Y = G**X mod n for X >= 0 with the modulus n of ctx
+ *
+ * Sliding window of s_mp_exptmod_window() in the Montgomery domain.  Nothing
+ * about n is computed again, G goes in and the result comes out with a single
+ * Montgomery multiplication each.
+ */
+
+#ifdef MP_LOW_MEM
+#   define MAX_WINSIZE 5
+#else
+#   define MAX_WINSIZE 8
+#endif
+
+/* the table entries are carved from one allocation and can not grow, their
+ * products go through t first
+ */
+typedef struct {
+   const mp_mont_ctx *m;
+   const mp_int      *res;
+   mp_int            *t;
+} s_ctx;
+
+static mp_err s_mul(const void *ctx, const void *a, const void *b, void *c)
+{
+   const s_ctx *e = (const s_ctx *)ctx;
+   mp_err err;
+
+   if (c == e->res) {
+      return mp_mont_mul(e->m, (const mp_int *)a, (const mp_int *)b, (mp_int *)c);
+   }
+   if ((err = mp_mont_mul(e->m, (const mp_int *)a, (const mp_int *)b, e->t)) != MP_OKAY) {
+      return err;
+   }
+   return mp_copy(e->t, (mp_int *)c);
+}
+
+static mp_err s_sqr(const void *ctx, const void *a, void *c)
+{
+   return mp_mont_sqr(((const s_ctx *)ctx)->m, (const mp_int *)a, (mp_int *)c);
+}
+
+static mp_err s_copy(const void *ctx, const void *a, void *c)
+{
+   (void)ctx;
+   return mp_copy((const mp_int *)a, (mp_int *)c);
+}
+
+mp_err mp_mont_exptmod(const mp_mont_ctx *ctx, const mp_int *G, const mp_int *X, mp_int *Y)
+{
+   mp_int    *M, res, t;
+   mp_digit  *dp;
+   mp_window w;
+   s_ctx     e;
+   mp_err    err;
+   size_t    size;
+   int       bits, winsize, half, digs, x;
+
+   if (mp_isneg(X)) {
+      return MP_VAL;
+   }
+
+   /* AVX-512 IFMA does the whole exponentiation in its own representation */
+   bits = mp_count_bits(&ctx->n);
+   if (MP_HAS(S_MP_EXPTMOD_IFMA) && s_mp_cpu_ifma() &&
+       (bits >= MP_IFMA_MIN_BITS) && (bits <= MP_IFMA_MAX_BITS)) {
+      return s_mp_exptmod_ifma(G, X, &ctx->n, mp_iszero(&ctx->ifma) ? NULL : &ctx->ifma, Y);
+   }
+
+   winsize = MP_MIN(MAX_WINSIZE, s_mp_exptmod_winsize(mp_count_bits(X)));
+   half = 1 << (winsize - 1);
+
+   /* the headers of the odd powers followed by their digits, all below n */
+   digs = MP_MAX(ctx->n.used, MP_MIN_DIGIT_COUNT);
+   size = (sizeof(mp_int) + (sizeof(mp_digit) * (size_t)digs)) * (size_t)half;
+   M = (mp_int *) MP_MALLOC(size);
+   if (M == NULL) {
+      return MP_MEM;
+   }
+   dp = (mp_digit *)(void *)(M + half);
+   for (x = 0; x < half; x++) {
+      M[x].dp = dp + ((size_t)x * (size_t)digs);
+      M[x].used = 0;
+      M[x].alloc = digs;
+      M[x].sign = MP_ZPOS;
+   }
+
+   if ((err = mp_init_size(&res, (2 * ctx->n.used) + 1)) != MP_OKAY) {
+      goto LBL_M;
+   }
+   if ((err = mp_init_size(&t, (2 * ctx->n.used) + 1)) != MP_OKAY) {
+      goto LBL_RES;
+   }
+
+   e.m = ctx;
+   e.res = &res;
+   e.t = &t;
+
+   w.mul = s_mul;
+   w.sqr = s_sqr;
+   w.copy = s_copy;
+   w.ctx = &e;
+   w.one = &ctx->r;
+   w.M = M;
+   w.res = &res;
+   w.size = sizeof(mp_int);
+
+   if ((err = mp_mont_to(ctx, G, &t)) != MP_OKAY)                         goto LBL_ERR;
+   if ((err = mp_copy(&t, &M[0])) != MP_OKAY)                             goto LBL_ERR;
+   if ((err = s_mp_exptmod_window(&w, X, winsize)) != MP_OKAY)            goto LBL_ERR;
+   err = mp_mont_from(ctx, &res, Y);
+
+LBL_ERR:
+   mp_clear(&t);
+LBL_RES:
+   mp_clear(&res);
+LBL_M:
+   MP_FREE_BUF(M, size);
+   return err;
+}
+#undef MAX_WINSIZE
+#endif
@@ -0,0 +1,19 @@
+#include "tommath_private.h"
+#ifdef MP_MONT_FROM_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+
+/* c = a / R mod n for 0 <= a < n, out of the Montgomery domain of ctx */
+mp_err mp_mont_from(const mp_mont_ctx *ctx, const mp_int *a, mp_int *c)
+{
+   mp_err err;
+
+   if ((err = mp_copy(a, c)) != MP_OKAY) {
+      return err;
+   }
+   if (!mp_iszero(&ctx->ninv)) {
+      return s_mp_montgomery_reduce_mul(c, &ctx->n, &ctx->ninv);
+   }
+   return mp_montgomery_reduce(c, &ctx->n, ctx->rho);
+}
+#endif
@@ -0,0 +1,42 @@
+#include "tommath_private.h"
+#ifdef MP_MONT_MUL_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+
+/* c = a * b / R mod n for 0 <= a, b < n in the Montgomery domain of ctx
+ *
+ * Small moduli get the product and the reduction fused into one pass,
+ * larger ones the subquadratic mp_mul() first.  From MP_REDUCE_MUL_CUTOFF
+ * digits on the reduction is made of multiplications, too.  Both expect
+ * operands of at most the digits of n, others are reduced modulo n first.
+ */
+mp_err mp_mont_mul(const mp_mont_ctx *ctx, const mp_int *a, const mp_int *b, mp_int *c)
+{
+   mp_err err;
+
+   if ((a->used > ctx->n.used) || (b->used > ctx->n.used) || mp_isneg(a) || mp_isneg(b)) {
+      mp_int t;
+      if ((err = mp_init(&t)) != MP_OKAY) {
+         return err;
+      }
+      if ((err = mp_mul(a, b, &t)) != MP_OKAY)                            goto LBL_ERR;
+      if ((err = mp_mod(&t, &ctx->n, &t)) != MP_OKAY)                     goto LBL_ERR;
+      err = mp_mont_from(ctx, &t, c);
+LBL_ERR:
+      mp_clear(&t);
+      return err;
+   }
+
+   if (MP_HAS(S_MP_MONT_MUL_COMBA) && (ctx->n.used < MP_MUL_KARATSUBA_CUTOFF) &&
+       !(MP_HAS(S_MP_MONTGOMERY_REDUCE_ADX) && s_mp_cpu_adx())) {
+      return s_mp_mont_mul_comba(a, b, c, &ctx->n, ctx->rho);
+   }
+   if ((err = mp_mul(a, b, c)) != MP_OKAY) {
+      return err;
+   }
+   if (!mp_iszero(&ctx->ninv)) {
+      return s_mp_montgomery_reduce_mul(c, &ctx->n, &ctx->ninv);
+   }
+   return mp_montgomery_reduce(c, &ctx->n, ctx->rho);
+}
+#endif
@@ -0,0 +1,27 @@
+#include "tommath_private.h"
+#ifdef MP_MONT_SQR_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+
+/* c = a * a / R mod n for 0 <= a < n in the Montgomery domain of ctx
+ *
+ * The squaring saves half of the products a fused pass could save, so the
+ * square and the reduction are kept apart.
+ */
+mp_err mp_mont_sqr(const mp_mont_ctx *ctx, const mp_int *a, mp_int *c)
+{
+   mp_err err;
+
+   /* operands beyond n are reduced first, see mp_mont_mul() */
+   if ((a->used > ctx->n.used) || mp_isneg(a)) {
+      return mp_mont_mul(ctx, a, a, c);
+   }
+   if ((err = mp_sqr(a, c)) != MP_OKAY) {
+      return err;
+   }
+   if (!mp_iszero(&ctx->ninv)) {
+      return s_mp_montgomery_reduce_mul(c, &ctx->n, &ctx->ninv);
+   }
+   return mp_montgomery_reduce(c, &ctx->n, ctx->rho);
+}
+#endif
@@ -0,0 +1,19 @@
+#include "tommath_private.h"
+#ifdef MP_MONT_TO_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+
+/* c = a * R mod n, a times R**2 in the Montgomery domain of ctx */
+mp_err mp_mont_to(const mp_mont_ctx *ctx, const mp_int *a, mp_int *c)
+{
+   mp_err err;
+
+   if (mp_isneg(a) || (mp_cmp_mag(a, &ctx->n) != MP_LT)) {
+      if ((err = mp_mod(a, &ctx->n, c)) != MP_OKAY) {
+         return err;
+      }
+      a = c;
+   }
+   return mp_mont_mul(ctx, a, &ctx->rr, c);
+}
+#endif
@@ -9,20 +9,16 @@ mp_err mp_montgomery_reduce(mp_int *x, const mp_int *n, mp_digit rho)
    mp_err err;
    int ix, digs;
 
-   /* can the fast reduction [comba] method be used?
-    *
-    * Note that unlike in mul you're safely allowed *less*
-    * than the available columns [255 per default] since carries
-    * are fixed up in the inner loop.
-    */
-   digs = (n->used * 2) + 1;
-   if ((digs < MP_WARRAY) &&
-       (x->used <= MP_WARRAY) &&
-       (n->used < MP_MAX_COMBA)) {
+   /* use the BMI2/ADX or the fast reduction [comba] method if available */
+   if (MP_HAS(S_MP_MONTGOMERY_REDUCE_ADX) && s_mp_cpu_adx()) {
+      return s_mp_montgomery_reduce_adx(x, n, rho);
+   }
+   if (MP_HAS(S_MP_MONTGOMERY_REDUCE_COMBA)) {
       return s_mp_montgomery_reduce_comba(x, n, rho);
    }
 
    /* grow the input as required */
+   digs = (n->used * 2) + 1;
    if ((err = mp_grow(x, digs)) != MP_OKAY) {
       return err;
    }
@@ -61,9 +57,9 @@ mp_err mp_montgomery_reduce(mp_int *x, const mp_int *n, mp_digit rho)
 
       /* propagate carries upwards as required*/
       while (u != 0u) {
-         x->dp[ix + iy]   += u;
-         u        = x->dp[ix + iy] >> MP_DIGIT_BIT;
-         x->dp[ix + iy] &= MP_MASK;
+         mp_word r = (mp_word)x->dp[ix + iy] + (mp_word)u;
+         u        = (mp_digit)(r >> (mp_word)MP_DIGIT_BIT);
+         x->dp[ix + iy] = (mp_digit)(r & (mp_word)MP_MASK);
          ++iy;
       }
    }
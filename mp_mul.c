@@ -13,49 +13,79 @@ mp_err mp_mul(const mp_int *a, const mp_int *b, mp_int *c)
    bool neg = (a->sign != b->sign);
 
    if ((a == b) &&
-       MP_HAS(S_MP_SQR_TOOM) && /* use Toom-Cook? */
-       (a->used >= MP_SQR_TOOM_CUTOFF)) {
-      err = s_mp_sqr_toom(a, c);
+       MP_HAS(S_MP_SQR_FFT) && /* use the number theoretic transform? */
+       (a->used >= MP_SQR_FFT_CUTOFF) &&
+       (digs <= MP_FFT_MAX_DIGIT_COUNT)) {
+      err = s_mp_sqr_fft(a, c);
+   } else if ((a == b) &&
+              MP_HAS(S_MP_SQR_TOOM) && /* with threads for the five sub-squares? */
+              (MP_MUL_WORKERS > 0) &&
+              ((a->used / 3) >= MP_MUL_PARALLEL_CUTOFF)) {
+      err = s_mp_sqr_toom(a, c, NULL);
+   } else if ((a == b) &&
+              MP_HAS(S_MP_SQR_TOOM4) && /* use Toom-Cook 4-way? */
+              (a->used >= MP_SQR_TOOM4_CUTOFF)) {
+      err = s_mp_sqr_toom4(a, c);
+   } else if ((a == b) &&
+              MP_HAS(S_MP_SQR_TOOM) && /* use Toom-Cook? */
+              (a->used >= MP_SQR_TOOM_CUTOFF)) {
+      err = s_mp_sqr_toom(a, c, NULL);
    } else if ((a == b) &&
               MP_HAS(S_MP_SQR_KARATSUBA) &&  /* Karatsuba? */
               (a->used >= MP_SQR_KARATSUBA_CUTOFF)) {
-      err = s_mp_sqr_karatsuba(a, c);
+      err = s_mp_sqr_karatsuba(a, c, NULL);
+   } else if ((a == b) &&
+              MP_HAS(S_MP_SQR_ADX) && /* x86-64 with BMI2/ADX? */
+              s_mp_cpu_adx()) {
+      err = s_mp_sqr_adx(a, c);
    } else if ((a == b) &&
-              MP_HAS(S_MP_SQR_COMBA) && /* can we use the fast comba multiplier? */
-              (((a->used * 2) + 1) < MP_WARRAY) &&
-              (a->used <= MP_MAX_COMBA)) {
+              MP_HAS(S_MP_SQR_COMBA)) { /* use the fast comba multiplier */
       err = s_mp_sqr_comba(a, c);
    } else if ((a == b) &&
               MP_HAS(S_MP_SQR)) {
       err = s_mp_sqr(a, c);
+   } else if (MP_HAS(S_MP_MUL_FFT) &&
+              /* The transform does not care about the ratio of the sizes */
+              (min >= MP_MUL_FFT_CUTOFF) &&
+              (digs <= MP_FFT_MAX_DIGIT_COUNT)) {
+      err = s_mp_mul_fft(a, b, c);
+   } else if (MP_HAS(S_MP_MUL_TOOM) && /* with threads for the five sub-products? */
+              (MP_MUL_WORKERS > 0) &&
+              ((min / 3) >= MP_MUL_PARALLEL_CUTOFF) &&
+              ((4 * max) < (5 * min))) {
+      err = s_mp_mul_toom(a, b, c, NULL);
    } else if (MP_HAS(S_MP_MUL_BALANCE) &&
-              /* Check sizes. The smaller one needs to be larger than the Karatsuba cut-off.
-               * The bigger one needs to be at least about one MP_MUL_KARATSUBA_CUTOFF bigger
-               * to make some sense, but it depends on architecture, OS, position of the
-               * stars... so YMMV.
-               * Using it to cut the input into slices small enough for s_mp_mul_comba
-               * was actually slower on the author's machine, but YMMV.
+              /* The unbalanced Toom-Cook variants below are chosen by the ratio of
+               * the sizes. Anything beyond 5:2 gets cut into 2:1 slices first.
                */
               (min >= MP_MUL_KARATSUBA_CUTOFF) &&
-              ((max / 2) >= MP_MUL_KARATSUBA_CUTOFF) &&
-              /* Not much effect was observed below a ratio of 1:2, but again: YMMV. */
-              (max >= (2 * min))) {
-      err = s_mp_mul_balance(a,b,c);
+              ((2 * max) >= (5 * min))) {
+      err = s_mp_mul_balance(a, b, c);
+   } else if (MP_HAS(S_MP_MUL_TOOM42) &&
+              (min >= MP_MUL_KARATSUBA_CUTOFF) &&
+              ((4 * max) >= (7 * min))) {
+      err = s_mp_mul_toom42(a, b, c);
+   } else if (MP_HAS(S_MP_MUL_TOOM53) &&
+              (min >= MP_MUL_TOOM_CUTOFF) &&
+              ((4 * max) >= (5 * min))) {
+      err = s_mp_mul_toom53(a, b, c);
+   } else if (MP_HAS(S_MP_MUL_TOOM32) &&
+              (min >= MP_MUL_KARATSUBA_CUTOFF) &&
+              ((4 * max) >= (5 * min))) {
+      err = s_mp_mul_toom32(a, b, c);
+   } else if (MP_HAS(S_MP_MUL_TOOM4) &&
+              (min >= MP_MUL_TOOM4_CUTOFF)) {
+      err = s_mp_mul_toom4(a, b, c);
    } else if (MP_HAS(S_MP_MUL_TOOM) &&
               (min >= MP_MUL_TOOM_CUTOFF)) {
-      err = s_mp_mul_toom(a, b, c);
+      err = s_mp_mul_toom(a, b, c, NULL);
    } else if (MP_HAS(S_MP_MUL_KARATSUBA) &&
               (min >= MP_MUL_KARATSUBA_CUTOFF)) {
-      err = s_mp_mul_karatsuba(a, b, c);
-   } else if (MP_HAS(S_MP_MUL_COMBA) &&
-              /* can we use the fast multiplier?
-               *
-               * The fast multiplier can be used if the output will
-               * have less than MP_WARRAY digits and the number of
-               * digits won't affect carry propagation
-               */
-              (digs < MP_WARRAY) &&
-              (min <= MP_MAX_COMBA)) {
+      err = s_mp_mul_karatsuba(a, b, c, NULL);
+   } else if (MP_HAS(S_MP_MUL_ADX) && /* x86-64 with BMI2/ADX? */
+              s_mp_cpu_adx()) {
+      err = s_mp_mul_adx(a, b, c, digs);
+   } else if (MP_HAS(S_MP_MUL_COMBA)) { /* use the fast comba multiplier */
       err = s_mp_mul_comba(a, b, c, digs);
    } else if (MP_HAS(S_MP_MUL)) {
       err = s_mp_mul(a, b, c, digs);
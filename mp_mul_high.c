@@ -0,0 +1,66 @@
+#include "tommath_private.h"
+#ifdef MP_MUL_HIGH_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+
+/* c = a * b / B**digs, the product without its lower digs digits (handles sign)
+ *
+ * The same as mp_mul() followed by mp_rshd(c, digs).  The short product
+ * leaves out the products of the digits at i and j with i+j < digs - g,
+ * which is less than n * B**(digs-g+1) with n = min(a->used, b->used).
+ * With B**(g-1) > 16n the g guard digits tell if that could have carried
+ * into the digit at digs, only then the full product is needed.
+ *
+ * Leaving out less than 0.45 of the digits of a balanced product doesn't
+ * pay, neither does it against the FFT.
+ */
+mp_err mp_mul_high(const mp_int *a, const mp_int *b, int digs, mp_int *c)
+{
+   mp_int  t, r, u;
+   mp_err  err;
+   int     n = MP_MIN(a->used, b->used), g;
+   mp_word w;
+   bool    neg = (a->sign != b->sign);
+
+   if (digs < 0) {
+      return MP_VAL;
+   }
+
+   /* the number of guard digits, one more than the digits of 16n */
+   g = 1;
+   for (w = (mp_word)n << 4; w > 0u; w >>= MP_DIGIT_BIT) {
+      g++;
+   }
+
+   if ((err = mp_init_multi(&t, &r, &u, NULL)) != MP_OKAY) {
+      return err;
+   }
+
+   if ((digs > g) && ((10 * digs) >= (9 * n)) &&
+       !(MP_HAS(S_MP_MUL_FFT) && (n >= MP_MUL_FFT_CUTOFF))) {
+      if ((err = s_mp_mul_high(a, b, &t, digs - g)) != MP_OKAY)     goto LBL_ERR;
+
+      /* r = the digits digs-g+1 ... digs-1, no carry reaches digs if r + n + 1 < B**(g-1) */
+      if ((err = mp_grow(&r, g - 1)) != MP_OKAY)                     goto LBL_ERR;
+      r.used = MP_MAX(MP_MIN(t.used, digs) - (digs - g + 1), 0);
+      s_mp_copy_digs(r.dp, t.dp + (digs - g + 1), r.used);
+      mp_clamp(&r);
+      mp_set_l(&u, (long)n + 1L);
+      if ((err = s_mp_add(&r, &u, &r)) != MP_OKAY)                   goto LBL_ERR;
+      if (r.used >= g) {
+         /* too close to a carry */
+         if ((err = mp_mul(a, b, &t)) != MP_OKAY)                    goto LBL_ERR;
+      }
+   } else {
+      if ((err = mp_mul(a, b, &t)) != MP_OKAY)                       goto LBL_ERR;
+   }
+
+   mp_rshd(&t, digs);
+   t.sign = ((t.used > 0) && neg) ? MP_NEG : MP_ZPOS;
+   mp_exch(&t, c);
+
+LBL_ERR:
+   mp_clear_multi(&t, &r, &u, NULL);
+   return err;
+}
+#endif
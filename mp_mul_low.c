@@ -0,0 +1,44 @@
+#include "tommath_private.h"
+#ifdef MP_MUL_LOW_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+
+/* c = a * b mod B**digs, the lower digs digits of the product (handles sign)
+ *
+ * The same as mp_mul() followed by mp_mod_2d(c, digs * MP_DIGIT_BIT, c)
+ * but without computing the higher digits, except against the FFT.
+ */
+mp_err mp_mul_low(const mp_int *a, const mp_int *b, int digs, mp_int *c)
+{
+   mp_err err;
+   int min = MP_MIN(MP_MIN(a->used, b->used), digs);
+   bool neg = (a->sign != b->sign);
+
+   if (digs < 0) {
+      return MP_VAL;
+   }
+
+   if (digs >= (a->used + b->used)) {
+      /* nothing to leave out */
+      err = mp_mul(a, b, c);
+   } else if (MP_HAS(S_MP_MUL_FFT) && (min >= MP_MUL_FFT_CUTOFF)) {
+      if ((err = mp_mul(a, b, c)) == MP_OKAY) {
+         err = mp_mod_2d(c, digs * MP_DIGIT_BIT, c);
+      }
+   } else if (MP_HAS(S_MP_MUL_LOW_MULDERS) &&
+              (min >= MP_MUL_LOW_CUTOFF)) {
+      err = s_mp_mul_low_mulders(a, b, c, digs);
+   } else if (MP_HAS(S_MP_MUL_ADX) && /* x86-64 with BMI2/ADX? */
+              s_mp_cpu_adx()) {
+      err = s_mp_mul_adx(a, b, c, digs);
+   } else if (MP_HAS(S_MP_MUL_COMBA)) {
+      err = s_mp_mul_comba(a, b, c, digs);
+   } else if (MP_HAS(S_MP_MUL)) {
+      err = s_mp_mul(a, b, c, digs);
+   } else {
+      err = MP_VAL;
+   }
+   c->sign = ((c->used > 0) && neg) ? MP_NEG : MP_ZPOS;
+   return err;
+}
+#endif
@@ -0,0 +1,91 @@
+#include "tommath_private.h"
+#ifdef MP_MUL_THREADS_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+
+/* Starts the worker threads that compute the independent sub-products of
+ * the Karatsuba and Toom-Cook levels with at least MP_MUL_PARALLEL_CUTOFF
+ * digits concurrently, see s_mp_mul_parallel(), and the three primes of
+ * s_mp_mul_fft().  Replaces the old ones, 0 stops them.
+ *
+ * Must not be called while another thread multiplies.
+ */
+#ifdef MP_USE_PTHREADS
+
+/* arbitrary, keeps the size of the array of the threads sane */
+#define S_MAX_THREADS 1024
+
+mp_mul_pool s_mp_mul_pool = {
+   PTHREAD_MUTEX_INITIALIZER, PTHREAD_COND_INITIALIZER, PTHREAD_COND_INITIALIZER, NULL, 0, false, NULL
+};
+
+static void *s_worker(void *arg)
+{
+   (void)arg;
+   pthread_mutex_lock(&s_mp_mul_pool.lock);
+   while (!s_mp_mul_pool.stop) {
+      if (!s_mp_mul_task_run()) {
+         pthread_cond_wait(&s_mp_mul_pool.work, &s_mp_mul_pool.lock);
+      }
+   }
+   pthread_mutex_unlock(&s_mp_mul_pool.lock);
+   return NULL;
+}
+
+static void s_stop(int size)
+{
+   int i;
+   pthread_mutex_lock(&s_mp_mul_pool.lock);
+   s_mp_mul_pool.stop = true;
+   pthread_cond_broadcast(&s_mp_mul_pool.work);
+   pthread_mutex_unlock(&s_mp_mul_pool.lock);
+   for (i = 0; i < s_mp_mul_pool.workers; i++) {
+      pthread_join(s_mp_mul_pool.threads[i], NULL);
+   }
+   MP_FREE_BUF(s_mp_mul_pool.threads, sizeof(pthread_t) * (size_t)size);
+   s_mp_mul_pool.threads = NULL;
+   s_mp_mul_pool.workers = 0;
+   s_mp_mul_pool.stop = false;
+}
+
+mp_err mp_mul_threads(int threads)
+{
+   int i;
+
+   if ((threads < 0) || (threads > S_MAX_THREADS)) {
+      return MP_VAL;
+   }
+
+   if (s_mp_mul_pool.threads != NULL) {
+      s_stop(s_mp_mul_pool.workers);
+   }
+   if (threads == 0) {
+      return MP_OKAY;
+   }
+
+   s_mp_mul_pool.threads = (pthread_t *) MP_MALLOC(sizeof(pthread_t) * (size_t)threads);
+   if (s_mp_mul_pool.threads == NULL) {
+      return MP_MEM;
+   }
+
+   for (i = 0; i < threads; i++) {
+      if (pthread_create(&s_mp_mul_pool.threads[i], NULL, s_worker, NULL) != 0) {
+         s_stop(threads);
+         return MP_ERR;
+      }
+      s_mp_mul_pool.workers = i + 1;
+   }
+
+   return MP_OKAY;
+}
+
+#else
+
+mp_err mp_mul_threads(int threads)
+{
+   /* without threads only none of them works */
+   return (threads == 0) ? MP_OKAY : MP_VAL;
+}
+
+#endif
+#endif
@@ -7,6 +7,13 @@
 mp_err mp_mulmod(const mp_int *a, const mp_int *b, const mp_int *c, mp_int *d)
 {
    mp_err err;
+   int    form;
+
+   /* generalized Mersenne moduli are reduced with word shifts and additions */
+   if (MP_HAS(S_MP_SOLINAS_MULMOD) && s_mp_solinas_find(c, &form)) {
+      return s_mp_solinas_mulmod(a, b, c, d, form);
+   }
+
    if ((err = mp_mul(a, b, d)) != MP_OKAY) {
       return err;
    }
@@ -61,11 +61,9 @@ mp_err mp_prime_next_prime(mp_int *a, int t, bool bbs_style)
       }
    }
 
-   /* generate the restable */
-   for (x = 1; x < MP_PRIME_TAB_SIZE; x++) {
-      if ((err = mp_mod_d(a, s_mp_prime_tab[x], res_tab + x)) != MP_OKAY) {
-         return err;
-      }
+   /* generate the restable, in one pass over a */
+   if ((err = s_mp_mod_d_multi(a, s_mp_prime_tab + 1, MP_PRIME_TAB_SIZE - 1, res_tab + 1)) != MP_OKAY) {
+      return err;
    }
 
    /* init temp used for Miller-Rabin Testing */
@@ -99,7 +97,7 @@ mp_err mp_prime_next_prime(mp_int *a, int t, bool bbs_style)
                y = true;
             }
          }
-      } while (y && (step < (((mp_digit)1 << MP_DIGIT_BIT) - kstep)));
+      } while (y && (step < ((MP_DIGIT_MAX - kstep) + 1u)));
 
       /* add the step */
       if ((err = mp_add_d(a, step, a)) != MP_OKAY) {
@@ -107,7 +105,7 @@ mp_err mp_prime_next_prime(mp_int *a, int t, bool bbs_style)
       }
 
       /* if didn't pass sieve and step == MP_MAX then skip test */
-      if (y && (step >= (((mp_digit)1 << MP_DIGIT_BIT) - kstep))) {
+      if (y && (step >= ((MP_DIGIT_MAX - kstep) + 1u))) {
          continue;
       }
 
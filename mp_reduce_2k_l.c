@@ -9,43 +9,14 @@
 */
 mp_err mp_reduce_2k_l(mp_int *a, const mp_int *n, const mp_int *d)
 {
-   mp_int q;
+   mp_int q, t;
    mp_err err;
-   int    p;
 
-   if ((err = mp_init(&q)) != MP_OKAY) {
+   if ((err = mp_init_multi(&q, &t, NULL)) != MP_OKAY) {
       return err;
    }
-
-   p = mp_count_bits(n);
-
-   for (;;) {
-      /* q = a/2**p, a = a mod 2**p */
-      if ((err = mp_div_2d(a, p, &q, a)) != MP_OKAY) {
-         goto LBL_ERR;
-      }
-
-      /* q = q * d */
-      if ((err = mp_mul(&q, d, &q)) != MP_OKAY) {
-         goto LBL_ERR;
-      }
-
-      /* a = a + q */
-      if ((err = s_mp_add(a, &q, a)) != MP_OKAY) {
-         goto LBL_ERR;
-      }
-
-      if (mp_cmp_mag(a, n) == MP_LT) {
-         break;
-      }
-      if ((err = s_mp_sub(a, n, a)) != MP_OKAY) {
-         goto LBL_ERR;
-      }
-
-   }
-
-LBL_ERR:
-   mp_clear(&q);
+   err = s_mp_reduce_2k_l(a, n, d, &q, &t);
+   mp_clear_multi(&q, &t, NULL);
    return err;
 }
 
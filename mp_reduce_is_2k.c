@@ -26,8 +26,9 @@ bool mp_reduce_is_2k(const mp_int *a)
          if ((a->dp[iw] & iz) == 0u) {
             return false;
          }
-         iz <<= 1;
-         if (iz > MP_DIGIT_MAX) {
+         /* masked, full digits have no bit above the mask to compare */
+         iz = (iz << 1) & MP_DIGIT_MAX;
+         if (iz == 0u) {
             ++iw;
             iz = 1;
          }
@@ -7,6 +7,13 @@
 mp_err mp_sqrmod(const mp_int *a, const mp_int *b, mp_int *c)
 {
    mp_err err;
+   int    form;
+
+   /* generalized Mersenne moduli are reduced with word shifts and additions */
+   if (MP_HAS(S_MP_SOLINAS_MULMOD) && s_mp_solinas_find(b, &form)) {
+      return s_mp_solinas_mulmod(a, a, b, c, form);
+   }
+
    if ((err = mp_sqr(a, c)) != MP_OKAY) {
       return err;
    }
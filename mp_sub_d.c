@@ -12,7 +12,7 @@ mp_err mp_sub_d(const mp_int *a, mp_digit b, mp_int *c)
    /* fast path for a == c */
    if (a == c) {
       if ((c->sign == MP_NEG) &&
-          ((c->dp[0] + b) < MP_DIGIT_MAX)) {
+          (((mp_word)c->dp[0] + (mp_word)b) < (mp_word)MP_DIGIT_MAX)) {
          c->dp[0] += b;
          return MP_OKAY;
       }
@@ -62,9 +62,9 @@ mp_err mp_sub_d(const mp_int *a, mp_digit b, mp_int *c)
 
       /* subtract digits, mu is carry */
       for (i = 0; i < a->used; i++) {
-         c->dp[i] = a->dp[i] - mu;
-         mu = c->dp[i] >> (MP_SIZEOF_BITS(mp_digit) - 1u);
-         c->dp[i] &= MP_MASK;
+         mp_word t = (mp_word)a->dp[i] - (mp_word)mu;
+         mu = (mp_digit)(t >> (MP_SIZEOF_BITS(mp_word) - 1u));
+         c->dp[i] = (mp_digit)(t & (mp_word)MP_MASK);
       }
    }
 
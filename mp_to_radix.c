@@ -24,7 +24,8 @@ mp_err mp_to_radix(const mp_int *a, char *str, size_t maxlen, size_t *written, i
    size_t  digs;
    mp_err  err;
    mp_int  t;
-   mp_digit d;
+   mp_digit d, big;
+   int     i, k;
    char   *_s = str;
 
    /* check range of radix and size*/
@@ -61,18 +62,28 @@ mp_err mp_to_radix(const mp_int *a, char *str, size_t maxlen, size_t *written, i
       /* subtract a char */
       --maxlen;
    }
+   /* divide by the largest power radix**k below B and take the k digits of
+    * each remainder, all but the leading ones of the last
+    */
+   big = (mp_digit)radix;
+   for (k = 1; big <= (MP_MASK / (mp_digit)radix); k++) {
+      big *= (mp_digit)radix;
+   }
    digs = 0u;
    while (!mp_iszero(&t)) {
-      if (--maxlen < 1u) {
-         /* no more room */
-         err = MP_BUF;
+      if ((err = mp_div_d(&t, big, &t, &d)) != MP_OKAY) {
          goto LBL_ERR;
       }
-      if ((err = mp_div_d(&t, (mp_digit)radix, &t, &d)) != MP_OKAY) {
-         goto LBL_ERR;
+      for (i = 0; (i < k) && (!mp_iszero(&t) || (d != 0u)); i++) {
+         if (--maxlen < 1u) {
+            /* no more room */
+            err = MP_BUF;
+            goto LBL_ERR;
+         }
+         *str++ = s_mp_radix_map[d % (mp_digit)radix];
+         d /= (mp_digit)radix;
+         ++digs;
       }
-      *str++ = s_mp_radix_map[d];
-      ++digs;
    }
    /* reverse the digits of the string.  In this case _s points
     * to the first digit [excluding the sign] of the number
@@ -33,13 +33,13 @@ mp_err s_mp_add(const mp_int *a, const mp_int *b, mp_int *c)
    u = 0;
    for (i = 0; i < min; i++) {
       /* Compute the sum at one digit, T[i] = A[i] + B[i] + U */
-      c->dp[i] = a->dp[i] + b->dp[i] + u;
+      mp_word t = (mp_word)a->dp[i] + (mp_word)b->dp[i] + (mp_word)u;
 
       /* U = carry bit of T[i] */
-      u = c->dp[i] >> (mp_digit)MP_DIGIT_BIT;
+      u = (mp_digit)(t >> (mp_word)MP_DIGIT_BIT);
 
       /* take away carry bit from T[i] */
-      c->dp[i] &= MP_MASK;
+      c->dp[i] = (mp_digit)(t & (mp_word)MP_MASK);
    }
 
    /* now copy higher words if any, that is in A+B
@@ -48,13 +48,13 @@ mp_err s_mp_add(const mp_int *a, const mp_int *b, mp_int *c)
    if (min != max) {
       for (; i < max; i++) {
          /* T[i] = A[i] + U */
-         c->dp[i] = a->dp[i] + u;
+         mp_word t = (mp_word)a->dp[i] + (mp_word)u;
 
          /* U = carry bit of T[i] */
-         u = c->dp[i] >> (mp_digit)MP_DIGIT_BIT;
+         u = (mp_digit)(t >> (mp_word)MP_DIGIT_BIT);
 
          /* take away carry bit from T[i] */
-         c->dp[i] &= MP_MASK;
+         c->dp[i] = (mp_digit)(t & (mp_word)MP_MASK);
       }
    }
 
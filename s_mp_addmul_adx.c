@@ -0,0 +1,86 @@
+#include "tommath_private.h"
+#ifdef S_MP_ADDMUL_ADX_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+
+/* r[0..n-1] += a[0..n-1] * b, returns the carry digit
+ *
+ * With MP_ADX_ASM this is the x86-64 inner loop of the row-wise
+ * multipliers.  MULX leaves the flags alone, so the high half of the
+ * previous product is added with ADCX (carry flag) and the digit of r
+ * with ADOX (overflow flag), two independent carry chains.  The loop is
+ * unrolled four times, the counter is tested with JRCXZ which keeps the
+ * flags as well.
+ *
+ * Must only be called if s_mp_cpu_adx() returned true.  The portable
+ * loop is used otherwise.
+ */
+mp_digit s_mp_addmul_adx(mp_digit *r, const mp_digit *a, int n, mp_digit b)
+{
+#ifdef MP_ADX_ASM
+   mp_digit lo, hi, c = 0;
+   long m = (long)(n & 3), q = (long)(n >> 2);
+
+   __asm__ volatile(
+      /* the first n mod 4 digits with a single carry chain */
+      "testq %[m], %[m]\n\t"
+      "jz 2f\n"
+      "1:\n\t"
+      "mulx (%[a]), %[lo], %[hi]\n\t"
+      "addq %[c], %[lo]\n\t"
+      "adcq $0, %[hi]\n\t"
+      "addq %[lo], (%[r])\n\t"
+      "adcq $0, %[hi]\n\t"
+      "movq %[hi], %[c]\n\t"
+      "leaq 8(%[a]), %[a]\n\t"
+      "leaq 8(%[r]), %[r]\n\t"
+      "decq %[m]\n\t"
+      "jnz 1b\n"
+      "2:\n\t"
+      /* clears CF and OF */
+      "xorl %k[m], %k[m]\n\t"
+      "jrcxz 4f\n"
+      "3:\n\t"
+      "mulx (%[a]), %[lo], %[hi]\n\t"
+      "adcx %[c], %[lo]\n\t"
+      "adox (%[r]), %[lo]\n\t"
+      "movq %[lo], (%[r])\n\t"
+      "mulx 8(%[a]), %[lo], %[c]\n\t"
+      "adcx %[hi], %[lo]\n\t"
+      "adox 8(%[r]), %[lo]\n\t"
+      "movq %[lo], 8(%[r])\n\t"
+      "mulx 16(%[a]), %[lo], %[hi]\n\t"
+      "adcx %[c], %[lo]\n\t"
+      "adox 16(%[r]), %[lo]\n\t"
+      "movq %[lo], 16(%[r])\n\t"
+      "mulx 24(%[a]), %[lo], %[c]\n\t"
+      "adcx %[hi], %[lo]\n\t"
+      "adox 24(%[r]), %[lo]\n\t"
+      "movq %[lo], 24(%[r])\n\t"
+      "leaq 32(%[a]), %[a]\n\t"
+      "leaq 32(%[r]), %[r]\n\t"
+      "leaq -1(%%rcx), %%rcx\n\t"
+      "jrcxz 5f\n\t"
+      "jmp 3b\n"
+      "5:\n\t"
+      /* a*b + r + c always fits into two digits, no carry is lost */
+      "adcx %[m], %[c]\n\t"
+      "adox %[m], %[c]\n"
+      "4:\n"
+      : [a] "+r"(a), [r] "+r"(r), [c] "+r"(c), [lo] "=&r"(lo), [hi] "=&r"(hi),
+      [m] "+r"(m), "+c"(q)
+      : "d"(b)
+      : "cc", "memory");
+   return c;
+#else
+   mp_digit u = 0;
+   int ix;
+   for (ix = 0; ix < n; ix++) {
+      mp_word t = ((mp_word)a[ix] * (mp_word)b) + (mp_word)r[ix] + (mp_word)u;
+      r[ix] = (mp_digit)(t & (mp_word)MP_MASK);
+      u     = (mp_digit)(t >> (mp_word)MP_DIGIT_BIT);
+   }
+   return u;
+#endif
+}
+#endif
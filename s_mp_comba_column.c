@@ -0,0 +1,28 @@
+#include "tommath_private.h"
+#ifdef S_MP_COMBA_COLUMN_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+
+/* the sum of x[i] * y[-i] for 0 <= i < n, for the columns of the comba
+ * kernels that are too long for one mp_word, see MP_COMBA_FOLD
+ *
+ * Returns the sum below B**2, the digit above it goes to hi.
+ */
+mp_word s_mp_comba_column(const mp_digit *x, const mp_digit *y, int n, mp_digit *hi)
+{
+   mp_word  _W = 0;
+   mp_digit _C = 0;
+   int      ix, iw;
+
+   for (ix = 0; ix < n;) {
+      iw = ix + MP_MIN(n - ix, MP_COMBA_BLOCK);
+      for (; ix < iw; ix++) {
+         MP_COMBA_ADD(_W, _C, (mp_word)x[ix] * (mp_word)y[-ix]);
+      }
+      MP_COMBA_FOLD(_W, _C);
+   }
+
+   *hi = _C;
+   return _W;
+}
+#endif
@@ -0,0 +1,35 @@
+#include "tommath_private.h"
+#ifdef S_MP_CPU_ADX_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+
+#ifdef MP_ADX_ASM
+#include <cpuid.h>
+#endif
+
+/* Does the CPU offer MULX (BMI2) and ADCX/ADOX (ADX)?
+ *
+ * The answer of CPUID is cached, the instruction is slow, especially
+ * inside of virtual machines.  The cache is read and written atomically,
+ * threads that race on the first call all store the same answer.
+ */
+bool s_mp_cpu_adx(void)
+{
+#ifdef MP_ADX_ASM
+   static int has_adx = -1;
+   int has = __atomic_load_n(&has_adx, __ATOMIC_RELAXED);
+   if (has < 0) {
+      unsigned int eax, ebx = 0, ecx, edx;
+      if (__get_cpuid_max(0u, NULL) >= 7u) {
+         __cpuid_count(7u, 0u, eax, ebx, ecx, edx);
+      }
+      /* EBX bit 8 is BMI2, bit 19 is ADX */
+      has = ((ebx & (1u << 8)) != 0u) && ((ebx & (1u << 19)) != 0u);
+      __atomic_store_n(&has_adx, has, __ATOMIC_RELAXED);
+   }
+   return has != 0;
+#else
+   return false;
+#endif
+}
+#endif
@@ -0,0 +1,39 @@
+#include "tommath_private.h"
+#ifdef S_MP_CPU_IFMA_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+
+#ifdef MP_IFMA_INTRIN
+#include <cpuid.h>
+#endif
+
+/* Does the CPU offer AVX-512F and AVX-512 IFMA and does the OS save the
+ * ZMM registers?
+ *
+ * The answer is cached atomically like in s_mp_cpu_adx().
+ */
+bool s_mp_cpu_ifma(void)
+{
+#ifdef MP_IFMA_INTRIN
+   static int has_ifma = -1;
+   int has = __atomic_load_n(&has_ifma, __ATOMIC_RELAXED);
+   if (has < 0) {
+      unsigned int eax, ebx, ecx = 0, edx, xcr0 = 0;
+      has = 0;
+      if (__get_cpuid(1u, &eax, &ebx, &ecx, &edx) && ((ecx & (1u << 27)) != 0u)) {
+         /* OSXSAVE, XCR0 has to enable the SSE, AVX, opmask and ZMM state */
+         __asm__("xgetbv" : "=a"(xcr0), "=d"(edx) : "c"(0u));
+      }
+      if (((xcr0 & 0xE6u) == 0xE6u) && (__get_cpuid_max(0u, NULL) >= 7u)) {
+         __cpuid_count(7u, 0u, eax, ebx, ecx, edx);
+         /* EBX bit 16 is AVX-512F, bit 21 is AVX-512 IFMA */
+         has = ((ebx & (1u << 16)) != 0u) && ((ebx & (1u << 21)) != 0u);
+      }
+      __atomic_store_n(&has_ifma, has, __ATOMIC_RELAXED);
+   }
+   return has != 0;
+#else
+   return false;
+#endif
+}
+#endif
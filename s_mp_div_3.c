@@ -3,32 +3,39 @@
 /* LibTomMath, multiple-precision integer library -- Tom St Denis */
 /* SPDX-License-Identifier: Unlicense */
 
-/* divide by three (based on routine from MPI and the GMP manual) */
+/* divide by three (based on routine from MPI and the GMP manual)
+ *
+ * The quotient is written in place, digit by digit from the top, so c
+ * may be a and is not exchanged with a temporary.
+ */
 mp_err s_mp_div_3(const mp_int *a, mp_int *c, mp_digit *d)
 {
-   mp_int   q;
    mp_word  w;
    mp_digit b;
    mp_err   err;
-   int      ix;
+   int      ix, used = a->used, oldused = 0;
 
    /* b = 2**MP_DIGIT_BIT / 3 */
    b = ((mp_word)1 << (mp_word)MP_DIGIT_BIT) / (mp_word)3;
 
-   if ((err = mp_init_size(&q, a->used)) != MP_OKAY) {
-      return err;
+   if (c != NULL) {
+      if ((err = mp_grow(c, used)) != MP_OKAY) {
+         return err;
+      }
+      oldused = c->used;
+      c->used = used;
+      c->sign = a->sign;
    }
 
-   q.used = a->used;
-   q.sign = a->sign;
    w = 0;
-   for (ix = a->used; ix --> 0;) {
+   for (ix = used; ix --> 0;) {
       mp_word t;
       w = (w << (mp_word)MP_DIGIT_BIT) | (mp_word)a->dp[ix];
 
       if (w >= 3u) {
-         /* multiply w by [1/3] */
-         t = (w * (mp_word)b) >> (mp_word)MP_DIGIT_BIT;
+         /* multiply w by [1/3], split at the digit such that it does not overflow */
+         t = ((w >> (mp_word)MP_DIGIT_BIT) * (mp_word)b) +
+             (((w & (mp_word)MP_MASK) * (mp_word)b) >> (mp_word)MP_DIGIT_BIT);
 
          /* now subtract 3 * [w/3] from w, to get the remainder */
          w -= t+t+t;
@@ -43,7 +50,9 @@ mp_err s_mp_div_3(const mp_int *a, mp_int *c, mp_digit *d)
       } else {
          t = 0;
       }
-      q.dp[ix] = (mp_digit)t;
+      if (c != NULL) {
+         c->dp[ix] = (mp_digit)t;
+      }
    }
 
    /* [optional] store the remainder */
@@ -51,12 +60,11 @@ mp_err s_mp_div_3(const mp_int *a, mp_int *c, mp_digit *d)
       *d = (mp_digit)w;
    }
 
-   /* [optional] store the quotient */
+   /* [optional] finish the quotient */
    if (c != NULL) {
-      mp_clamp(&q);
-      mp_exch(&q, c);
+      s_mp_zero_digs(c->dp + c->used, oldused - c->used);
+      mp_clamp(c);
    }
-   mp_clear(&q);
 
    return MP_OKAY;
 }
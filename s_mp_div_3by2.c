@@ -0,0 +1,42 @@
+#include "tommath_private.h"
+#ifdef S_MP_DIV_3BY2_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+
+/* <u2,u1,u0> / <d1,d0> for <u2,u1> < <d1,d0> and the normalized d1 >= B/2
+ * with the reciprocal v = (B**3 - 1) / <d1,d0> - B, no division needed.
+ *
+ * With d0 = 0 the same v is (B**2 - 1) / d1 - B and this the division of
+ * <u2,u1> by d1.
+ *
+ * Algorithm 5 of: Moeller, Niels, and Torbjoern Granlund. "Improved division
+ * by invariant integers." IEEE Transactions on Computers 60.2 (2011)
+ */
+mp_digit s_mp_div_3by2(mp_digit u2, mp_digit u1, mp_digit u0, mp_digit d1, mp_digit d0, mp_digit v)
+{
+   const mp_word d = ((mp_word)d1 << MP_DIGIT_BIT) | (mp_word)d0,
+                 mask = ((mp_word)MP_MASK << MP_DIGIT_BIT) | (mp_word)MP_MASK;
+   mp_word q, r;
+   mp_digit q1, q0, r1;
+
+   /* <q1,q0> = v*u2 + <u2,u1> which is less than B**2 */
+   q = ((mp_word)v * (mp_word)u2) + (((mp_word)u2 << MP_DIGIT_BIT) | (mp_word)u1);
+   q1 = (mp_digit)(q >> MP_DIGIT_BIT);
+   q0 = (mp_digit)q & MP_MASK;
+
+   /* <r1,r0> = <u1 - q1*d1, u0> - q1*d0 - d mod B**2 */
+   r1 = (mp_digit)(u1 - (q1 * d1)) & MP_MASK;
+   r = ((((mp_word)r1 << MP_DIGIT_BIT) | (mp_word)u0) - ((mp_word)q1 * (mp_word)d0) - d) & mask;
+   q1 = (q1 + 1u) & MP_MASK;
+
+   /* q1 + 1 is likely one too big, rarely one too small */
+   if ((mp_digit)(r >> MP_DIGIT_BIT) >= q0) {
+      q1 = (q1 - 1u) & MP_MASK;
+      r = (r + d) & mask;
+   }
+   if (r >= d) {
+      q1++;
+   }
+   return q1;
+}
+#endif
@@ -0,0 +1,105 @@
+#include "tommath_private.h"
+#ifdef S_MP_DIV_BARRETT_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+
+/* q = A / b, r = A % b with the reciprocal x of the upper p digits of b for
+ * 0 <= A < B**(2n) if p = n, else 0 <= A < b*B**(p-2).
+ *
+ * The estimate of Barrett's algorithm is off by a few units at most, in
+ * either direction with the shortened divisor or the inexact reciprocal.
+ * The remainder is that small then, only its lower digits are computed.
+ */
+static mp_err s_step(const mp_int *A, const mp_int *b, const mp_int *x, int p, mp_int *q, mp_int *r)
+{
+   mp_int t;
+   mp_err err;
+   int n = b->used;
+
+   if ((err = mp_init(&t)) != MP_OKAY) {
+      return err;
+   }
+
+   /* q = (A / B**(n-1)) * x / B**(p+1) */
+   if ((err = mp_copy(A, &t)) != MP_OKAY)                                 goto LBL_ERR;
+   mp_rshd(&t, n - 1);
+   if ((err = mp_mul_high(&t, x, p + 1, q)) != MP_OKAY)                   goto LBL_ERR;
+
+   /* r = A - q*b from the digits below B**(n+2) which is far beyond |r| */
+   if ((err = mp_mul_low(q, b, n + 2, &t)) != MP_OKAY)                    goto LBL_ERR;
+   if ((err = mp_mod_2d(A, (n + 2) * MP_DIGIT_BIT, r)) != MP_OKAY)        goto LBL_ERR;
+   if ((err = mp_sub(r, &t, r)) != MP_OKAY)                               goto LBL_ERR;
+   if (mp_count_bits(r) >= ((n + 2) * MP_DIGIT_BIT)) {
+      if ((err = mp_2expt(&t, (n + 2) * MP_DIGIT_BIT)) != MP_OKAY)        goto LBL_ERR;
+      if (mp_isneg(r)) {
+         err = mp_add(r, &t, r);
+      } else {
+         err = mp_sub(r, &t, r);
+      }
+      if (err != MP_OKAY)                                                 goto LBL_ERR;
+   }
+
+   while (mp_isneg(r)) {
+      if ((err = mp_decr(q)) != MP_OKAY)                                  goto LBL_ERR;
+      if ((err = mp_add(r, b, r)) != MP_OKAY)                             goto LBL_ERR;
+   }
+   while (mp_cmp(r, b) != MP_LT) {
+      if ((err = mp_incr(q)) != MP_OKAY)                                  goto LBL_ERR;
+      if ((err = s_mp_sub(r, b, r)) != MP_OKAY)                           goto LBL_ERR;
+   }
+
+LBL_ERR:
+   mp_clear(&t);
+   return err;
+}
+
+/* q = a / b, r = a % b for a >= 0 and the normalized b > 0 with the reciprocal
+ * x of its upper p digits, see s_mp_div_recip().
+ *
+ * With p < n the quotient must be shorter than p - 2 digits.  With the whole
+ * of b it is computed in chunks of n digits.
+ */
+mp_err s_mp_div_barrett(const mp_int *a, const mp_int *b, const mp_int *x, int p, mp_int *q, mp_int *r)
+{
+   int j, k, n = b->used;
+   mp_err err;
+   mp_int Q, Q1, R;
+
+   if ((err = mp_init_multi(&Q, &Q1, &R, NULL)) != MP_OKAY) {
+      return err;
+   }
+
+   /* the first chunk is a / B**j, then R*B**k plus the next k digits of a */
+   j = MP_MAX(a->used - (2 * n), 0);
+   if ((err = mp_copy(a, &R)) != MP_OKAY)                                 goto LBL_ERR;
+   mp_rshd(&R, j);
+   mp_zero(&Q);
+   for (;;) {
+      if ((err = s_step(&R, b, x, p, &Q1, &R)) != MP_OKAY)                goto LBL_ERR;
+      if ((err = mp_add(&Q, &Q1, &Q)) != MP_OKAY)                         goto LBL_ERR;
+      if (j == 0) {
+         break;
+      }
+      k = MP_MIN(n, j);
+      j -= k;
+      if ((err = mp_lshd(&Q, k)) != MP_OKAY)                              goto LBL_ERR;
+      if ((err = mp_lshd(&R, k)) != MP_OKAY)                              goto LBL_ERR;
+      if ((err = mp_grow(&R, k)) != MP_OKAY)                              goto LBL_ERR;
+      R.used = MP_MAX(R.used, k);
+      s_mp_copy_digs(R.dp, a->dp + j, k);
+      mp_clamp(&R);
+   }
+
+   if (q != NULL) {
+      mp_exch(&Q, q);
+   }
+   if (r != NULL) {
+      mp_exch(&R, r);
+   }
+
+LBL_ERR:
+   mp_clear_multi(&Q, &Q1, &R, NULL);
+   return err;
+}
+
+#endif
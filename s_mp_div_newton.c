@@ -0,0 +1,72 @@
+#include "tommath_private.h"
+#ifdef S_MP_DIV_NEWTON_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+
+/*
+   Division with a reciprocal of the divisor computed by Newton iteration,
+   see algorithms 3.5 "ApproximateReciprocal" and 2.5 "BarrettDivRem" in:
+
+      Brent, Richard P., and Paul Zimmermann. "Modern computer arithmetic"
+      Vol. 18. Cambridge University Press, 2010
+      Available online at https://arxiv.org/pdf/1004.4710
+
+   Every step of the iteration doubles the number of correct digits, the
+   last one dominates and the whole reciprocal costs a few multiplications
+   of its size.  The quotient then needs two more, so this is faster than
+   the recursive division as soon as mp_mul() is well beyond Karatsuba.
+*/
+
+mp_err s_mp_div_newton(const mp_int *a, const mp_int *b, mp_int *q, mp_int *r)
+{
+   int n, p, sigma;
+   mp_err err;
+   bool neg;
+   mp_digit msb_b, msb;
+   mp_int A, B, Q, R, X;
+
+   if ((err = mp_init_multi(&A, &B, &Q, &R, &X, NULL)) != MP_OKAY) {
+      return err;
+   }
+
+   /* normalize, the reciprocal needs the top bit of B set */
+   msb = (mp_digit)1 << (MP_DIGIT_BIT - 1);
+   sigma = 0;
+   msb_b = b->dp[b->used - 1];
+   while (msb_b < msb) {
+      sigma++;
+      msb_b <<= 1;
+   }
+   if ((err = mp_mul_2d(b, sigma, &B)) != MP_OKAY)                        goto LBL_ERR;
+   if ((err = mp_mul_2d(a, sigma, &A)) != MP_OKAY)                        goto LBL_ERR;
+
+   neg = (a->sign != b->sign);
+   A.sign = B.sign = MP_ZPOS;
+
+   /* At most m + 1 digits of the quotient, a short one needs a reciprocal of
+    * a few more digits only.
+    */
+   n = B.used;
+   p = MP_MIN(n, (A.used - n) + 3);
+   if ((err = s_mp_div_recip(&B, p, &X)) != MP_OKAY)                      goto LBL_ERR;
+   if ((err = s_mp_div_barrett(&A, &B, &X, p, &Q, &R)) != MP_OKAY)        goto LBL_ERR;
+
+   /* get sign before writing to c */
+   R.sign = (mp_iszero(&R) ? MP_ZPOS : a->sign);
+
+   if (q != NULL) {
+      mp_exch(&Q, q);
+      q->sign = ((!mp_iszero(q) && neg) ? MP_NEG : MP_ZPOS);
+   }
+   if (r != NULL) {
+      /* de-normalize the remainder */
+      if ((err = mp_div_2d(&R, sigma, &R, NULL)) != MP_OKAY)              goto LBL_ERR;
+      mp_exch(&R, r);
+   }
+
+LBL_ERR:
+   mp_clear_multi(&A, &B, &Q, &R, &X, NULL);
+   return err;
+}
+
+#endif
@@ -0,0 +1,55 @@
+#include "tommath_private.h"
+#ifdef S_MP_DIV_RECIP_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+
+/* x = B**(2p) / bt by Newton iteration, off by a few units at most, with bt
+ * the upper p digits of the normalized b, see s_mp_div_newton().
+ *
+ * From the reciprocal y of the upper h > p/2 + 1 digits and the residue
+ * e = B**(2p) - bt*y*B**(p-h) the Newton step gives
+ *
+ *    x = y*B**(p-h) + y*e/B**(p+h)
+ *
+ * The lower p - 2 digits of e can't reach the unit of x, so only the
+ * upper ones are computed:
+ *
+ *    e / B**(p-2) = B**(p+2) - bt*y/B**(h-2)
+ */
+mp_err s_mp_div_recip(const mp_int *b, int p, mp_int *x)
+{
+   mp_int bt, y, e;
+   mp_err err;
+   int h;
+
+   if ((err = mp_init_multi(&bt, &y, &e, NULL)) != MP_OKAY) {
+      return err;
+   }
+
+   if ((err = mp_copy(b, &bt)) != MP_OKAY)                                goto LBL_ERR;
+   mp_rshd(&bt, b->used - p);
+
+   if (p <= MP_MAX(MP_MUL_KARATSUBA_CUTOFF, 4)) {
+      if ((err = mp_2expt(&e, 2 * p * MP_DIGIT_BIT)) != MP_OKAY)          goto LBL_ERR;
+      err = s_mp_div_school(&e, &bt, x, NULL);
+      goto LBL_ERR;
+   }
+
+   h = (p / 2) + 2;
+   if ((err = s_mp_div_recip(b, h, &y)) != MP_OKAY)                              goto LBL_ERR;
+
+   /* e = B**(p+2) - bt*y/B**(h-2), small against B**(p+2) and of either sign */
+   if ((err = mp_mul_high(&bt, &y, h - 2, &bt)) != MP_OKAY)               goto LBL_ERR;
+   if ((err = mp_2expt(&e, (p + 2) * MP_DIGIT_BIT)) != MP_OKAY)           goto LBL_ERR;
+   if ((err = mp_sub(&e, &bt, &e)) != MP_OKAY)                            goto LBL_ERR;
+
+   /* x = y*B**(p-h) + y*e/B**(h+2) */
+   if ((err = mp_mul_high(&y, &e, h + 2, &e)) != MP_OKAY)                 goto LBL_ERR;
+   if ((err = mp_lshd(&y, p - h)) != MP_OKAY)                             goto LBL_ERR;
+   err = mp_add(&y, &e, x);
+
+LBL_ERR:
+   mp_clear_multi(&bt, &y, &e, NULL);
+   return err;
+}
+#endif
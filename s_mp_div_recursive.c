@@ -90,8 +90,7 @@ mp_err s_mp_div_recursive(const mp_int *a, const mp_int *b, mp_int *q, mp_int *r
    }
 
    /* most significant bit of a limb */
-   /* assumes  MP_DIGIT_MAX < (sizeof(mp_digit) * CHAR_BIT) */
-   msb = (MP_DIGIT_MAX + (mp_digit)(1)) >> 1;
+   msb = (mp_digit)1 << (MP_DIGIT_BIT - 1);
    sigma = 0;
    msb_b = b->dp[b->used - 1];
    while (msb_b < msb) {
@@ -75,7 +75,7 @@ mp_err s_mp_div_school(const mp_int *a, const mp_int *b, mp_int *c, mp_int *d)
       /* step 3.1 if xi == yt then set q{i-t-1} to b-1,
        * otherwise set q{i-t-1} to (xi*b + x{i-1})/yt */
       if (xdpi == y.dp[t]) {
-         q.dp[(i - t) - 1] = ((mp_digit)1 << (mp_digit)MP_DIGIT_BIT) - (mp_digit)1;
+         q.dp[(i - t) - 1] = MP_MASK;
       } else {
          mp_word tmp;
          tmp = (mp_word)xdpi << (mp_word)MP_DIGIT_BIT;
@@ -13,94 +13,66 @@
 
 mp_err s_mp_exptmod(const mp_int *G, const mp_int *X, const mp_int *P, mp_int *Y, int redmode)
 {
-   mp_int  M[TAB_SIZE], res, mu;
+   mp_int  M[TAB_SIZE / 2], g, res, t, q, r, mu;
+   mp_scratch s;
    mp_digit buf;
    mp_err   err;
-   int      bitbuf, bitcpy, bitcnt, mode, digidx, x, y, winsize;
-   mp_err(*redux)(mp_int *x, const mp_int *m, const mp_int *mu);
+   int      bitbuf, bitcpy, bitcnt, mode, digidx, x, y, winsize, half;
+   mp_err(*redux)(mp_int *x, const mp_int *m, const mp_int *mu, mp_int *q, mp_int *t);
 
    /* find window size */
-   x = mp_count_bits(X);
-   if (x <= 7) {
-      winsize = 2;
-   } else if (x <= 36) {
-      winsize = 3;
-   } else if (x <= 140) {
-      winsize = 4;
-   } else if (x <= 450) {
-      winsize = 5;
-   } else if (x <= 1303) {
-      winsize = 6;
-   } else if (x <= 3529) {
-      winsize = 7;
-   } else {
-      winsize = 8;
-   }
-
+   winsize = s_mp_exptmod_winsize(mp_count_bits(X));
    winsize = MAX_WINSIZE ? MP_MIN(MAX_WINSIZE, winsize) : winsize;
+   half = 1 << (winsize - 1);
 
-   /* init M array */
-   /* init first cell */
-   if ((err = mp_init(&M[1])) != MP_OKAY) {
+   /* G and the upper half of the table, M[x] = G**(half + x), are below P and
+    * share one allocation with the temporaries of the products.  Together with
+    * the work ints that is all the memory, nothing is allocated in the loop.
+    */
+   if ((err = s_mp_scratch_init(&s, ((half + 1) * MP_MAX(P->used, MP_MIN_DIGIT_COUNT)) +
+                                s_mp_scratch_size(P->used, P->used))) != MP_OKAY) {
       return err;
    }
-
-   /* now init the second half of the array */
-   for (x = 1<<(winsize-1); x < (1 << winsize); x++) {
-      if ((err = mp_init(&M[x])) != MP_OKAY) {
-         for (y = 1<<(winsize-1); y < x; y++) {
-            mp_clear(&M[y]);
-         }
-         mp_clear(&M[1]);
-         return err;
-      }
+   if ((err = s_mp_scratch_get(&s, &g, P->used)) != MP_OKAY)      goto LBL_S;
+   for (x = 0; x < half; x++) {
+      if ((err = s_mp_scratch_get(&s, &M[x], P->used)) != MP_OKAY) goto LBL_S;
    }
 
-   /* create mu, used for Barrett reduction */
-   if ((err = mp_init(&mu)) != MP_OKAY)                           goto LBL_M;
+   if ((err = mp_init_multi(&res, &t, &q, &r, &mu, NULL)) != MP_OKAY) goto LBL_S;
 
+   /* create mu, used for Barrett reduction */
    if (redmode == 0) {
-      if ((err = mp_reduce_setup(&mu, P)) != MP_OKAY)             goto LBL_MU;
-      redux = mp_reduce;
+      if ((err = mp_reduce_setup(&mu, P)) != MP_OKAY)             goto LBL_ERR;
+      redux = s_mp_reduce;
    } else {
-      if ((err = mp_reduce_2k_setup_l(P, &mu)) != MP_OKAY)        goto LBL_MU;
-      redux = mp_reduce_2k_l;
+      if ((err = mp_reduce_2k_setup_l(P, &mu)) != MP_OKAY)        goto LBL_ERR;
+      redux = s_mp_reduce_2k_l;
    }
 
    /* create M table
     *
-    * The M table contains powers of the base,
-    * e.g. M[x] = G**x mod P
-    *
-    * The first half of the table is not
-    * computed though accept for M[0] and M[1]
-    */
-   if ((err = mp_mod(G, P, &M[1])) != MP_OKAY)                    goto LBL_MU;
-
-   /* compute the value at M[1<<(winsize-1)] by squaring
-    * M[1] (winsize-1) times
+    * The products go to t and are swapped with res after the reduction,
+    * the table entries are copied from there.
     */
-   if ((err = mp_copy(&M[1], &M[(size_t)1 << (winsize - 1)])) != MP_OKAY) goto LBL_MU;
+   if ((err = mp_mod(G, P, &res)) != MP_OKAY)                     goto LBL_ERR;
+   if ((err = mp_copy(&res, &g)) != MP_OKAY)                      goto LBL_ERR;
 
+   /* compute the value at M[0] by squaring G (winsize-1) times */
    for (x = 0; x < (winsize - 1); x++) {
-      /* square it */
-      if ((err = mp_sqr(&M[(size_t)1 << (winsize - 1)],
-                        &M[(size_t)1 << (winsize - 1)])) != MP_OKAY) goto LBL_MU;
-
-      /* reduce modulo P */
-      if ((err = redux(&M[(size_t)1 << (winsize - 1)], P, &mu)) != MP_OKAY) goto LBL_MU;
+      if ((err = s_mp_mul_scratch(&res, &res, &t, &s)) != MP_OKAY) goto LBL_ERR;
+      if ((err = redux(&t, P, &mu, &q, &r)) != MP_OKAY)           goto LBL_ERR;
+      mp_exch(&res, &t);
    }
+   if ((err = mp_copy(&res, &M[0])) != MP_OKAY)                   goto LBL_ERR;
 
-   /* create upper table, that is M[x] = M[x-1] * M[1] (mod P)
-    * for x = (2**(winsize - 1) + 1) to (2**winsize - 1)
-    */
-   for (x = (1 << (winsize - 1)) + 1; x < (1 << winsize); x++) {
-      if ((err = mp_mul(&M[x - 1], &M[1], &M[x])) != MP_OKAY)     goto LBL_MU;
-      if ((err = redux(&M[x], P, &mu)) != MP_OKAY)                goto LBL_MU;
+   /* create upper table, that is M[x] = M[x-1] * G (mod P) */
+   for (x = 1; x < half; x++) {
+      if ((err = s_mp_mul_scratch(&M[x - 1], &g, &t, &s)) != MP_OKAY) goto LBL_ERR;
+      if ((err = redux(&t, P, &mu, &q, &r)) != MP_OKAY)           goto LBL_ERR;
+      if ((err = mp_copy(&t, &M[x])) != MP_OKAY)                  goto LBL_ERR;
    }
 
    /* setup result */
-   if ((err = mp_init(&res)) != MP_OKAY)                          goto LBL_MU;
    mp_set(&res, 1uL);
 
    /* set initial mode and bit cnt */
@@ -138,8 +110,9 @@ mp_err s_mp_exptmod(const mp_int *G, const mp_int *X, const mp_int *P, mp_int *Y
 
       /* if the bit is zero and mode == 1 then we square */
       if ((mode == 1) && (y == 0)) {
-         if ((err = mp_sqr(&res, &res)) != MP_OKAY)               goto LBL_RES;
-         if ((err = redux(&res, P, &mu)) != MP_OKAY)              goto LBL_RES;
+         if ((err = s_mp_mul_scratch(&res, &res, &t, &s)) != MP_OKAY) goto LBL_ERR;
+         if ((err = redux(&t, P, &mu, &q, &r)) != MP_OKAY)        goto LBL_ERR;
+         mp_exch(&res, &t);
          continue;
       }
 
@@ -151,13 +124,15 @@ mp_err s_mp_exptmod(const mp_int *G, const mp_int *X, const mp_int *P, mp_int *Y
          /* ok window is filled so square as required and multiply  */
          /* square first */
          for (x = 0; x < winsize; x++) {
-            if ((err = mp_sqr(&res, &res)) != MP_OKAY)            goto LBL_RES;
-            if ((err = redux(&res, P, &mu)) != MP_OKAY)           goto LBL_RES;
+            if ((err = s_mp_mul_scratch(&res, &res, &t, &s)) != MP_OKAY) goto LBL_ERR;
+            if ((err = redux(&t, P, &mu, &q, &r)) != MP_OKAY)     goto LBL_ERR;
+            mp_exch(&res, &t);
          }
 
          /* then multiply */
-         if ((err = mp_mul(&res, &M[bitbuf], &res)) != MP_OKAY)  goto LBL_RES;
-         if ((err = redux(&res, P, &mu)) != MP_OKAY)             goto LBL_RES;
+         if ((err = s_mp_mul_scratch(&res, &M[bitbuf - half], &t, &s)) != MP_OKAY) goto LBL_ERR;
+         if ((err = redux(&t, P, &mu, &q, &r)) != MP_OKAY)        goto LBL_ERR;
+         mp_exch(&res, &t);
 
          /* empty window and reset */
          bitcpy = 0;
@@ -170,29 +145,26 @@ mp_err s_mp_exptmod(const mp_int *G, const mp_int *X, const mp_int *P, mp_int *Y
    if ((mode == 2) && (bitcpy > 0)) {
       /* square then multiply if the bit is set */
       for (x = 0; x < bitcpy; x++) {
-         if ((err = mp_sqr(&res, &res)) != MP_OKAY)               goto LBL_RES;
-         if ((err = redux(&res, P, &mu)) != MP_OKAY)              goto LBL_RES;
+         if ((err = s_mp_mul_scratch(&res, &res, &t, &s)) != MP_OKAY) goto LBL_ERR;
+         if ((err = redux(&t, P, &mu, &q, &r)) != MP_OKAY)        goto LBL_ERR;
+         mp_exch(&res, &t);
 
          bitbuf <<= 1;
          if ((bitbuf & (1 << winsize)) != 0) {
             /* then multiply */
-            if ((err = mp_mul(&res, &M[1], &res)) != MP_OKAY)     goto LBL_RES;
-            if ((err = redux(&res, P, &mu)) != MP_OKAY)           goto LBL_RES;
+            if ((err = s_mp_mul_scratch(&res, &g, &t, &s)) != MP_OKAY) goto LBL_ERR;
+            if ((err = redux(&t, P, &mu, &q, &r)) != MP_OKAY)     goto LBL_ERR;
+            mp_exch(&res, &t);
          }
       }
    }
 
    mp_exch(&res, Y);
    err = MP_OKAY;
-LBL_RES:
-   mp_clear(&res);
-LBL_MU:
-   mp_clear(&mu);
-LBL_M:
-   mp_clear(&M[1]);
-   for (x = 1<<(winsize-1); x < (1 << winsize); x++) {
-      mp_clear(&M[x]);
-   }
+LBL_ERR:
+   mp_clear_multi(&res, &t, &q, &r, &mu, NULL);
+LBL_S:
+   s_mp_scratch_clear(&s);
    return err;
 }
 #endif
@@ -12,18 +12,23 @@
  */
 
 #ifdef MP_LOW_MEM
-#   define TAB_SIZE 32
 #   define MAX_WINSIZE 5
 #else
-#   define TAB_SIZE 256
 #   define MAX_WINSIZE 0
 #endif
 
+/* x = x mod P, redux is NULL for 2**k - d, its reduction needs the temporary q */
+static mp_err s_redux(mp_err(*redux)(mp_int *x, const mp_int *n, mp_digit rho), mp_int *x, const mp_int *P, mp_digit mp, mp_int *q)
+{
+   return (redux != NULL) ? redux(x, P, mp) : s_mp_reduce_2k(x, P, mp, q);
+}
+
 mp_err s_mp_exptmod_fast(const mp_int *G, const mp_int *X, const mp_int *P, mp_int *Y, int redmode)
 {
-   mp_int  M[TAB_SIZE], res;
+   mp_int  *M, g, res, t, q;
+   mp_scratch s;
    mp_digit buf, mp;
-   int     bitbuf, bitcpy, bitcnt, mode, digidx, x, y, winsize;
+   int     bitbuf, bitcpy, bitcnt, mode, digidx, x, y, winsize, half, hdr;
    mp_err   err;
 
    /* use a pointer to the reduction algorithm.  This allows us to use
@@ -32,64 +37,75 @@ mp_err s_mp_exptmod_fast(const mp_int *G, const mp_int *X, const mp_int *P, mp_i
     */
    mp_err(*redux)(mp_int *x, const mp_int *n, mp_digit rho);
 
-   /* find window size */
-   x = mp_count_bits(X);
-   if (x <= 7) {
-      winsize = 2;
-   } else if (x <= 36) {
-      winsize = 3;
-   } else if (x <= 140) {
-      winsize = 4;
-   } else if (x <= 450) {
-      winsize = 5;
-   } else if (x <= 1303) {
-      winsize = 6;
-   } else if (x <= 3529) {
-      winsize = 7;
-   } else {
-      winsize = 8;
+   /* AVX-512 IFMA does the whole exponentiation in its own representation */
+   if ((redmode == 0) &&
+       MP_HAS(S_MP_EXPTMOD_IFMA) && s_mp_cpu_ifma() &&
+       (mp_count_bits(P) >= MP_IFMA_MIN_BITS) &&
+       (mp_count_bits(P) <= MP_IFMA_MAX_BITS)) {
+      return s_mp_exptmod_ifma(G, X, P, NULL, Y);
    }
 
+   /* large moduli are reduced with multiplications, see mp_mont_ctx */
+   if ((redmode == 0) && MP_HAS(MP_MONT_EXPTMOD) && MP_HAS(S_MP_MONTGOMERY_REDUCE_MUL) &&
+       (P->used >= MP_REDUCE_MUL_CUTOFF)) {
+      mp_mont_ctx ctx;
+      if ((err = mp_mont_ctx_init(&ctx, P)) != MP_OKAY) {
+         return err;
+      }
+      err = mp_mont_exptmod(&ctx, G, X, Y);
+      mp_mont_ctx_clear(&ctx);
+      return err;
+   }
+
+   /* while the squarings are comba anyway, the fused and lazily reduced ones on
+    * digit arrays save the mp_int bookkeeping and the comparisons with P
+    */
+   if ((redmode == 0) && MP_HAS(S_MP_EXPTMOD_LAZY) && (P->used < MP_SQR_KARATSUBA_CUTOFF)) {
+      return s_mp_exptmod_lazy(G, X, P, Y);
+   }
+
+   /* find window size */
+   winsize = s_mp_exptmod_winsize(mp_count_bits(X));
    winsize = MAX_WINSIZE ? MP_MIN(MAX_WINSIZE, winsize) : winsize;
+   half = 1 << (winsize - 1);
 
-   /* init M array */
-   /* init first cell */
-   if ((err = mp_init_size(&M[1], P->alloc)) != MP_OKAY) {
+   /* G and the upper half of the table, M[x] = G**(half + x), are below P and
+    * share one allocation with the temporaries of the products, see
+    * s_mp_exptmod().  The headers of the table take the first digits of it.
+    */
+   hdr = (int)(((sizeof(mp_int) * (size_t)half) + sizeof(mp_digit) - 1u) / sizeof(mp_digit));
+   if ((err = s_mp_scratch_init(&s, hdr + ((half + 1) * MP_MAX(P->used, MP_MIN_DIGIT_COUNT)) +
+                                s_mp_scratch_size(P->used, P->used))) != MP_OKAY) {
       return err;
    }
-
-   /* now init the second half of the array */
-   for (x = 1<<(winsize-1); x < (1 << winsize); x++) {
-      if ((err = mp_init_size(&M[x], P->alloc)) != MP_OKAY) {
-         for (y = 1<<(winsize-1); y < x; y++) {
-            mp_clear(&M[y]);
-         }
-         mp_clear(&M[1]);
-         return err;
-      }
+   M = (mp_int *)(void *)s.dp;
+   s.used = hdr;
+   if ((err = s_mp_scratch_get(&s, &g, P->used)) != MP_OKAY)      goto LBL_S;
+   for (x = 0; x < half; x++) {
+      if ((err = s_mp_scratch_get(&s, &M[x], P->used)) != MP_OKAY) goto LBL_S;
    }
 
    /* determine and setup reduction code */
    if (redmode == 0) {
       if (MP_HAS(MP_MONTGOMERY_SETUP)) {
          /* now setup montgomery  */
-         if ((err = mp_montgomery_setup(P, &mp)) != MP_OKAY)      goto LBL_M;
+         if ((err = mp_montgomery_setup(P, &mp)) != MP_OKAY)      goto LBL_S;
       } else {
          err = MP_VAL;
-         goto LBL_M;
+         goto LBL_S;
       }
 
-      /* automatically pick the comba one if available (saves quite a few calls/ifs) */
-      if (MP_HAS(S_MP_MONTGOMERY_REDUCE_COMBA) &&
-          (((P->used * 2) + 1) < MP_WARRAY) &&
-          (P->used < MP_MAX_COMBA)) {
+      /* automatically pick the BMI2/ADX or the comba one if available (saves quite a few calls/ifs) */
+      if (MP_HAS(S_MP_MONTGOMERY_REDUCE_ADX) && s_mp_cpu_adx()) {
+         redux = s_mp_montgomery_reduce_adx;
+      } else if (MP_HAS(S_MP_MONTGOMERY_REDUCE_COMBA)) {
          redux = s_mp_montgomery_reduce_comba;
       } else if (MP_HAS(MP_MONTGOMERY_REDUCE)) {
          /* use slower baseline Montgomery method */
          redux = mp_montgomery_reduce;
       } else {
          err = MP_VAL;
-         goto LBL_M;
+         goto LBL_S;
       }
    } else if (redmode == 1) {
       if (MP_HAS(MP_DR_SETUP) && MP_HAS(MP_DR_REDUCE)) {
@@ -98,55 +114,61 @@ mp_err s_mp_exptmod_fast(const mp_int *G, const mp_int *X, const mp_int *P, mp_i
          redux = mp_dr_reduce;
       } else {
          err = MP_VAL;
-         goto LBL_M;
+         goto LBL_S;
       }
-   } else if (MP_HAS(MP_REDUCE_2K_SETUP) && MP_HAS(MP_REDUCE_2K)) {
+   } else if (MP_HAS(MP_REDUCE_2K_SETUP) && MP_HAS(S_MP_REDUCE_2K)) {
       /* setup DR reduction for moduli of the form 2**k - b */
-      if ((err = mp_reduce_2k_setup(P, &mp)) != MP_OKAY)          goto LBL_M;
-      redux = mp_reduce_2k;
+      if ((err = mp_reduce_2k_setup(P, &mp)) != MP_OKAY)          goto LBL_S;
+      redux = NULL;
    } else {
       err = MP_VAL;
-      goto LBL_M;
+      goto LBL_S;
    }
 
-   /* setup result */
-   if ((err = mp_init_size(&res, P->alloc)) != MP_OKAY)           goto LBL_M;
+   /* setup result and the work ints */
+   if ((err = mp_init_multi(&res, &t, &q, NULL)) != MP_OKAY)       goto LBL_S;
 
    /* create M table
     *
-
-    *
-    * The first half of the table is not computed though accept for M[0] and M[1]
+    * The products go to t and are swapped with res after the reduction,
+    * the table entries are copied from there.
     */
-
    if (redmode == 0) {
       if (MP_HAS(MP_MONTGOMERY_CALC_NORMALIZATION)) {
          /* now we need R mod m */
-         if ((err = mp_montgomery_calc_normalization(&res, P)) != MP_OKAY) goto LBL_RES;
+         if ((err = mp_montgomery_calc_normalization(&t, P)) != MP_OKAY) goto LBL_ERR;
 
-         /* now set M[1] to G * R mod m */
-         if ((err = mp_mulmod(G, &res, P, &M[1])) != MP_OKAY)     goto LBL_RES;
+         /* now set G to G * R mod m */
+         if ((err = mp_mulmod(G, &t, P, &res)) != MP_OKAY)        goto LBL_ERR;
       } else {
          err = MP_VAL;
-         goto LBL_RES;
+         goto LBL_ERR;
       }
    } else {
-      mp_set(&res, 1uL);
-      if ((err = mp_mod(G, P, &M[1])) != MP_OKAY)                 goto LBL_RES;
+      if ((err = mp_mod(G, P, &res)) != MP_OKAY)                  goto LBL_ERR;
    }
+   if ((err = mp_copy(&res, &g)) != MP_OKAY)                      goto LBL_ERR;
 
-   /* compute the value at M[1<<(winsize-1)] by squaring M[1] (winsize-1) times */
-   if ((err = mp_copy(&M[1], &M[(size_t)1 << (winsize - 1)])) != MP_OKAY) goto LBL_RES;
-
+   /* compute the value at M[0] by squaring G (winsize-1) times */
    for (x = 0; x < (winsize - 1); x++) {
-      if ((err = mp_sqr(&M[(size_t)1 << (winsize - 1)], &M[(size_t)1 << (winsize - 1)])) != MP_OKAY) goto LBL_RES;
-      if ((err = redux(&M[(size_t)1 << (winsize - 1)], P, mp)) != MP_OKAY) goto LBL_RES;
+      if ((err = s_mp_mul_scratch(&res, &res, &t, &s)) != MP_OKAY) goto LBL_ERR;
+      if ((err = s_redux(redux, &t, P, mp, &q)) != MP_OKAY)       goto LBL_ERR;
+      mp_exch(&res, &t);
    }
+   if ((err = mp_copy(&res, &M[0])) != MP_OKAY)                   goto LBL_ERR;
 
    /* create upper table */
-   for (x = (1 << (winsize - 1)) + 1; x < (1 << winsize); x++) {
-      if ((err = mp_mul(&M[x - 1], &M[1], &M[x])) != MP_OKAY)     goto LBL_RES;
-      if ((err = redux(&M[x], P, mp)) != MP_OKAY)                 goto LBL_RES;
+   for (x = 1; x < half; x++) {
+      if ((err = s_mp_mul_scratch(&M[x - 1], &g, &t, &s)) != MP_OKAY) goto LBL_ERR;
+      if ((err = s_redux(redux, &t, P, mp, &q)) != MP_OKAY)       goto LBL_ERR;
+      if ((err = mp_copy(&t, &M[x])) != MP_OKAY)                  goto LBL_ERR;
+   }
+
+   /* the one, R mod m for Montgomery */
+   if (redmode == 0) {
+      if ((err = mp_montgomery_calc_normalization(&res, P)) != MP_OKAY) goto LBL_ERR;
+   } else {
+      mp_set(&res, 1uL);
    }
 
    /* set initial mode and bit cnt */
@@ -184,8 +206,9 @@ mp_err s_mp_exptmod_fast(const mp_int *G, const mp_int *X, const mp_int *P, mp_i
 
       /* if the bit is zero and mode == 1 then we square */
       if ((mode == 1) && (y == 0)) {
-         if ((err = mp_sqr(&res, &res)) != MP_OKAY)               goto LBL_RES;
-         if ((err = redux(&res, P, mp)) != MP_OKAY)               goto LBL_RES;
+         if ((err = s_mp_mul_scratch(&res, &res, &t, &s)) != MP_OKAY) goto LBL_ERR;
+         if ((err = s_redux(redux, &t, P, mp, &q)) != MP_OKAY)    goto LBL_ERR;
+         mp_exch(&res, &t);
          continue;
       }
 
@@ -197,13 +220,15 @@ mp_err s_mp_exptmod_fast(const mp_int *G, const mp_int *X, const mp_int *P, mp_i
          /* ok window is filled so square as required and multiply  */
          /* square first */
          for (x = 0; x < winsize; x++) {
-            if ((err = mp_sqr(&res, &res)) != MP_OKAY)            goto LBL_RES;
-            if ((err = redux(&res, P, mp)) != MP_OKAY)            goto LBL_RES;
+            if ((err = s_mp_mul_scratch(&res, &res, &t, &s)) != MP_OKAY) goto LBL_ERR;
+            if ((err = s_redux(redux, &t, P, mp, &q)) != MP_OKAY) goto LBL_ERR;
+            mp_exch(&res, &t);
          }
 
          /* then multiply */
-         if ((err = mp_mul(&res, &M[bitbuf], &res)) != MP_OKAY)   goto LBL_RES;
-         if ((err = redux(&res, P, mp)) != MP_OKAY)               goto LBL_RES;
+         if ((err = s_mp_mul_scratch(&res, &M[bitbuf - half], &t, &s)) != MP_OKAY) goto LBL_ERR;
+         if ((err = s_redux(redux, &t, P, mp, &q)) != MP_OKAY)    goto LBL_ERR;
+         mp_exch(&res, &t);
 
          /* empty window and reset */
          bitcpy = 0;
@@ -216,15 +241,17 @@ mp_err s_mp_exptmod_fast(const mp_int *G, const mp_int *X, const mp_int *P, mp_i
    if ((mode == 2) && (bitcpy > 0)) {
       /* square then multiply if the bit is set */
       for (x = 0; x < bitcpy; x++) {
-         if ((err = mp_sqr(&res, &res)) != MP_OKAY)               goto LBL_RES;
-         if ((err = redux(&res, P, mp)) != MP_OKAY)               goto LBL_RES;
+         if ((err = s_mp_mul_scratch(&res, &res, &t, &s)) != MP_OKAY) goto LBL_ERR;
+         if ((err = s_redux(redux, &t, P, mp, &q)) != MP_OKAY)    goto LBL_ERR;
+         mp_exch(&res, &t);
 
          /* get next bit of the window */
          bitbuf <<= 1;
          if ((bitbuf & (1 << winsize)) != 0) {
             /* then multiply */
-            if ((err = mp_mul(&res, &M[1], &res)) != MP_OKAY)     goto LBL_RES;
-            if ((err = redux(&res, P, mp)) != MP_OKAY)            goto LBL_RES;
+            if ((err = s_mp_mul_scratch(&res, &g, &t, &s)) != MP_OKAY) goto LBL_ERR;
+            if ((err = s_redux(redux, &t, P, mp, &q)) != MP_OKAY) goto LBL_ERR;
+            mp_exch(&res, &t);
          }
       }
    }
@@ -236,19 +263,16 @@ mp_err s_mp_exptmod_fast(const mp_int *G, const mp_int *X, const mp_int *P, mp_i
        * to reduce one more time to cancel out the factor
        * of R.
        */
-      if ((err = redux(&res, P, mp)) != MP_OKAY)                  goto LBL_RES;
+      if ((err = redux(&res, P, mp)) != MP_OKAY)                  goto LBL_ERR;
    }
 
    /* swap res with Y */
    mp_exch(&res, Y);
    err = MP_OKAY;
-LBL_RES:
-   mp_clear(&res);
-LBL_M:
-   mp_clear(&M[1]);
-   for (x = 1<<(winsize-1); x < (1 << winsize); x++) {
-      mp_clear(&M[x]);
-   }
+LBL_ERR:
+   mp_clear_multi(&res, &t, &q, NULL);
+LBL_S:
+   s_mp_scratch_clear(&s);
    return err;
 }
 #endif
@@ -0,0 +1,242 @@
+#include "tommath_private.h"
+#ifdef S_MP_EXPTMOD_IFMA_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+
+/* computes Y == G**X mod P for odd P with AVX-512 IFMA
+ *
+ * The numbers are converted at entry to 52-bit limbs, eight of them in a
+ * ZMM register, and back at the exit.  The Montgomery multiplication
+ * uses VPMADD52LUQ/VPMADD52HUQ which add the low resp. high 52 bits of
+ * eight 52x52 bit products to eight 64-bit accumulators.  R is 2**(52*n)
+ * with 4P < R, so the intermediate results can stay below 2P ("almost
+ * Montgomery multiplication") and only the final one has to be reduced.
+ *
+ * Uses a left-to-right fixed window.  Must only be called if
+ * s_mp_cpu_ifma() returned true and P has at most MP_IFMA_MAX_BITS bits.
+ * rr is R**2 mod P from s_mp_ifma_rr() or NULL to compute it here.
+ */
+#ifdef MP_IFMA_INTRIN
+/* the intrinsics headers do not build with all of our warnings */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeclaration-after-statement"
+#include <immintrin.h>
+#pragma GCC diagnostic pop
+
+#define S_LIMB_BITS MP_IFMA_LIMB_BITS
+#define S_LIMB_MASK ((((uint64_t)1) << S_LIMB_BITS) - 1u)
+#define S_MAX_VECS  (((MP_IFMA_MAX_BITS + 2 + (S_LIMB_BITS - 1)) / S_LIMB_BITS + 7) / 8)
+
+/* r[0..n-1] = 52-bit limbs of |a| */
+static void s_to_limbs(const mp_int *a, uint64_t *r, int n)
+{
+   int i;
+   for (i = 0; i < n; i++) {
+      int pos = i * S_LIMB_BITS, ix = pos / MP_DIGIT_BIT, got;
+      uint64_t v = 0;
+      if (ix < a->used) {
+         v = (uint64_t)(a->dp[ix] >> (pos % MP_DIGIT_BIT));
+         for (got = MP_DIGIT_BIT - (pos % MP_DIGIT_BIT); (got < S_LIMB_BITS) && (++ix < a->used); got += MP_DIGIT_BIT) {
+            v |= (uint64_t)a->dp[ix] << got;
+         }
+      }
+      r[i] = v & S_LIMB_MASK;
+   }
+}
+
+/* a = r[0..n-1] */
+static mp_err s_from_limbs(const uint64_t *r, int n, mp_int *a)
+{
+   int i, digs = ((n * S_LIMB_BITS) + (MP_DIGIT_BIT - 1)) / MP_DIGIT_BIT;
+   mp_err err;
+
+   if ((err = mp_grow(a, digs)) != MP_OKAY) {
+      return err;
+   }
+   for (i = 0; i < digs; i++) {
+      int pos = i * MP_DIGIT_BIT, ix = pos / S_LIMB_BITS, got;
+      mp_digit v = 0;
+      if (ix < n) {
+         v = (mp_digit)(r[ix] >> (pos % S_LIMB_BITS));
+         for (got = S_LIMB_BITS - (pos % S_LIMB_BITS); (got < MP_DIGIT_BIT) && (++ix < n); got += S_LIMB_BITS) {
+            v |= (mp_digit)r[ix] << got;
+         }
+      }
+      a->dp[i] = v & MP_MASK;
+   }
+   s_mp_zero_digs(a->dp + digs, a->used - digs);
+   a->used = digs;
+   a->sign = MP_ZPOS;
+   mp_clamp(a);
+   return MP_OKAY;
+}
+
+/* r = a*b/R mod m, with a, b < 2m the result is < 2m
+ *
+ * n limbs in nv vectors, the limbs above n are zero.  Every round adds
+ * less than 2**54 to an accumulator, so up to 1024 limbs would not
+ * overflow them.
+ */
+__attribute__((target("avx512f,avx512ifma")))
+static void s_mont_mul(uint64_t *r, const uint64_t *a, const uint64_t *b, const uint64_t *m, uint64_t rho, int n, int nv)
+{
+   __m512i acc[S_MAX_VECS], va[S_MAX_VECS], vm[S_MAX_VECS];
+   uint64_t t[S_MAX_VECS * 8], c;
+   int i, j;
+
+   for (j = 0; j < nv; j++) {
+      acc[j] = _mm512_setzero_si512();
+      va[j] = _mm512_loadu_si512((const void *)(a + (8 * j)));
+      vm[j] = _mm512_loadu_si512((const void *)(m + (8 * j)));
+   }
+
+   for (i = 0; i < n; i++) {
+      __m512i vb = _mm512_set1_epi64((long long)b[i]), vy;
+      uint64_t lo, mu;
+
+      /* acc += lo(a * b[i]) */
+      for (j = 0; j < nv; j++) {
+         acc[j] = _mm512_madd52lo_epu64(acc[j], va[j], vb);
+      }
+
+      /* mu = acc[0] * rho mod 2**52, acc += lo(m * mu) clears the lowest limb */
+      lo = (uint64_t)_mm_cvtsi128_si64(_mm512_castsi512_si128(acc[0]));
+      mu = (lo * rho) & S_LIMB_MASK;
+      vy = _mm512_set1_epi64((long long)mu);
+      for (j = 0; j < nv; j++) {
+         acc[j] = _mm512_madd52lo_epu64(acc[j], vm[j], vy);
+      }
+      c = (lo + ((m[0] * mu) & S_LIMB_MASK)) >> S_LIMB_BITS;
+
+      /* acc = acc / 2**52, the high halves are one limb up, that is where they land now */
+      for (j = 0; j < (nv - 1); j++) {
+         acc[j] = _mm512_alignr_epi64(acc[j + 1], acc[j], 1);
+      }
+      acc[nv - 1] = _mm512_alignr_epi64(_mm512_setzero_si512(), acc[nv - 1], 1);
+      acc[0] = _mm512_add_epi64(acc[0], _mm512_maskz_set1_epi64((__mmask8)1, (long long)c));
+
+      for (j = 0; j < nv; j++) {
+         acc[j] = _mm512_madd52hi_epu64(acc[j], va[j], vb);
+         acc[j] = _mm512_madd52hi_epu64(acc[j], vm[j], vy);
+      }
+   }
+
+   /* normalize to 52-bit limbs */
+   for (j = 0; j < nv; j++) {
+      _mm512_storeu_si512((void *)(t + (8 * j)), acc[j]);
+   }
+   c = 0;
+   for (i = 0; i < (8 * nv); i++) {
+      c += t[i];
+      r[i] = c & S_LIMB_MASK;
+      c >>= S_LIMB_BITS;
+   }
+}
+
+mp_err s_mp_exptmod_ifma(const mp_int *G, const mp_int *X, const mp_int *P, const mp_int *rr, mp_int *Y)
+{
+   mp_int   t;
+   uint64_t *buf, *M, *R2, *acc, *one, *tab, rho, inv;
+   int      n, nv, len, winsize, x, i, k, bitidx;
+   size_t   size;
+   mp_err   err;
+
+   /* R = 2**(52*n) > 4P */
+   n = (mp_count_bits(P) + 2 + (S_LIMB_BITS - 1)) / S_LIMB_BITS;
+   nv = (n + 7) / 8;
+   if ((nv > S_MAX_VECS) || mp_iseven(P)) {
+      return MP_VAL;
+   }
+   len = nv * 8;
+
+   x = mp_count_bits(X);
+   winsize = (x <= 64) ? 3 : ((x <= 512) ? 4 : 5);
+
+   /* layout: P, R**2 mod P, the accumulator, the one and the table */
+   size = sizeof(uint64_t) * (size_t)len * (4u + (1u << winsize));
+   buf = (uint64_t *) MP_MALLOC(size);
+   if (buf == NULL) {
+      return MP_MEM;
+   }
+   M = buf;
+   R2 = M + len;
+   acc = R2 + len;
+   one = acc + len;
+   tab = one + len;
+
+   if ((err = mp_init_size(&t, P->used + 1)) != MP_OKAY)        goto LBL_BUF;
+
+   s_to_limbs(P, M, len);
+
+   /* rho = -1/P mod 2**52, Newton iteration doubles the correct bits */
+   inv = M[0];
+   for (i = 0; i < 6; i++) {
+      inv *= 2u - (M[0] * inv);
+   }
+   rho = (0u - inv) & S_LIMB_MASK;
+
+   /* R**2 mod P, the one of mp_mont_ctx if there is one */
+   if (rr == NULL) {
+      if ((err = s_mp_ifma_rr(P, &t)) != MP_OKAY)               goto LBL_ERR;
+      rr = &t;
+   }
+   s_to_limbs(rr, R2, len);
+
+   /* tab[0] = R mod P, tab[k] = G**k * R mod P */
+   for (i = 0; i < len; i++) {
+      one[i] = 0u;
+   }
+   one[0] = 1u;
+   s_mont_mul(tab, one, R2, M, rho, n, nv);
+   if ((err = mp_mod(G, P, &t)) != MP_OKAY)                    goto LBL_ERR;
+   s_to_limbs(&t, acc, len);
+   s_mont_mul(tab + len, acc, R2, M, rho, n, nv);
+   for (k = 2; k < (1 << winsize); k++) {
+      s_mont_mul(tab + ((size_t)k * (size_t)len), tab + ((size_t)(k - 1) * (size_t)len), tab + len, M, rho, n, nv);
+   }
+
+   /* left-to-right, winsize bits at a time */
+   for (i = 0; i < len; i++) {
+      acc[i] = tab[i];
+   }
+   for (bitidx = ((x + winsize - 1) / winsize) * winsize; bitidx > 0;) {
+      int win = 0;
+      for (k = 0; k < winsize; k++) {
+         --bitidx;
+         win = (win << 1) | (s_mp_get_bit(X, bitidx) ? 1 : 0);
+         s_mont_mul(acc, acc, acc, M, rho, n, nv);
+      }
+      if (win != 0) {
+         s_mont_mul(acc, acc, tab + ((size_t)win * (size_t)len), M, rho, n, nv);
+      }
+   }
+
+   /* leave the Montgomery domain, the result is at most P */
+   s_mont_mul(acc, acc, one, M, rho, n, nv);
+   if ((err = s_from_limbs(acc, n, &t)) != MP_OKAY)            goto LBL_ERR;
+   if (mp_cmp_mag(&t, P) != MP_LT) {
+      if ((err = s_mp_sub(&t, P, &t)) != MP_OKAY)              goto LBL_ERR;
+   }
+   mp_exch(&t, Y);
+
+LBL_ERR:
+   mp_clear(&t);
+LBL_BUF:
+   MP_FREE_BUF(buf, size);
+   return err;
+}
+
+#else
+
+mp_err s_mp_exptmod_ifma(const mp_int *G, const mp_int *X, const mp_int *P, const mp_int *rr, mp_int *Y)
+{
+   (void)G;
+   (void)X;
+   (void)P;
+   (void)rr;
+   (void)Y;
+   return MP_VAL;
+}
+
+#endif
+#endif
@@ -0,0 +1,131 @@
+#include "tommath_private.h"
+#ifdef S_MP_EXPTMOD_LAZY_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+
+/* computes Y == G**X mod P for odd P with lazy Montgomery reduction
+ *
+ * All values live in arrays of nu digits with 4P < B**nu and are only kept
+ * below 2P by s_mp_mont_mul_lazy(), no comparison with P and no mp_int
+ * bookkeeping in the sliding window of s_mp_exptmod_window().  The result is
+ * brought below P once at the end.
+ */
+
+#ifdef MP_LOW_MEM
+#   define MAX_WINSIZE 5
+#else
+#   define MAX_WINSIZE 8
+#endif
+
+/* P padded to nu digits, the digits mu of the products */
+typedef struct {
+   const mp_digit *N;
+   mp_digit       *t, rho;
+   int            nu;
+} s_ctx;
+
+static mp_err s_mul(const void *ctx, const void *a, const void *b, void *c)
+{
+   const s_ctx *m = (const s_ctx *)ctx;
+   s_mp_mont_mul_lazy((const mp_digit *)a, (const mp_digit *)b, (mp_digit *)c, m->N, m->nu, m->rho, m->t);
+   return MP_OKAY;
+}
+
+static mp_err s_sqr(const void *ctx, const void *a, void *c)
+{
+   const s_ctx *m = (const s_ctx *)ctx;
+   s_mp_mont_mul_lazy((const mp_digit *)a, (const mp_digit *)a, (mp_digit *)c, m->N, m->nu, m->rho, m->t);
+   return MP_OKAY;
+}
+
+static mp_err s_copy(const void *ctx, const void *a, void *c)
+{
+   s_mp_copy_digs((mp_digit *)c, (const mp_digit *)a, ((const s_ctx *)ctx)->nu);
+   return MP_OKAY;
+}
+
+mp_err s_mp_exptmod_lazy(const mp_int *G, const mp_int *X, const mp_int *P, mp_int *Y)
+{
+   mp_int    r, g;
+   mp_digit  *M, *res, *one, *N;
+   mp_window w;
+   s_ctx     ctx;
+   mp_err    err;
+   int       nu, size, winsize;
+
+   if ((err = mp_montgomery_setup(P, &ctx.rho)) != MP_OKAY) {
+      return err;
+   }
+
+   /* one digit more if the top digit of P leaves no room for 4P */
+   nu = P->used;
+   if (mp_count_bits(P) > ((nu * MP_DIGIT_BIT) - 2)) {
+      nu++;
+   }
+
+   winsize = MP_MIN(MAX_WINSIZE, s_mp_exptmod_winsize(mp_count_bits(X)));
+
+   /* the odd powers, res, the one, P padded to nu digits and the digits mu
+    * or the 2 * nu + 1 digits of the BMI2/ADX product
+    */
+   size = (((1 << (winsize - 1)) + 5) * nu) + 1;
+   M = (mp_digit *) MP_MALLOC(sizeof(mp_digit) * (size_t)size);
+   if (M == NULL) {
+      return MP_MEM;
+   }
+   res = M + ((1 << (winsize - 1)) * nu);
+   one = res + nu;
+   N = one + nu;
+   ctx.t = N + nu;
+   s_mp_copy_digs(N, P->dp, P->used);
+   s_mp_zero_digs(N + P->used, nu - P->used);
+   ctx.N = N;
+   ctx.nu = nu;
+
+   w.mul = s_mul;
+   w.sqr = s_sqr;
+   w.copy = s_copy;
+   w.ctx = &ctx;
+   w.one = one;
+   w.M = M;
+   w.res = res;
+   w.size = sizeof(mp_digit) * (size_t)nu;
+
+   if ((err = mp_init_multi(&r, &g, NULL)) != MP_OKAY) {
+      goto LBL_M;
+   }
+
+   /* one = R mod P, M[0] = G * R mod P */
+   if ((err = mp_2expt(&r, nu * MP_DIGIT_BIT)) != MP_OKAY)       goto LBL_ERR;
+   if ((err = mp_mod(&r, P, &r)) != MP_OKAY)                     goto LBL_ERR;
+   if ((err = mp_mulmod(G, &r, P, &g)) != MP_OKAY)               goto LBL_ERR;
+   s_mp_copy_digs(one, r.dp, r.used);
+   s_mp_zero_digs(one + r.used, nu - r.used);
+   s_mp_copy_digs(M, g.dp, g.used);
+   s_mp_zero_digs(M + g.used, nu - g.used);
+
+   if ((err = s_mp_exptmod_window(&w, X, winsize)) != MP_OKAY)   goto LBL_ERR;
+
+   /* res * 1 / R is at most P, equal only for res = 0 mod P */
+   s_mp_zero_digs(M, nu);
+   M[0] = 1u;
+   s_mp_mont_mul_lazy(res, M, res, N, nu, ctx.rho, ctx.t);
+
+   if ((err = mp_grow(&r, nu)) != MP_OKAY)                       goto LBL_ERR;
+   s_mp_copy_digs(r.dp, res, nu);
+   s_mp_zero_digs(r.dp + nu, r.used - nu);
+   r.used = nu;
+   mp_clamp(&r);
+   if (mp_cmp_mag(&r, P) != MP_LT) {
+      if ((err = s_mp_sub(&r, P, &r)) != MP_OKAY)               goto LBL_ERR;
+   }
+   mp_exch(&r, Y);
+
+LBL_ERR:
+   mp_clear_multi(&r, &g, NULL);
+LBL_M:
+   MP_FREE_BUF(M, sizeof(mp_digit) * (size_t)size);
+   return err;
+}
+#undef MAX_WINSIZE
+#endif
@@ -0,0 +1,87 @@
+#include "tommath_private.h"
+#ifdef S_MP_EXPTMOD_SOLINAS_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+
+/* computes Y == G**X mod P for the modulus P of s_mp_solinas_tab[form]
+ *
+ * The numbers are converted at entry to 32-bit words and back at the exit,
+ * in between s_mp_solinas_mul() multiplies and reduces them in place in the
+ * sliding window of s_mp_exptmod_window().
+ */
+
+#ifdef MP_LOW_MEM
+#   define MAX_WINSIZE 5
+#else
+#   define MAX_WINSIZE 6
+#endif
+
+/* the modulus of s_mp_solinas_tab and its words */
+typedef struct {
+   int form, n;
+} s_ctx;
+
+static mp_err s_mul(const void *ctx, const void *a, const void *b, void *c)
+{
+   s_mp_solinas_mul((const uint32_t *)a, (const uint32_t *)b, (uint32_t *)c, ((const s_ctx *)ctx)->form);
+   return MP_OKAY;
+}
+
+static mp_err s_sqr(const void *ctx, const void *a, void *c)
+{
+   s_mp_solinas_mul((const uint32_t *)a, (const uint32_t *)a, (uint32_t *)c, ((const s_ctx *)ctx)->form);
+   return MP_OKAY;
+}
+
+static mp_err s_copy(const void *ctx, const void *a, void *c)
+{
+   int x;
+   for (x = 0; x < ((const s_ctx *)ctx)->n; x++) {
+      ((uint32_t *)c)[x] = ((const uint32_t *)a)[x];
+   }
+   return MP_OKAY;
+}
+
+mp_err s_mp_exptmod_solinas(const mp_int *G, const mp_int *X, const mp_int *P, mp_int *Y, int form)
+{
+   uint32_t  M[1 << (MAX_WINSIZE - 1)][MP_SOLINAS_MAX_WORDS], res[MP_SOLINAS_MAX_WORDS], one[MP_SOLINAS_MAX_WORDS];
+   mp_int    t;
+   mp_window w;
+   s_ctx     ctx;
+   mp_err    err;
+   int       winsize = MP_MIN(MAX_WINSIZE, s_mp_exptmod_winsize(mp_count_bits(X))), x;
+
+   ctx.form = form;
+   ctx.n = (s_mp_solinas_tab[form].bits + 31) / 32;
+
+   w.mul = s_mul;
+   w.sqr = s_sqr;
+   w.copy = s_copy;
+   w.ctx = &ctx;
+   w.one = one;
+   w.M = M;
+   w.res = res;
+   w.size = sizeof(M[0]);
+
+   /* 1 for X = 0 */
+   for (x = 0; x < ctx.n; x++) {
+      one[x] = 0u;
+   }
+   one[0] = 1u;
+
+   if ((err = mp_init_size(&t, P->used + 1)) != MP_OKAY) {
+      return err;
+   }
+
+   if ((err = mp_mod(G, P, &t)) != MP_OKAY)                       goto LBL_ERR;
+   s_mp_to_words(&t, M[0], ctx.n);
+   if ((err = s_mp_exptmod_window(&w, X, winsize)) != MP_OKAY)    goto LBL_ERR;
+   if ((err = s_mp_from_words(res, ctx.n, &t)) != MP_OKAY)        goto LBL_ERR;
+   mp_exch(&t, Y);
+
+LBL_ERR:
+   mp_clear(&t);
+   return err;
+}
+#undef MAX_WINSIZE
+#endif
@@ -0,0 +1,71 @@
+#include "tommath_private.h"
+#ifdef S_MP_EXPTMOD_WINDOW_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+
+/* res = G**X for X >= 0 in the arithmetic of w, G in M[0] on entry
+ *
+ * Left-to-right sliding window over the odd powers G, G**3, ..., G**(2**k - 1)
+ * with k = winsize, see HAC pp.616, Algorithm 14.85.  The table is filled
+ * here, the callers only convert G and the result.  Values are opaque, M[x]
+ * is w->size bytes after M[x - 1].
+ */
+mp_err s_mp_exptmod_window(const mp_window *w, const mp_int *X, int winsize)
+{
+   char   *M = (char *)w->M;
+   mp_err err;
+   int    x, i, j;
+   bool   first = true;
+
+   /* M[x] = G**(2x + 1), res = G**2 for now */
+   if ((err = w->sqr(w->ctx, M, w->res)) != MP_OKAY) {
+      return err;
+   }
+   for (x = 1; x < (1 << (winsize - 1)); x++) {
+      if ((err = w->mul(w->ctx, M + ((size_t)(x - 1) * w->size), w->res, M + ((size_t)x * w->size))) != MP_OKAY) {
+         return err;
+      }
+   }
+
+   for (i = mp_count_bits(X) - 1; i >= 0;) {
+      int v;
+
+      if (!s_mp_get_bit(X, i)) {
+         if ((err = w->sqr(w->ctx, w->res, w->res)) != MP_OKAY) {
+            return err;
+         }
+         i--;
+         continue;
+      }
+
+      /* the longest window X[i..j] of at most winsize bits that ends with a one */
+      j = MP_MAX(i - winsize + 1, 0);
+      while (!s_mp_get_bit(X, j)) {
+         j++;
+      }
+      for (v = 0, x = i; x >= j; x--) {
+         v = (v << 1) | (s_mp_get_bit(X, x) ? 1 : 0);
+      }
+
+      if (first) {
+         /* the leading window needs no squarings of the one */
+         err = w->copy(w->ctx, M + ((size_t)(v >> 1) * w->size), w->res);
+         first = false;
+      } else {
+         for (x = i; x >= j; x--) {
+            if ((err = w->sqr(w->ctx, w->res, w->res)) != MP_OKAY) {
+               return err;
+            }
+         }
+         err = w->mul(w->ctx, w->res, M + ((size_t)(v >> 1) * w->size), w->res);
+      }
+      if (err != MP_OKAY) {
+         return err;
+      }
+      i = j - 1;
+   }
+
+   /* G**0 */
+   return first ? w->copy(w->ctx, w->one, w->res) : MP_OKAY;
+}
+#endif
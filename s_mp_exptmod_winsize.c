@@ -0,0 +1,28 @@
+#include "tommath_private.h"
+#ifdef S_MP_EXPTMOD_WINSIZE_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+
+/* size of the sliding window for an exponent of the given bits, 2 to 8
+ *
+ * Each step up doubles the table of odd powers and saves a multiplication
+ * every winsize + 1 bits or so, the callers cap it for their memory.
+ */
+int s_mp_exptmod_winsize(int bits)
+{
+   if (bits <= 7) {
+      return 2;
+   } else if (bits <= 36) {
+      return 3;
+   } else if (bits <= 140) {
+      return 4;
+   } else if (bits <= 450) {
+      return 5;
+   } else if (bits <= 1303) {
+      return 6;
+   } else if (bits <= 3529) {
+      return 7;
+   }
+   return 8;
+}
+#endif
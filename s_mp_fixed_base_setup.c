@@ -0,0 +1,57 @@
+#include "tommath_private.h"
+#ifdef S_MP_FIXED_BASE_SETUP_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+
+/* the part of mp_fixed_base_ctx_init() and mp_fixed_base_ctx_import() that
+ * does not fill the table: the Montgomery context, G mod n, the shape of the
+ * comb and the memory of the table
+ *
+ * A comb of h rows covers bits bits with rows of a = ceil(bits / h) bits.
+ * h grows with the exponents up to MAX_COMB, the table should not be much
+ * larger than the 2 * bits multiplications it saves per exponentiation.
+ * Rows of 8 bits and more are split into v = 2 columns, which halves the
+ * squarings again for twice the table.
+ */
+
+#ifdef MP_LOW_MEM
+#   define MAX_COMB 4
+#else
+#   define MAX_COMB 8
+#endif
+
+mp_err s_mp_fixed_base_setup(mp_fixed_base_ctx *ctx, const mp_int *G, const mp_int *n, int bits)
+{
+   mp_err err;
+   int    a;
+
+   if (bits < 1) {
+      return MP_VAL;
+   }
+
+   if ((err = mp_mont_ctx_init(&ctx->mont, n)) != MP_OKAY) {
+      return err;
+   }
+   if ((err = mp_init(&ctx->g)) != MP_OKAY)                               goto LBL_MONT;
+   if ((err = mp_mod(G, n, &ctx->g)) != MP_OKAY)                          goto LBL_G;
+
+   ctx->bits = bits;
+   for (ctx->h = MAX_COMB; (ctx->h > 1) && ((1 << ctx->h) > (4 * bits)); ctx->h--) {}
+   a = (bits + ctx->h - 1) / ctx->h;
+   ctx->v = (a >= 8) ? 2 : 1;
+
+   ctx->table = (mp_digit *) MP_MALLOC(sizeof(mp_digit) * mp_fixed_base_count(ctx));
+   if (ctx->table == NULL) {
+      err = MP_MEM;
+      goto LBL_G;
+   }
+   return MP_OKAY;
+
+LBL_G:
+   mp_clear(&ctx->g);
+LBL_MONT:
+   mp_mont_ctx_clear(&ctx->mont);
+   return err;
+}
+#undef MAX_COMB
+#endif
@@ -0,0 +1,29 @@
+#include "tommath_private.h"
+#ifdef S_MP_FROM_WORDS_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+
+/* a = w[0..n-1], 32-bit words */
+mp_err s_mp_from_words(const uint32_t *w, int n, mp_int *a)
+{
+   int i, digs = ((n * 32) + (MP_DIGIT_BIT - 1)) / MP_DIGIT_BIT;
+   mp_err err;
+
+   if ((err = mp_grow(a, digs)) != MP_OKAY) {
+      return err;
+   }
+   for (i = 0; i < digs; i++) {
+      int pos = i * MP_DIGIT_BIT, ix = pos / 32, got;
+      mp_digit v = (mp_digit)(w[ix] >> (pos % 32));
+      for (got = 32 - (pos % 32); (got < MP_DIGIT_BIT) && (++ix < n); got += 32) {
+         v |= (mp_digit)((mp_digit)w[ix] << got);
+      }
+      a->dp[i] = v & MP_MASK;
+   }
+   s_mp_zero_digs(a->dp + digs, a->used - digs);
+   a->used = digs;
+   a->sign = MP_ZPOS;
+   mp_clamp(a);
+   return MP_OKAY;
+}
+#endif
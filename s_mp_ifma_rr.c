@@ -0,0 +1,17 @@
+#include "tommath_private.h"
+#ifdef S_MP_IFMA_RR_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+
+/* rr = R**2 mod P for the R = 2**(52*n) > 4P of s_mp_exptmod_ifma() */
+mp_err s_mp_ifma_rr(const mp_int *P, mp_int *rr)
+{
+   mp_err err;
+   int n = (mp_count_bits(P) + 2 + (MP_IFMA_LIMB_BITS - 1)) / MP_IFMA_LIMB_BITS;
+
+   if ((err = mp_2expt(rr, 2 * MP_IFMA_LIMB_BITS * n)) != MP_OKAY) {
+      return err;
+   }
+   return mp_mod(rr, P, rr);
+}
+#endif
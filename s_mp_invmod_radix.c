@@ -0,0 +1,46 @@
+#include "tommath_private.h"
+#ifdef S_MP_INVMOD_RADIX_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+
+/* x = 1/b mod B**n for an odd b by Newton iteration, every step doubles the
+ * number of correct digits: x = x + x * (1 - b * x) mod B**2k
+ */
+mp_err s_mp_invmod_radix(const mp_int *b, int n, mp_int *x)
+{
+   mp_int t, u;
+   mp_digit rho;
+   mp_err err;
+   int k, k2;
+
+   if ((err = mp_init_multi(&t, &u, NULL)) != MP_OKAY) {
+      return err;
+   }
+
+   if ((err = mp_montgomery_setup(b, &rho)) != MP_OKAY)                   goto LBL_ERR;
+   mp_set(x, ((mp_digit)0 - rho) & MP_MASK);
+
+   for (k = 1; k < n; k = k2) {
+      k2 = MP_MIN(2 * k, n);
+
+      /* b * x = 1 + h * B**k mod B**2k */
+      if ((err = mp_mod_2d(b, k2 * MP_DIGIT_BIT, &u)) != MP_OKAY)         goto LBL_ERR;
+      if ((err = mp_mul_low(&u, x, k2, &t)) != MP_OKAY)                   goto LBL_ERR;
+      if ((err = mp_sub_d(&t, 1u, &t)) != MP_OKAY)                        goto LBL_ERR;
+      mp_rshd(&t, k);
+
+      /* x = x + (-h * x mod B**k) * B**k */
+      if ((err = mp_mul_low(x, &t, k2 - k, &t)) != MP_OKAY)               goto LBL_ERR;
+      if (!mp_iszero(&t)) {
+         if ((err = mp_2expt(&u, (k2 - k) * MP_DIGIT_BIT)) != MP_OKAY)    goto LBL_ERR;
+         if ((err = mp_sub(&u, &t, &t)) != MP_OKAY)                       goto LBL_ERR;
+         if ((err = mp_lshd(&t, k)) != MP_OKAY)                           goto LBL_ERR;
+         if ((err = mp_add(x, &t, x)) != MP_OKAY)                         goto LBL_ERR;
+      }
+   }
+
+LBL_ERR:
+   mp_clear_multi(&t, &u, NULL);
+   return err;
+}
+#endif
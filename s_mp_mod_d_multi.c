@@ -0,0 +1,67 @@
+#include "tommath_private.h"
+#ifdef S_MP_MOD_D_MULTI_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+
+/* r[i] = |a| mod b[i] for the n small divisors b[i]
+ *
+ * Consecutive divisors are multiplied into products below B and |a| is
+ * reduced modulo up to S_GROUPS of them in a single pass over its digits,
+ * with the reciprocal of MP_DIV_2BY1 and no division per digit.  The
+ * residues of the single divisors are taken from those of the products.
+ */
+#define S_GROUPS 16
+
+mp_err s_mp_mod_d_multi(const mp_int *a, const mp_digit *b, int n, mp_digit *r)
+{
+   mp_digit d[S_GROUPS], v[S_GROUPS], w[S_GROUPS];
+   int s[S_GROUPS], first[S_GROUPS + 1];
+   int g, i, k, ix;
+
+   for (i = 0; i < n; i++) {
+      if (b[i] == 0u) {
+         return MP_VAL;
+      }
+   }
+
+   while (n > 0) {
+      /* pack the next divisors into the products d[k], normalized */
+      for (g = 0, i = 0; (g < S_GROUPS) && (i < n); g++) {
+         mp_digit p = b[i];
+         first[g] = i++;
+         while ((i < n) && (b[i] <= (MP_MASK / p))) {
+            p *= b[i++];
+         }
+         for (s[g] = 0; (p << s[g]) <= (MP_MASK >> 1); s[g]++) {}
+         d[g] = p << s[g];
+         v[g] = MP_DIV_2BY1_RECIP(d[g]);
+         w[g] = 0u;
+      }
+      first[g] = i;
+
+      /* w[k] = |a| * 2**s[k] mod d[k] */
+      for (ix = a->used; ix --> 0;) {
+         mp_digit x = a->dp[ix];
+         for (k = 0; k < g; k++) {
+            mp_digit q, u1 = (mp_digit)(w[k] + ((x >> 1) >> (MP_DIGIT_BIT - 1 - s[k]))),
+                        u0 = (x << s[k]) & MP_MASK;
+            MP_DIV_2BY1(q, w[k], u1, u0, d[k], v[k]);
+            (void)q;
+         }
+      }
+
+      for (k = 0; k < g; k++) {
+         mp_digit t = w[k] >> s[k];
+         for (ix = first[k]; ix < first[k + 1]; ix++) {
+            r[ix] = t % b[ix];
+         }
+      }
+
+      b += i;
+      r += i;
+      n -= i;
+   }
+   return MP_OKAY;
+}
+#undef S_GROUPS
+#endif
@@ -0,0 +1,91 @@
+#include "tommath_private.h"
+#ifdef S_MP_MONT_MUL_COMBA_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+
+/* c = a * b / R mod n for 0 <= a, b < n and R = B**n->used
+ *
+ * The product and its Montgomery reduction fused into one comba pass
+ * (finely integrated product scanning): every column sums the products
+ * a[j] * b[i - j] and mu[j] * n[i - j] together, the digit mu[i] that
+ * makes the lower column i zero is found on the way.  The upper columns
+ * are the digits of the result.  No double length product is formed.
+ *
+ * Column i needs the digits mu[j] for j > i - nu only, the result digit of
+ * column i takes the place of mu[i - nu].  The operands are padded to the
+ * length of n, so both products of a column come in one loop.  They are
+ * folded every MP_COMBA_BLOCK / 2 pairs, every pair for 16-bit digits that
+ * leave room for three products only.
+ */
+mp_err s_mp_mont_mul_comba(const mp_int *a, const mp_int *b, mp_int *c, const mp_int *n, mp_digit rho)
+{
+   int      ix, iy, iz, nu = n->used, oldused, size = (3 * nu) + 1;
+   mp_err   err;
+   mp_digit buf[MP_COMBA_STACK], *A, *B, *W, _C;
+   const mp_digit *N = n->dp;
+   mp_word  _W;
+
+   /* a and b padded to nu digits, then mu and the result */
+   if (size <= MP_COMBA_STACK) {
+      A = buf;
+   } else if ((A = (mp_digit *) MP_MALLOC(sizeof(mp_digit) * (size_t)size)) == NULL) {
+      return MP_MEM;
+   }
+   B = A + nu;
+   W = B + nu;
+   s_mp_copy_digs(A, a->dp, a->used);
+   s_mp_zero_digs(A + a->used, nu - a->used);
+   s_mp_copy_digs(B, b->dp, b->used);
+   s_mp_zero_digs(B + b->used, nu - b->used);
+
+   _W = 0;
+   _C = 0;
+   for (ix = 0; ix < (nu * 2); ix++) {
+      /* the products a[iz] * b[ix - iz] and mu[iz] * n[ix - iz] of the column,
+       * mu[ix] is not known yet in the lower half
+       */
+      iz = MP_MAX(0, (ix - nu) + 1);
+      iy = MP_MIN(ix, nu);
+      while (iz < iy) {
+         int ie = iz + MP_MIN(iy - iz, MP_MAX(MP_COMBA_BLOCK / 2, 1));
+         for (; iz < ie; iz++) {
+            MP_COMBA_ADD(_W, _C, (mp_word)A[iz] * (mp_word)B[ix - iz]);
+            MP_COMBA_ADD(_W, _C, (mp_word)W[iz] * (mp_word)N[ix - iz]);
+         }
+         MP_COMBA_FOLD(_W, _C);
+      }
+
+      if (ix < nu) {
+         /* mu = W * rho mod B makes the column zero */
+         MP_COMBA_ADD(_W, _C, (mp_word)A[ix] * (mp_word)B[0]);
+         W[ix] = ((mp_digit)_W * rho) & MP_MASK;
+         MP_COMBA_ADD(_W, _C, (mp_word)W[ix] * (mp_word)N[0]);
+      } else {
+         W[ix - nu] = (mp_digit)_W & MP_MASK;
+      }
+      MP_COMBA_SHIFT(_W, _C);
+   }
+   W[nu] = (mp_digit)_W & MP_MASK;
+
+   if ((err = mp_grow(c, nu + 1)) != MP_OKAY) {
+      goto LBL_ERR;
+   }
+   oldused = c->used;
+   s_mp_copy_digs(c->dp, W, nu + 1);
+   c->used = nu + 1;
+   s_mp_zero_digs(c->dp + c->used, oldused - c->used);
+   c->sign = MP_ZPOS;
+   mp_clamp(c);
+
+   /* if c >= n then c = c - n */
+   if (mp_cmp_mag(c, n) != MP_LT) {
+      err = s_mp_sub(c, n, c);
+   }
+
+LBL_ERR:
+   if (A != buf) {
+      MP_FREE_BUF(A, sizeof(mp_digit) * (size_t)size);
+   }
+   return err;
+}
+#endif
@@ -0,0 +1,113 @@
+#include "tommath_private.h"
+#ifdef S_MP_MONT_MUL_LAZY_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+
+/* c = a * b / R mod n for nu digit arrays with 0 <= a, b < 2n, R = B**nu and 4n < R
+ *
+ * The fused product and reduction of s_mp_mont_mul_comba() without the final
+ * subtraction: c = (a * b + mu * n) / R < 2n again, so the results can be
+ * multiplied without ever comparing them to n (almost Montgomery
+ * multiplication).  a == b is squared, the products a[i] * a[j] for i != j
+ * once and doubled.
+ *
+ * The digits mu go to t, nu digits.  The result digits are written after the
+ * columns that read the digits of a and b at the same place, so c may be a
+ * or b.  With BMI2/ADX the product and the reduction are the rows of
+ * s_mp_addmul_adx() in t instead, which needs 2 * nu + 1 digits.
+ */
+static void s_mont_mul_adx(const mp_digit *a, const mp_digit *b, mp_digit *c, const mp_digit *n, int nu, mp_digit rho, mp_digit *t)
+{
+   int ix, iy;
+
+   /* t = a * b, row ix ends in the digit t[ix + nu] no other row wrote yet */
+   s_mp_zero_digs(t, nu);
+   for (ix = 0; ix < nu; ix++) {
+      t[ix + nu] = s_mp_addmul_adx(t + ix, a, nu, b[ix]);
+   }
+   t[2 * nu] = 0u;
+
+   /* t = t + mu * n, the lower nu digits become zero */
+   for (ix = 0; ix < nu; ix++) {
+      mp_digit u = s_mp_addmul_adx(t + ix, n, nu, (t[ix] * rho) & MP_MASK);
+      for (iy = ix + nu; u != 0u; iy++) {
+         mp_word r = (mp_word)t[iy] + (mp_word)u;
+         u         = (mp_digit)(r >> (mp_word)MP_DIGIT_BIT);
+         t[iy]     = (mp_digit)(r & (mp_word)MP_MASK);
+      }
+   }
+
+   /* below 2n < R, t[2 * nu] is zero */
+   s_mp_copy_digs(c, t + nu, nu);
+}
+
+void s_mp_mont_mul_lazy(const mp_digit *a, const mp_digit *b, mp_digit *c, const mp_digit *n, int nu, mp_digit rho, mp_digit *t)
+{
+   int      ix;
+   mp_word  W1 = 0;
+   mp_digit C1 = 0;
+
+   if (MP_HAS(S_MP_ADDMUL_ADX) && s_mp_cpu_adx()) {
+      s_mont_mul_adx(a, b, c, n, nu, rho, t);
+      return;
+   }
+
+   for (ix = 0; ix < (nu * 2); ix++) {
+      int      tx, ty, iy, iz;
+      mp_word  _W = 0;
+      mp_digit _C = 0;
+
+      /* the products a[tx + iz] * b[ty - iz] of the column */
+      ty = MP_MIN(nu - 1, ix);
+      tx = ix - ty;
+      iy = (ty - tx) + 1;
+      if (a == b) {
+         iy >>= 1;
+      }
+      if (iy <= MP_COMBA_BLOCK) {
+         for (iz = 0; iz < iy; iz++) {
+            MP_COMBA_ADD(_W, _C, (mp_word)a[tx + iz] * (mp_word)b[ty - iz]);
+         }
+      } else {
+         mp_digit hi;
+         MP_COMBA_ADD(_W, _C, s_mp_comba_column(a + tx, b + ty, iy, &hi));
+         _C += hi;
+         MP_COMBA_FOLD(_W, _C);
+      }
+      if (a == b) {
+         MP_COMBA_DBL(_W, _C);
+         if (((unsigned)ix & 1u) == 0u) {
+            MP_COMBA_ADD(_W, _C, (mp_word)a[ix >> 1] * (mp_word)a[ix >> 1]);
+         }
+      }
+      MP_COMBA_ADD(_W, _C, W1);
+      _C += C1;
+      MP_COMBA_FOLD(_W, _C);
+
+      /* the products mu[tx + iz] * n[ix - tx - iz], mu[ix] is not known yet */
+      tx = MP_MAX(0, (ix - nu) + 1);
+      iy = MP_MIN(ix, nu) - tx;
+      if (iy <= MP_COMBA_BLOCK) {
+         for (iz = 0; iz < iy; iz++) {
+            MP_COMBA_ADD(_W, _C, (mp_word)t[tx + iz] * (mp_word)n[ix - tx - iz]);
+         }
+      } else {
+         mp_digit hi;
+         MP_COMBA_ADD(_W, _C, s_mp_comba_column(t + tx, n + (ix - tx), iy, &hi));
+         _C += hi;
+         MP_COMBA_FOLD(_W, _C);
+      }
+
+      if (ix < nu) {
+         /* mu = W * rho mod B makes the column zero */
+         t[ix] = ((mp_digit)_W * rho) & MP_MASK;
+         MP_COMBA_ADD(_W, _C, (mp_word)t[ix] * (mp_word)n[0]);
+      } else {
+         c[ix - nu] = (mp_digit)_W & MP_MASK;
+      }
+      MP_COMBA_SHIFT(_W, _C);
+      W1 = _W;
+      C1 = _C;
+   }
+}
+#endif
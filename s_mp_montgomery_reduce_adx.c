@@ -0,0 +1,51 @@
+#include "tommath_private.h"
+#ifdef S_MP_MONTGOMERY_REDUCE_ADX_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+
+/* computes xR**-1 == x (mod N) via Montgomery Reduction
+ *
+ * Same as mp_montgomery_reduce but a = a + mu * m * b**i is computed
+ * by s_mp_addmul_adx.
+ */
+mp_err s_mp_montgomery_reduce_adx(mp_int *x, const mp_int *n, mp_digit rho)
+{
+   mp_err err;
+   int ix, digs;
+
+   /* grow the input as required */
+   digs = (n->used * 2) + 1;
+   if ((err = mp_grow(x, digs)) != MP_OKAY) {
+      return err;
+   }
+   x->used = digs;
+
+   for (ix = 0; ix < n->used; ix++) {
+      int iy;
+
+      /* mu = ai * rho mod b */
+      mp_digit mu = (mp_digit)(((mp_word)x->dp[ix] * (mp_word)rho) & MP_MASK);
+
+      /* a = a + mu * m * b**i */
+      mp_digit u = s_mp_addmul_adx(x->dp + ix, n->dp, n->used, mu);
+
+      /* propagate carries upwards as required*/
+      for (iy = ix + n->used; u != 0u; iy++) {
+         mp_word r = (mp_word)x->dp[iy] + (mp_word)u;
+         u         = (mp_digit)(r >> (mp_word)MP_DIGIT_BIT);
+         x->dp[iy] = (mp_digit)(r & (mp_word)MP_MASK);
+      }
+   }
+
+   /* x = x/b**n.used */
+   mp_clamp(x);
+   mp_rshd(x, n->used);
+
+   /* if x >= n then x = x - n */
+   if (mp_cmp_mag(x, n) != MP_LT) {
+      return s_mp_sub(x, n, x);
+   }
+
+   return MP_OKAY;
+}
+#endif
@@ -9,104 +9,99 @@
  * which uses the comba method to quickly calculate the columns of the
  * reduction.
  *
+ * The columns are computed in order (product scanning), the digits
+ * mu of the multiple of N are found on the way in the lower half and
+ * the digits of the result come out of the upper half.  That keeps
+ * the carry in one column accumulator, see MP_COMBA_ADD.
+ *
+ * Every digit of x is needed in its own column only, so the digits mu
+ * and those of the result take its place, no temporary array needed.
+ *
  * Based on Algorithm 14.32 on pp.601 of HAC.
 */
 mp_err s_mp_montgomery_reduce_comba(mp_int *x, const mp_int *n, mp_digit rho)
 {
-   int     ix, oldused;
-   mp_err  err;
-   mp_word W[MP_WARRAY];
-
-   if (x->used > MP_WARRAY) {
-      return MP_VAL;
-   }
+   int      ix, iy, oldused, nu = n->used;
+   mp_err   err;
+   mp_digit *W, _C;
+   mp_word  _W;
 
    /* get old used count */
    oldused = x->used;
 
    /* grow a as required */
-   if ((err = mp_grow(x, n->used + 1)) != MP_OKAY) {
+   if ((err = mp_grow(x, (nu * 2) + 1)) != MP_OKAY) {
       return err;
    }
+   W = x->dp;
 
-   /* first we have to get the digits of the input into
-    * an array of double precision words W[...]
-    */
+   _W = 0;
+   _C = 0;
 
-   /* copy the digits of a into W[0..a->used-1] */
-   for (ix = 0; ix < x->used; ix++) {
-      W[ix] = x->dp[ix];
-   }
-
-   /* zero the high words of W[a->used..m->used*2] */
-   if (ix < ((n->used * 2) + 1)) {
-      s_mp_zero_buf(W + x->used, sizeof(mp_word) * (size_t)(((n->used * 2) + 1) - ix));
-   }
-
-   /* now we proceed to zero successive digits
-    * from the least significant upwards
+   /* lower half: W[ix] = mu_ix such that the column ix becomes zero
+    *
+    * mu = ai * m' mod b
+    *
+    * The value of rho must be precalculated via montgomery_setup()
+    * such that it equals -1/n0 mod b.
     */
-   for (ix = 0; ix < n->used; ix++) {
-      int iy;
-      mp_digit mu;
-
-      /* mu = ai * m' mod b
-       *
-       * We avoid a double precision multiplication (which isn't required)
-       * by casting the value down to a mp_digit.  Note this requires
-       * that W[ix-1] have  the carry cleared (see after the inner loop)
-       */
-      mu = ((W[ix] & MP_MASK) * rho) & MP_MASK;
-
-      /* a = a + mu * m * b**i
-       *
-       * This is computed in place and on the fly.  The multiplication
-       * by b**i is handled by offsetting which columns the results
-       * are added to.
-       *
-       * Note the comba method normally doesn't handle carries in the
-       * inner loop In this case we fix the carry from the previous
-       * column since the Montgomery reduction requires digits of the
-       * result (so far) [see above] to work.  This is
-       * handled by fixing up one carry after the inner loop.  The
-       * carry fixups are done in order so after these loops the
-       * first m->used words of W[] have the carries fixed
-       */
-      for (iy = 0; iy < n->used; iy++) {
-         W[ix + iy] += (mp_word)mu * (mp_word)n->dp[iy];
+   for (ix = 0; ix < nu; ix++) {
+      if (ix <= MP_COMBA_BLOCK) {
+         for (iy = 0; iy < ix; iy++) {
+            MP_COMBA_ADD(_W, _C, (mp_word)W[iy] * (mp_word)n->dp[ix - iy]);
+         }
+      } else {
+         mp_digit hi;
+         MP_COMBA_ADD(_W, _C, s_mp_comba_column(W, n->dp + ix, ix, &hi));
+         _C += hi;
+         MP_COMBA_FOLD(_W, _C);
+      }
+      if (ix < oldused) {
+         MP_COMBA_ADD(_W, _C, (mp_word)W[ix]);
       }
+      W[ix] = ((mp_digit)_W * rho) & MP_MASK;
+      MP_COMBA_ADD(_W, _C, (mp_word)W[ix] * (mp_word)n->dp[0]);
 
-      /* now fix carry for next digit, W[ix+1] */
-      W[ix + 1] += W[ix] >> (mp_word)MP_DIGIT_BIT;
+      /* the digit of this column is zero now */
+      MP_COMBA_SHIFT(_W, _C);
    }
 
-   /* now we have to propagate the carries and
-    * shift the words downward [all those least
-    * significant digits we zeroed].
-    */
-
-   for (; ix < (n->used * 2); ix++) {
-      W[ix + 1] += W[ix] >> (mp_word)MP_DIGIT_BIT;
+   /* upper half: the digits of the result A/b**n, stored at W[nu..2*nu] */
+   for (; ix < (nu * 2); ix++) {
+      iy = (ix - nu) + 1;
+      if ((nu - iy) <= MP_COMBA_BLOCK) {
+         for (; iy < nu; iy++) {
+            MP_COMBA_ADD(_W, _C, (mp_word)W[iy] * (mp_word)n->dp[ix - iy]);
+         }
+      } else {
+         mp_digit hi;
+         MP_COMBA_ADD(_W, _C, s_mp_comba_column(W + iy, n->dp + (ix - iy), nu - iy, &hi));
+         _C += hi;
+         MP_COMBA_FOLD(_W, _C);
+      }
+      if (ix < oldused) {
+         MP_COMBA_ADD(_W, _C, (mp_word)W[ix]);
+      }
+      W[ix] = (mp_digit)_W & MP_MASK;
+      MP_COMBA_SHIFT(_W, _C);
    }
+   if (ix < oldused) {
+      MP_COMBA_ADD(_W, _C, (mp_word)W[ix]);
+   }
+   W[ix] = (mp_digit)_W & MP_MASK;
 
-   /* copy out, A = A/b**n
-    *
-    * The result is A/b**n but instead of converting from an
-    * array of mp_word to mp_digit than calling mp_rshd
-    * we just copy them in the right order
-    */
-
-   for (ix = 0; ix < (n->used + 1); ix++) {
-      x->dp[ix] = W[n->used + ix] & (mp_word)MP_MASK;
+   /* A = A/b**n, the areas overlap */
+   for (ix = 0; ix < (nu + 1); ix++) {
+      x->dp[ix] = W[nu + ix];
    }
 
    /* set the max used */
-   x->used = n->used + 1;
+   x->used = nu + 1;
 
-   /* zero oldused digits, if the input a was larger than
-    * m->used+1 we'll have to clear the digits
+   /* zero the digits above, those of mu and the oldused ones if the
+    * input a was larger than 2*m->used+1
     */
-   s_mp_zero_digs(x->dp + x->used, oldused - x->used);
+   s_mp_zero_digs(x->dp + x->used, MP_MAX(oldused, (nu * 2) + 1) - x->used);
 
    mp_clamp(x);
 
@@ -0,0 +1,40 @@
+#include "tommath_private.h"
+#ifdef S_MP_MONTGOMERY_REDUCE_MUL_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+
+/* computes xR**-1 == x (mod N) for 0 <= x < nR with whole multiplications
+ *
+ * With ninv = 1/n mod R the multiple q = x * ninv mod R of n makes
+ * x - q*n divisible by R, both have the same lower half.  So the result is
+ * the difference of the upper halves, floor(x / R) - floor(q*n / R), plus n
+ * if that is negative.  A low and a high short product instead of the
+ * digit by digit reduction, both subquadratic.
+ */
+mp_err s_mp_montgomery_reduce_mul(mp_int *x, const mp_int *n, const mp_int *ninv)
+{
+   mp_int q;
+   mp_err err;
+   int    k = n->used;
+
+   if ((err = mp_init(&q)) != MP_OKAY) {
+      return err;
+   }
+
+   /* q = x * ninv mod R */
+   if ((err = mp_mod_2d(x, k * MP_DIGIT_BIT, &q)) != MP_OKAY)             goto LBL_ERR;
+   if ((err = mp_mul_low(&q, ninv, k, &q)) != MP_OKAY)                    goto LBL_ERR;
+
+   /* x = floor(x / R) - floor(q*n / R) */
+   if ((err = mp_mul_high(&q, n, k, &q)) != MP_OKAY)                      goto LBL_ERR;
+   mp_rshd(x, k);
+   if ((err = mp_sub(x, &q, x)) != MP_OKAY)                               goto LBL_ERR;
+   if (mp_isneg(x)) {
+      err = mp_add(x, n, x);
+   }
+
+LBL_ERR:
+   mp_clear(&q);
+   return err;
+}
+#endif
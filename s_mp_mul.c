@@ -17,12 +17,6 @@ mp_err s_mp_mul(const mp_int *a, const mp_int *b, mp_int *c, int digs)
       return MP_VAL;
    }
 
-   /* can we use the fast multiplier? */
-   if ((digs < MP_WARRAY) &&
-       (MP_MIN(a->used, b->used) < MP_MAX_COMBA)) {
-      return s_mp_mul_comba(a, b, c, digs);
-   }
-
    if ((err = mp_init_size(&t, digs)) != MP_OKAY) {
       return err;
    }
@@ -0,0 +1,67 @@
+#include "tommath_private.h"
+#ifdef S_MP_MUL_ADX_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+
+/* multiplies |a| * |b| and only computes upto digs digits of result
+ *
+ * Same as s_mp_mul but the rows are computed by s_mp_addmul_adx.  The
+ * longer operand is the row, the shorter one gives the multipliers.
+ * The rows go straight into c unless it is also a source.
+ */
+mp_err s_mp_mul_adx(const mp_int *a, const mp_int *b, mp_int *c, int digs)
+{
+   mp_int  t, *d;
+   mp_err  err;
+   int     ix;
+
+   if (digs < 0) {
+      return MP_VAL;
+   }
+
+   if (a->used < b->used) {
+      const mp_int *tmp = a;
+      a = b;
+      b = tmp;
+   }
+
+   if ((c != a) && (c != b)) {
+      if ((err = mp_grow(c, digs)) != MP_OKAY) {
+         return err;
+      }
+      s_mp_zero_digs(c->dp, MP_MAX(c->used, digs));
+      c->sign = MP_ZPOS;
+      d = c;
+   } else {
+      if ((err = mp_init_size(&t, digs)) != MP_OKAY) {
+         return err;
+      }
+      d = &t;
+   }
+   d->used = digs;
+
+   for (ix = 0; ix < b->used; ix++) {
+      mp_digit u;
+
+      /* limit ourselves to making digs digits of output */
+      int pa = MP_MIN(a->used, digs - ix);
+      if (pa <= 0) {
+         break;
+      }
+
+      u = s_mp_addmul_adx(d->dp + ix, a->dp, pa, b->dp[ix]);
+
+      /* set carry if it is placed below digs */
+      if ((ix + pa) < digs) {
+         d->dp[ix + pa] = u;
+      }
+   }
+
+   mp_clamp(d);
+   if (d == &t) {
+      mp_exch(&t, c);
+      mp_clear(&t);
+   }
+   return MP_OKAY;
+}
+#endif
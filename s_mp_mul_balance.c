@@ -3,69 +3,70 @@
 /* LibTomMath, multiple-precision integer library -- Tom St Denis */
 /* SPDX-License-Identifier: Unlicense */
 
-/* single-digit multiplication with the smaller number as the single-digit */
+/* multiplication of very unbalanced operands
+ *
+ * The larger operand is cut into slices of twice the size of the smaller
+ * one such that every partial product is a 2:1 one for s_mp_mul_toom42.
+ * The partial products are added into the result at their offset without
+ * shifting them first.
+ */
 mp_err s_mp_mul_balance(const mp_int *a, const mp_int *b, mp_int *c)
 {
    mp_int a0, tmp, r;
    mp_err err;
-   int i, j,
-       nblocks = MP_MAX(a->used, b->used) / MP_MIN(a->used, b->used),
-       bsize = MP_MIN(a->used, b->used);
+   int i, j, n, bsize;
 
-   if ((err = mp_init_size(&a0, bsize + 2)) != MP_OKAY) {
+   /* Make sure that A is the larger one*/
+   if (a->used < b->used) {
+      MP_EXCH(const mp_int *, a, b);
+   }
+
+   bsize = 2 * b->used;
+
+   if ((err = mp_init_size(&a0, bsize)) != MP_OKAY) {
       return err;
    }
-   if ((err = mp_init_multi(&tmp, &r, NULL)) != MP_OKAY) {
+   if ((err = mp_init_size(&r, a->used + b->used)) != MP_OKAY) {
       mp_clear(&a0);
       return err;
    }
-
-   /* Make sure that A is the larger one*/
-   if (a->used < b->used) {
-      MP_EXCH(const mp_int *, a, b);
+   if ((err = mp_init(&tmp)) != MP_OKAY) {
+      mp_clear_multi(&a0, &r, NULL);
+      return err;
    }
+   r.used = a->used + b->used;
+
+   for (i = 0; i < a->used; i += bsize) {
+      mp_digit u = 0;
 
-   for (i = 0, j=0; i < nblocks; i++) {
-      /* Cut a slice off of a */
-      a0.used = bsize;
-      s_mp_copy_digs(a0.dp, a->dp + j, a0.used);
-      j += a0.used;
+      /* Cut a slice off of a, the last one takes the left-overs */
+      n = MP_MIN(bsize, a->used - i);
+      a0.used = n;
+      s_mp_copy_digs(a0.dp, a->dp + i, n);
       mp_clamp(&a0);
 
       /* Multiply with b */
       if ((err = mp_mul(&a0, b, &tmp)) != MP_OKAY) {
          goto LBL_ERR;
       }
-      /* Shift tmp to the correct position */
-      if ((err = mp_lshd(&tmp, bsize * i)) != MP_OKAY) {
-         goto LBL_ERR;
-      }
-      /* Add to output. No carry needed */
-      if ((err = mp_add(&r, &tmp, &r)) != MP_OKAY) {
-         goto LBL_ERR;
-      }
-   }
-   /* The left-overs; there are always left-overs */
-   if (j < a->used) {
-      a0.used = a->used - j;
-      s_mp_copy_digs(a0.dp, a->dp + j, a0.used);
-      j += a0.used;
-      mp_clamp(&a0);
 
-      if ((err = mp_mul(&a0, b, &tmp)) != MP_OKAY) {
-         goto LBL_ERR;
+      /* Add the magnitude to r at offset i, the carry cannot run past r */
+      for (j = 0; j < tmp.used; j++) {
+         mp_word t = (mp_word)r.dp[i + j] + (mp_word)tmp.dp[j] + (mp_word)u;
+         u = (mp_digit)(t >> (mp_word)MP_DIGIT_BIT);
+         r.dp[i + j] = (mp_digit)(t & (mp_word)MP_MASK);
       }
-      if ((err = mp_lshd(&tmp, bsize * i)) != MP_OKAY) {
-         goto LBL_ERR;
-      }
-      if ((err = mp_add(&r, &tmp, &r)) != MP_OKAY) {
-         goto LBL_ERR;
+      for (j += i; u != 0u; j++) {
+         mp_word t = (mp_word)r.dp[j] + (mp_word)u;
+         u = (mp_digit)(t >> (mp_word)MP_DIGIT_BIT);
+         r.dp[j] = (mp_digit)(t & (mp_word)MP_MASK);
       }
    }
 
-   mp_exch(&r,c);
+   mp_clamp(&r);
+   mp_exch(&r, c);
 LBL_ERR:
-   mp_clear_multi(&a0, &tmp, &r,NULL);
+   mp_clear_multi(&a0, &tmp, &r, NULL);
    return err;
 }
 #endif
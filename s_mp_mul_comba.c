@@ -18,12 +18,14 @@
  *
  * Based on Algorithm 14.12 on pp.595 of HAC.
  *
+ * The digits go straight into c unless it is also a source, only then
+ * they are collected in a temporary array, see MP_COMBA_STACK.
  */
 mp_err s_mp_mul_comba(const mp_int *a, const mp_int *b, mp_int *c, int digs)
 {
    int      oldused, pa, ix;
    mp_err   err;
-   mp_digit W[MP_WARRAY];
+   mp_digit buf[MP_COMBA_STACK], *W, _C;
    mp_word  _W;
 
    if (digs < 0) {
@@ -38,8 +40,17 @@ mp_err s_mp_mul_comba(const mp_int *a, const mp_int *b, mp_int *c, int digs)
    /* number of output digits to produce */
    pa = MP_MIN(digs, a->used + b->used);
 
+   if ((c != a) && (c != b)) {
+      W = c->dp;
+   } else if (pa <= MP_COMBA_STACK) {
+      W = buf;
+   } else if ((W = (mp_digit *) MP_MALLOC(sizeof(mp_digit) * (size_t)pa)) == NULL) {
+      return MP_MEM;
+   }
+
    /* clear the carry */
    _W = 0;
+   _C = 0;
    for (ix = 0; ix < pa; ix++) {
       int tx, ty, iy, iz;
 
@@ -53,24 +64,33 @@ mp_err s_mp_mul_comba(const mp_int *a, const mp_int *b, mp_int *c, int digs)
       iy = MP_MIN(a->used-tx, ty+1);
 
       /* execute loop */
-      for (iz = 0; iz < iy; ++iz) {
-         _W += (mp_word)a->dp[tx + iz] * (mp_word)b->dp[ty - iz];
+      if (iy <= MP_COMBA_BLOCK) {
+         for (iz = 0; iz < iy; ++iz) {
+            MP_COMBA_ADD(_W, _C, (mp_word)a->dp[tx + iz] * (mp_word)b->dp[ty - iz]);
+         }
+      } else {
+         mp_digit hi;
+         MP_COMBA_ADD(_W, _C, s_mp_comba_column(a->dp + tx, b->dp + ty, iy, &hi));
+         _C += hi;
+         MP_COMBA_FOLD(_W, _C);
       }
 
       /* store term */
       W[ix] = (mp_digit)_W & MP_MASK;
 
       /* make next carry */
-      _W = _W >> (mp_word)MP_DIGIT_BIT;
+      MP_COMBA_SHIFT(_W, _C);
    }
 
    /* setup dest */
    oldused  = c->used;
    c->used = pa;
 
-   for (ix = 0; ix < pa; ix++) {
-      /* now extract the previous digit [below the carry] */
-      c->dp[ix] = W[ix];
+   if (W != c->dp) {
+      s_mp_copy_digs(c->dp, W, pa);
+      if (W != buf) {
+         MP_FREE_BUF(W, sizeof(mp_digit) * (size_t)pa);
+      }
    }
 
    /* clear unused digits [that existed in the old copy of c] */
@@ -0,0 +1,350 @@
+#include "tommath_private.h"
+#ifdef S_MP_MUL_FFT_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+
+/* multiplication using a number theoretic transform (NTT)
+ *
+ * The operands are cut into 32-bit coefficients and the cyclic
+ * convolution is computed modulo three primes of the form k*2^n + 1.
+ * Each coefficient of the product is less than 2^88, which is below
+ * the product of the three primes, so Garner's algorithm recovers
+ * them exactly.  With a running time of O(N log N) this is only
+ * useful for really large inputs (think 10000s of digits).
+ *
+ * The modular arithmetic uses Montgomery form with R = 2^32 such that
+ * the transforms do not need any hardware division.
+ *
+ * The length of the transform is limited to 2^24 by the third prime,
+ * see MP_FFT_MAX_DIGIT_COUNT.
+ *
+ * The three primes are independent of each other until Garner's step.
+ * With the worker threads of mp_mul_threads() they are transformed at
+ * the same time, each with its own operand vector and twiddles.
+ */
+
+static const uint32_t s_ntt_prime[3] = { 2013265921u, 469762049u, 754974721u };
+static const uint32_t s_ntt_generator[3] = { 31u, 3u, 11u };
+
+static uint32_t s_ntt_redc(uint64_t t, uint32_t p, uint32_t pinv)
+{
+   uint32_t m = (uint32_t)t * pinv;
+   uint32_t r = (uint32_t)((t + ((uint64_t)m * p)) >> 32);
+   return (r >= p) ? (r - p) : r;
+}
+
+static uint32_t s_ntt_mul(uint32_t a, uint32_t b, uint32_t p, uint32_t pinv)
+{
+   return s_ntt_redc((uint64_t)a * b, p, pinv);
+}
+
+static uint32_t s_ntt_add(uint32_t a, uint32_t b, uint32_t p)
+{
+   uint32_t r = a + b;
+   return (r >= p) ? (r - p) : r;
+}
+
+static uint32_t s_ntt_sub(uint32_t a, uint32_t b, uint32_t p)
+{
+   return (a >= b) ? (a - b) : ((a + p) - b);
+}
+
+/* a**e in Montgomery form, "one" is R mod p */
+static uint32_t s_ntt_pow(uint32_t a, uint32_t e, uint32_t one, uint32_t p, uint32_t pinv)
+{
+   uint32_t r = one;
+   while (e != 0u) {
+      if ((e & 1u) != 0u) {
+         r = s_ntt_mul(r, a, p, pinv);
+      }
+      a = s_ntt_mul(a, a, p, pinv);
+      e >>= 1;
+   }
+   return r;
+}
+
+/* a**e mod p for ordinary residues, used for the CRT constants only */
+static uint64_t s_ntt_pow_plain(uint64_t a, uint64_t e, uint64_t p)
+{
+   uint64_t r = 1u;
+   a %= p;
+   while (e != 0u) {
+      if ((e & 1u) != 0u) {
+         r = (r * a) % p;
+      }
+      a = (a * a) % p;
+      e >>= 1;
+   }
+   return r;
+}
+
+/* Twiddle factors for all levels, w[half + j] = r**(j * n/(2*half)) for 0 <= j < half.
+ * Keeping them contiguous per level avoids strided access in the butterflies.
+ */
+static void s_ntt_twiddle(uint32_t *w, int n, uint32_t r, uint32_t one, uint32_t p, uint32_t pinv)
+{
+   int half, j;
+   half = n >> 1;
+   w[half] = one;
+   for (j = 1; j < half; j++) {
+      w[half + j] = s_ntt_mul(w[(half + j) - 1], r, p, pinv);
+   }
+   for (half >>= 1; half >= 1; half >>= 1) {
+      for (j = 0; j < half; j++) {
+         w[half + j] = w[(2 * half) + (2 * j)];
+      }
+   }
+}
+
+/* forward transform, decimation in frequency: natural order in, bit-reversed order out */
+static void s_ntt_forward(uint32_t *x, int n, const uint32_t *w, uint32_t p, uint32_t pinv)
+{
+   int half, i, j;
+   for (half = n >> 1; half >= 1; half >>= 1) {
+      for (i = 0; i < n; i += 2 * half) {
+         for (j = 0; j < half; j++) {
+            uint32_t u = x[i + j], v = x[i + j + half];
+            x[i + j] = s_ntt_add(u, v, p);
+            x[i + j + half] = s_ntt_mul(s_ntt_sub(u, v, p), w[half + j], p, pinv);
+         }
+      }
+   }
+}
+
+/* inverse transform, decimation in time: bit-reversed order in, natural order out (unscaled) */
+static void s_ntt_inverse(uint32_t *x, int n, const uint32_t *w, uint32_t p, uint32_t pinv)
+{
+   int half, i, j;
+   for (half = 1; half < n; half <<= 1) {
+      for (i = 0; i < n; i += 2 * half) {
+         for (j = 0; j < half; j++) {
+            uint32_t u = x[i + j], v = s_ntt_mul(x[i + j + half], w[half + j], p, pinv);
+            x[i + j] = s_ntt_add(u, v, p);
+            x[i + j + half] = s_ntt_sub(u, v, p);
+         }
+      }
+   }
+}
+
+/* cut the magnitude of a into n 32-bit coefficients */
+static void s_ntt_split(const mp_int *a, uint32_t *x, int n)
+{
+   int i, d, s, got;
+   for (i = 0; i < n; i++) {
+      uint32_t t = 0u;
+      d = (i * 32) / MP_DIGIT_BIT;
+      s = (i * 32) % MP_DIGIT_BIT;
+      for (got = 0; (got < 32) && (d < a->used); d++) {
+         t |= (uint32_t)(a->dp[d] >> s) << got;
+         got += MP_DIGIT_BIT - s;
+         s = 0;
+      }
+      x[i] = t;
+   }
+}
+
+/* assemble the digits of c from n 32-bit words */
+static void s_ntt_join(const uint32_t *x, int n, mp_int *c)
+{
+   int i, w, s, got;
+   for (i = 0; i < c->alloc; i++) {
+      mp_digit t = 0u;
+      w = (i * MP_DIGIT_BIT) / 32;
+      s = (i * MP_DIGIT_BIT) % 32;
+      for (got = 0; (got < MP_DIGIT_BIT) && (w < n); w++) {
+         t |= (mp_digit)(x[w] >> s) << got;
+         got += 32 - s;
+         s = 0;
+      }
+      c->dp[i] = t & MP_MASK;
+   }
+   c->used = c->alloc;
+   mp_clamp(c);
+}
+
+/* The residues of the product modulo the prime k, in fa.
+ * fb, w and wi are the operand vector and the twiddles of this prime.
+ */
+typedef struct {
+   const uint32_t *ca, *cb;
+   uint32_t *fa, *fb, *w, *wi;
+   int la, lb, lc, n, k;
+   bool sqr;
+} s_ntt_job;
+
+static void s_ntt_residue(void *arg)
+{
+   const s_ntt_job *job = (const s_ntt_job *)arg;
+   uint32_t *fa = job->fa, *fb = job->fb;
+   uint32_t p, pinv, one, r2, root, ninv;
+   int n = job->n, i;
+
+   p = s_ntt_prime[job->k];
+   /* pinv = -1/p mod 2^32, Newton iteration starting with 3 valid bits */
+   pinv = p;
+   for (i = 0; i < 4; i++) {
+      pinv *= 2u - (p * pinv);
+   }
+   pinv = 0u - pinv;
+   r2 = (uint32_t)(((uint64_t)1 << 32) % p);
+   r2 = (uint32_t)(((uint64_t)r2 * r2) % p);
+   one = s_ntt_redc(r2, p, pinv);
+
+   /* twiddle factors: powers of a primitive n-th root of unity and of its inverse */
+   root = s_ntt_mul(s_ntt_generator[job->k], r2, p, pinv);
+   root = s_ntt_pow(root, (p - 1u) / (uint32_t)n, one, p, pinv);
+   s_ntt_twiddle(job->w, n, root, one, p, pinv);
+   s_ntt_twiddle(job->wi, n, s_ntt_pow(root, (uint32_t)n - 1u, one, p, pinv), one, p, pinv);
+
+   for (i = 0; i < job->la; i++) {
+      fa[i] = s_ntt_mul(job->ca[i], r2, p, pinv);
+   }
+   for (; i < n; i++) {
+      fa[i] = 0u;
+   }
+   s_ntt_forward(fa, n, job->w, p, pinv);
+
+   if (job->sqr) {
+      for (i = 0; i < n; i++) {
+         fa[i] = s_ntt_mul(fa[i], fa[i], p, pinv);
+      }
+   } else {
+      for (i = 0; i < job->lb; i++) {
+         fb[i] = s_ntt_mul(job->cb[i], r2, p, pinv);
+      }
+      for (; i < n; i++) {
+         fb[i] = 0u;
+      }
+      s_ntt_forward(fb, n, job->w, p, pinv);
+      for (i = 0; i < n; i++) {
+         fa[i] = s_ntt_mul(fa[i], fb[i], p, pinv);
+      }
+   }
+
+   s_ntt_inverse(fa, n, job->wi, p, pinv);
+
+   /* multiplying with the plain 1/n leaves Montgomery form and scales in one step */
+   ninv = s_ntt_redc(s_ntt_pow(s_ntt_mul((uint32_t)n, r2, p, pinv), p - 2u, one, p, pinv), p, pinv);
+   for (i = 0; i < (job->lc - 1); i++) {
+      fa[i] = s_ntt_mul(fa[i], ninv, p, pinv);
+   }
+}
+
+mp_err s_mp_mul_fft(const mp_int *a, const mp_int *b, mp_int *c)
+{
+   mp_int t;
+   mp_err err;
+   int la, lb, lc, n, i, k, sets;
+   size_t size;
+   uint32_t *buf, *ca, *cb, *res[3], carry[3];
+   uint64_t p01, inv01, inv012;
+   s_ntt_job job[3];
+#ifdef MP_USE_PTHREADS
+   mp_mul_task task[3];
+#endif
+   const bool sqr = (a == b), threaded = (MP_MUL_WORKERS > 0);
+
+   la = (mp_count_bits(a) + 31) / 32;
+   lb = (mp_count_bits(b) + 31) / 32;
+   if ((la == 0) || (lb == 0)) {
+      mp_zero(c);
+      return MP_OKAY;
+   }
+   lc = la + lb;
+   n = 2;
+   while (n < (lc - 1)) {
+      n <<= 1;
+   }
+   if (n > (1 << 24)) {
+      return MP_VAL;
+   }
+
+   if ((err = mp_init_size(&t, ((lc * 32) + (MP_DIGIT_BIT - 1)) / MP_DIGIT_BIT)) != MP_OKAY) {
+      return err;
+   }
+
+   /* layout: three residue vectors, the operand vector and the twiddles once
+    * or for each prime with threads, and the 32-bit coefficients of a and b
+    */
+   sets = threaded ? 3 : 1;
+   size = sizeof(uint32_t) * (((size_t)n * (3u + (3u * (size_t)sets))) + (size_t)lc);
+   buf = (uint32_t *) MP_MALLOC(size);
+   if (buf == NULL) {
+      mp_clear(&t);
+      return MP_MEM;
+   }
+   res[0] = buf;
+   res[1] = res[0] + n;
+   res[2] = res[1] + n;
+   ca = res[2] + (n * (1 + (3 * sets)));
+   cb = ca + la;
+
+   s_ntt_split(a, ca, la);
+   s_ntt_split(b, cb, lb);
+
+   for (k = 0; k < 3; k++) {
+      job[k].ca = ca;
+      job[k].cb = cb;
+      job[k].fa = res[k];
+      job[k].fb = res[2] + (n * (1 + (3 * (k % sets))));
+      job[k].w = job[k].fb + n;
+      job[k].wi = job[k].w + n;
+      job[k].la = la;
+      job[k].lb = lb;
+      job[k].lc = lc;
+      job[k].n = n;
+      job[k].k = k;
+      job[k].sqr = sqr;
+   }
+
+#ifdef MP_USE_PTHREADS
+   if (threaded) {
+      for (k = 0; k < 3; k++) {
+         task[k].run = s_ntt_residue;
+         task[k].arg = &job[k];
+      }
+      s_mp_mul_pool_run(task, 3);
+   }
+#endif
+   if (!threaded) {
+      for (k = 0; k < 3; k++) {
+         s_ntt_residue(&job[k]);
+      }
+   }
+
+   /* Garner: x = r0 + p0*t1 + p0*p1*t2 */
+   p01 = (uint64_t)s_ntt_prime[0] * s_ntt_prime[1];
+   inv01 = s_ntt_pow_plain(s_ntt_prime[0], (uint64_t)s_ntt_prime[1] - 2u, s_ntt_prime[1]);
+   inv012 = s_ntt_pow_plain(p01, (uint64_t)s_ntt_prime[2] - 2u, s_ntt_prime[2]);
+   carry[0] = carry[1] = carry[2] = 0u;
+   /* the words of the result overwrite res[1] in the same pass */
+   for (i = 0; i < (lc - 1); i++) {
+      uint64_t r0 = res[0][i], t1, t2, x01, lo, hi;
+      t1 = (((uint64_t)res[1][i] + s_ntt_prime[1]) - (r0 % s_ntt_prime[1])) % s_ntt_prime[1];
+      t1 = (t1 * inv01) % s_ntt_prime[1];
+      x01 = r0 + (t1 * s_ntt_prime[0]);
+      t2 = (((uint64_t)res[2][i] + s_ntt_prime[2]) - (x01 % s_ntt_prime[2])) % s_ntt_prime[2];
+      t2 = (t2 * inv012) % s_ntt_prime[2];
+
+      /* x = x01 + p01*t2 as three 32-bit limbs, added to the running carry */
+      lo = (x01 & 0xFFFFFFFFuL) + ((p01 & 0xFFFFFFFFuL) * t2);
+      hi = (x01 >> 32) + ((p01 >> 32) * t2) + (lo >> 32);
+      lo = (uint64_t)carry[0] + (lo & 0xFFFFFFFFuL);
+      res[1][i] = (uint32_t)lo;
+      lo = (lo >> 32) + carry[1] + (hi & 0xFFFFFFFFuL);
+      carry[0] = (uint32_t)lo;
+      lo = (lo >> 32) + carry[2] + (hi >> 32);
+      carry[1] = (uint32_t)lo;
+      carry[2] = (uint32_t)(lo >> 32);
+   }
+   res[1][lc - 1] = carry[0];
+
+   s_ntt_join(res[1], lc, &t);
+   mp_exch(&t, c);
+
+   MP_FREE_BUF(buf, size);
+   mp_clear(&t);
+   return MP_OKAY;
+}
+
+#endif
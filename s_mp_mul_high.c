@@ -5,6 +5,11 @@
 
 /* multiplies |a| * |b| and does not compute the lower digs digits
  * [meant to get the higher part of the product]
+ *
+ * The products of the digits at i and j are left out for i+j < digs,
+ * all others are in, together with their carries.  So the result is at
+ * most |a| * |b| and less than min(a->used, b->used) * B**(digs+1) below.
+ * The bigger ones might leave out less, see s_mp_mul_high_mulders().
  */
 mp_err s_mp_mul_high(const mp_int *a, const mp_int *b, mp_int *c, int digs)
 {
@@ -16,10 +21,13 @@ mp_err s_mp_mul_high(const mp_int *a, const mp_int *b, mp_int *c, int digs)
       return MP_VAL;
    }
 
+   if (MP_HAS(S_MP_MUL_HIGH_MULDERS) &&
+       (MP_MIN(a->used, b->used) >= MP_MUL_HIGH_CUTOFF)) {
+      return s_mp_mul_high_mulders(a, b, c, digs);
+   }
+
    /* can we use the fast multiplier? */
-   if (MP_HAS(S_MP_MUL_HIGH_COMBA)
-       && ((a->used + b->used + 1) < MP_WARRAY)
-       && (MP_MIN(a->used, b->used) < MP_MAX_COMBA)) {
+   if (MP_HAS(S_MP_MUL_HIGH_COMBA)) {
       return s_mp_mul_high_comba(a, b, c, digs);
    }
 
@@ -34,7 +42,7 @@ mp_err s_mp_mul_high(const mp_int *a, const mp_int *b, mp_int *c, int digs)
       int iy;
       mp_digit u = 0;
 
-      for (iy = digs - ix; iy < pb; iy++) {
+      for (iy = MP_MAX(digs - ix, 0); iy < pb; iy++) {
          /* calculate the double precision result */
          mp_word r = (mp_word)t.dp[ix + iy] +
                      ((mp_word)a->dp[ix] * (mp_word)b->dp[iy]) +
@@ -16,7 +16,7 @@ mp_err s_mp_mul_high_comba(const mp_int *a, const mp_int *b, mp_int *c, int digs
 {
    int     oldused, pa, ix;
    mp_err   err;
-   mp_digit W[MP_WARRAY];
+   mp_digit buf[MP_COMBA_STACK], *W, _C;
    mp_word  _W;
 
    if (digs < 0) {
@@ -29,9 +29,18 @@ mp_err s_mp_mul_high_comba(const mp_int *a, const mp_int *b, mp_int *c, int digs
       return err;
    }
 
+   /* the digits at digs and above, straight into c if it is not a source */
+   if ((c != a) && (c != b)) {
+      W = c->dp;
+   } else if (pa <= MP_COMBA_STACK) {
+      W = buf;
+   } else if ((W = (mp_digit *) MP_MALLOC(sizeof(mp_digit) * (size_t)pa)) == NULL) {
+      return MP_MEM;
+   }
+
    /* number of output digits to produce */
-   pa = a->used + b->used;
    _W = 0;
+   _C = 0;
    for (ix = digs; ix < pa; ix++) {
       int      tx, ty, iy, iz;
 
@@ -45,26 +54,38 @@ mp_err s_mp_mul_high_comba(const mp_int *a, const mp_int *b, mp_int *c, int digs
       iy = MP_MIN(a->used-tx, ty+1);
 
       /* execute loop */
-      for (iz = 0; iz < iy; iz++) {
-         _W += (mp_word)a->dp[tx + iz] * (mp_word)b->dp[ty - iz];
+      if (iy <= MP_COMBA_BLOCK) {
+         for (iz = 0; iz < iy; iz++) {
+            MP_COMBA_ADD(_W, _C, (mp_word)a->dp[tx + iz] * (mp_word)b->dp[ty - iz]);
+         }
+      } else {
+         mp_digit hi;
+         MP_COMBA_ADD(_W, _C, s_mp_comba_column(a->dp + tx, b->dp + ty, iy, &hi));
+         _C += hi;
+         MP_COMBA_FOLD(_W, _C);
       }
 
       /* store term */
       W[ix] = (mp_digit)_W & MP_MASK;
 
       /* make next carry */
-      _W = _W >> (mp_word)MP_DIGIT_BIT;
+      MP_COMBA_SHIFT(_W, _C);
    }
 
    /* setup dest */
    oldused  = c->used;
    c->used = pa;
 
-   for (ix = digs; ix < pa; ix++) {
-      /* now extract the previous digit [below the carry] */
-      c->dp[ix] = W[ix];
+   if (W != c->dp) {
+      s_mp_copy_digs(c->dp + digs, W + digs, MP_MAX(pa - digs, 0));
+      if (W != buf) {
+         MP_FREE_BUF(W, sizeof(mp_digit) * (size_t)pa);
+      }
    }
 
+   /* the digits below digs are not computed */
+   s_mp_zero_digs(c->dp, MP_MIN(digs, pa));
+
    /* clear unused digits [that existed in the old copy of c] */
    s_mp_zero_digs(c->dp + c->used, oldused - c->used);
 
@@ -0,0 +1,84 @@
+#include "tommath_private.h"
+#ifdef S_MP_MUL_HIGH_MULDERS_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+
+/* multiplies |a| * |b| but leaves out most of the lower digs digits with
+ * Mulders' short product, see s_mp_mul_high()
+ *
+ * The digits of a below digs - b->used + 1 and those of b below
+ * digs - a->used + 1 are not used at all.  What is left is split at h
+ * digits, with the short products of the digits at i and j with i+j < digs
+ * left out
+ *
+ * a = a1 * B**h + a0
+ * b = b1 * B**h + b0
+ *
+ * a * b ~ a1b1 * B**2h + (a1b0 + a0b1) * B**h
+ *
+ * where a1b1 is a full product, a1b0 and a0b1 are computed recursively
+ * and a0b0 is below digs completely for 2h - 2 < digs.  With h = 0.3n
+ * that is about 0.6 - 0.8 of a full product of n digits.
+ *
+ * Mulders, Thom. "On short multiplications and divisions."
+ * Applicable Algebra in Engineering, Communication and Computing 11.1 (2000)
+ */
+mp_err s_mp_mul_high_mulders(const mp_int *a, const mp_int *b, mp_int *c, int digs)
+{
+   mp_int a0, a1, b0, b1;
+   int sa = MP_MAX(digs - b->used + 1, 0), sb = MP_MAX(digs - a->used + 1, 0), m, h;
+   mp_err err;
+
+   /* nothing above digs */
+   if ((sa >= a->used) || (sb >= b->used)) {
+      mp_zero(c);
+      return MP_OKAY;
+   }
+
+   m = digs - sa - sb;
+   h = MP_MIN((m + 1) / 2, (3 * MP_MIN(a->used - sa, b->used - sb)) / 10);
+   if (h < 1) {
+      err = mp_mul(a, b, c);
+      c->sign = MP_ZPOS;
+      return err;
+   }
+
+   if ((err = mp_init_size(&a0, h)) != MP_OKAY) {
+      return err;
+   }
+   if ((err = mp_init_size(&b0, h)) != MP_OKAY)                            goto LBL_A0;
+   if ((err = mp_init_size(&a1, a->used + b->used)) != MP_OKAY)            goto LBL_B0;
+   if ((err = mp_init_size(&b1, b->used - sb - h)) != MP_OKAY)             goto LBL_A1;
+
+   a0.used = b0.used = h;
+   a1.used = a->used - sa - h;
+   b1.used = b->used - sb - h;
+   s_mp_copy_digs(a0.dp, a->dp + sa, a0.used);
+   s_mp_copy_digs(b0.dp, b->dp + sb, b0.used);
+   s_mp_copy_digs(a1.dp, a->dp + sa + h, a1.used);
+   s_mp_copy_digs(b1.dp, b->dp + sb + h, b1.used);
+   mp_clamp(&a0);
+   mp_clamp(&b0);
+
+   /* b0 = a1*b0 + a0*b1, without the digits below m - h */
+   if ((err = s_mp_mul_high(&a1, &b0, &b0, m - h)) != MP_OKAY)            goto LBL_ERR;
+   if ((err = s_mp_mul_high(&a0, &b1, &a0, m - h)) != MP_OKAY)            goto LBL_ERR;
+   if ((err = s_mp_add(&b0, &a0, &b0)) != MP_OKAY)                        goto LBL_ERR;
+
+   /* c = (a1*b1 * B**h + b0) * B**(h + sa + sb) */
+   if ((err = mp_mul(&a1, &b1, &a1)) != MP_OKAY)                          goto LBL_ERR;
+   if ((err = mp_lshd(&a1, h)) != MP_OKAY)                                goto LBL_ERR;
+   if ((err = s_mp_add(&a1, &b0, c)) != MP_OKAY)                          goto LBL_ERR;
+   err = mp_lshd(c, h + sa + sb);
+
+LBL_ERR:
+   mp_clear(&b1);
+LBL_A1:
+   mp_clear(&a1);
+LBL_B0:
+   mp_clear(&b0);
+LBL_A0:
+   mp_clear(&a0);
+   return err;
+}
+#endif
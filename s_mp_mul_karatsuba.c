@@ -31,43 +31,47 @@
  * the standard O(N**2) that the baseline/comba methods use.
  * Generally though the overhead of this method doesn't pay off
  * until a certain size (N ~ 80) is reached.
+ *
+ * The temporaries are carved from the scratch space s, with s == NULL
+ * one is allocated for this and all the levels below.  The three products
+ * may run in parallel, see s_mp_mul_parallel().
  */
-mp_err s_mp_mul_karatsuba(const mp_int *a, const mp_int *b, mp_int *c)
+mp_err s_mp_mul_karatsuba(const mp_int *a, const mp_int *b, mp_int *c, mp_scratch *s)
 {
-   mp_int  x0, x1, y0, y1, t1, x0y0, x1y1;
-   int  B;
+   mp_int  x0, x1, y0, y1, t1, x0y0, x1y1, *pc[3];
+   const mp_int *pa[3], *pb[3];
+   int  B, P, mark;
    mp_err  err;
 
+   /* the top level allocates the scratch space for all of them */
+   if (s == NULL) {
+      mp_scratch own;
+      if ((err = s_mp_scratch_init(&own, s_mp_scratch_size(a->used, b->used))) != MP_OKAY) {
+         return err;
+      }
+      err = s_mp_mul_karatsuba(a, b, c, &own);
+      s_mp_scratch_clear(&own);
+      return err;
+   }
+   mark = s->used;
+
    /* min # of digits */
    B = MP_MIN(a->used, b->used);
 
    /* now divide in two */
    B = B >> 1;
 
-   /* init copy all the temps */
-   if ((err = mp_init_size(&x0, B)) != MP_OKAY) {
-      goto LBL_ERR;
-   }
-   if ((err = mp_init_size(&x1, a->used - B)) != MP_OKAY) {
-      goto X0;
-   }
-   if ((err = mp_init_size(&y0, B)) != MP_OKAY) {
-      goto X1;
-   }
-   if ((err = mp_init_size(&y1, b->used - B)) != MP_OKAY) {
-      goto Y0;
-   }
+   /* room for a product and the carries of the sums */
+   P = a->used + b->used + 3;
 
-   /* init temps */
-   if ((err = mp_init_size(&t1, B * 2)) != MP_OKAY) {
-      goto Y1;
-   }
-   if ((err = mp_init_size(&x0y0, B * 2)) != MP_OKAY) {
-      goto T1;
-   }
-   if ((err = mp_init_size(&x1y1, B * 2)) != MP_OKAY) {
-      goto X0Y0;
-   }
+   /* carve all the temps */
+   if ((err = s_mp_scratch_get(s, &x0, P)) != MP_OKAY)              goto LBL_ERR;
+   if ((err = s_mp_scratch_get(s, &x1, a->used - B)) != MP_OKAY)    goto LBL_ERR;
+   if ((err = s_mp_scratch_get(s, &y0, B)) != MP_OKAY)              goto LBL_ERR;
+   if ((err = s_mp_scratch_get(s, &y1, b->used - B)) != MP_OKAY)    goto LBL_ERR;
+   if ((err = s_mp_scratch_get(s, &t1, P)) != MP_OKAY)              goto LBL_ERR;
+   if ((err = s_mp_scratch_get(s, &x0y0, P)) != MP_OKAY)            goto LBL_ERR;
+   if ((err = s_mp_scratch_get(s, &x1y1, P)) != MP_OKAY)            goto LBL_ERR;
 
    /* now shift the digits */
    x0.used = y0.used = B;
@@ -88,64 +92,56 @@ mp_err s_mp_mul_karatsuba(const mp_int *a, const mp_int *b, mp_int *c)
    mp_clamp(&x0);
    mp_clamp(&y0);
 
-   /* now calc the products x0y0 and x1y1 */
-   /* after this x0 is no longer required, free temp [x0==t2]! */
-   if ((err = mp_mul(&x0, &y0, &x0y0)) != MP_OKAY) {
-      goto X1Y1;          /* x0y0 = x0*y0 */
+   /* now calc x1+x0 and y1+y0, x1y1 and x0y0 hold them until their own
+    * products, so no product is computed in place
+    */
+   if ((err = s_mp_add(&x1, &x0, &x1y1)) != MP_OKAY) {
+      goto LBL_ERR;       /* x1y1 = x1 + x0 */
    }
-   if ((err = mp_mul(&x1, &y1, &x1y1)) != MP_OKAY) {
-      goto X1Y1;          /* x1y1 = x1*y1 */
+   if ((err = s_mp_add(&y1, &y0, &x0y0)) != MP_OKAY) {
+      goto LBL_ERR;       /* x0y0 = y1 + y0 */
    }
 
-   /* now calc x1+x0 and y1+y0 */
-   if ((err = s_mp_add(&x1, &x0, &t1)) != MP_OKAY) {
-      goto X1Y1;          /* t1 = x1 - x0 */
-   }
-   if ((err = s_mp_add(&y1, &y0, &x0)) != MP_OKAY) {
-      goto X1Y1;          /* t2 = y1 - y0 */
-   }
-   if ((err = mp_mul(&t1, &x0, &t1)) != MP_OKAY) {
-      goto X1Y1;          /* t1 = (x1 + x0) * (y1 + y0) */
+   /* the three products are independent, compute them at once */
+   pa[0] = &x1y1;
+   pb[0] = &x0y0;
+   pc[0] = &t1;        /* t1 = (x1 + x0) * (y1 + y0) */
+   pa[1] = &x0;
+   pb[1] = &y0;
+   pc[1] = &x0y0;      /* x0y0 = x0*y0 */
+   pa[2] = &x1;
+   pb[2] = &y1;
+   pc[2] = &x1y1;      /* x1y1 = x1*y1 */
+   if ((err = s_mp_mul_parallel(pa, pb, pc, 3, s)) != MP_OKAY) {
+      goto LBL_ERR;
    }
 
    /* add x0y0 */
    if ((err = mp_add(&x0y0, &x1y1, &x0)) != MP_OKAY) {
-      goto X1Y1;          /* t2 = x0y0 + x1y1 */
+      goto LBL_ERR;       /* t2 = x0y0 + x1y1 */
    }
    if ((err = s_mp_sub(&t1, &x0, &t1)) != MP_OKAY) {
-      goto X1Y1;          /* t1 = (x1+x0)*(y1+y0) - (x1y1 + x0y0) */
+      goto LBL_ERR;       /* t1 = (x1+x0)*(y1+y0) - (x1y1 + x0y0) */
    }
 
    /* shift by B */
    if ((err = mp_lshd(&t1, B)) != MP_OKAY) {
-      goto X1Y1;          /* t1 = (x0y0 + x1y1 - (x1-x0)*(y1-y0))<<B */
+      goto LBL_ERR;       /* t1 = (x0y0 + x1y1 - (x1-x0)*(y1-y0))<<B */
    }
    if ((err = mp_lshd(&x1y1, B * 2)) != MP_OKAY) {
-      goto X1Y1;          /* x1y1 = x1y1 << 2*B */
+      goto LBL_ERR;       /* x1y1 = x1y1 << 2*B */
    }
 
    if ((err = mp_add(&x0y0, &t1, &t1)) != MP_OKAY) {
-      goto X1Y1;          /* t1 = x0y0 + t1 */
+      goto LBL_ERR;       /* t1 = x0y0 + t1 */
    }
    if ((err = mp_add(&t1, &x1y1, c)) != MP_OKAY) {
-      goto X1Y1;          /* t1 = x0y0 + t1 + x1y1 */
+      goto LBL_ERR;       /* t1 = x0y0 + t1 + x1y1 */
    }
 
-X1Y1:
-   mp_clear(&x1y1);
-X0Y0:
-   mp_clear(&x0y0);
-T1:
-   mp_clear(&t1);
-Y1:
-   mp_clear(&y1);
-Y0:
-   mp_clear(&y0);
-X1:
-   mp_clear(&x1);
-X0:
-   mp_clear(&x0);
 LBL_ERR:
+   /* give the temps back */
+   s->used = mark;
    return err;
 }
 #endif
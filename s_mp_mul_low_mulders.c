@@ -0,0 +1,76 @@
+#include "tommath_private.h"
+#ifdef S_MP_MUL_LOW_MULDERS_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+
+/* c = |a| * |b| mod B**digs with Mulders' short product
+ *
+ * Let n = digs and k = 0.7n, split a and b at k digits
+ *
+ * a = a1 * B**k + a0
+ * b = b1 * B**k + b0
+ *
+ * then, mod B**n
+ *
+ * a * b = a0b0 + (a1b0 + a0b1) * B**k
+ *
+ * where a0b0 is a full product of k digits and a1b0, a0b1 are short
+ * products of n - k digits, computed recursively.  With Karatsuba that
+ * is about 0.6 - 0.8 of a full product of n digits.
+ *
+ * Mulders, Thom. "On short multiplications and divisions."
+ * Applicable Algebra in Engineering, Communication and Computing 11.1 (2000)
+ */
+mp_err s_mp_mul_low_mulders(const mp_int *a, const mp_int *b, mp_int *c, int digs)
+{
+   mp_int a0, a1, b0, b1;
+   int na = MP_MIN(a->used, digs), nb = MP_MIN(b->used, digs), l = (3 * digs) / 10, k = digs - l;
+   mp_err err;
+
+   if ((err = mp_init_size(&a0, (2 * k) + 1)) != MP_OKAY) {
+      return err;
+   }
+   if ((err = mp_init_size(&b0, k)) != MP_OKAY)                   goto LBL_A0;
+   if ((err = mp_init_size(&a1, l + 1)) != MP_OKAY)               goto LBL_B0;
+   if ((err = mp_init_size(&b1, l + 1)) != MP_OKAY)               goto LBL_A1;
+
+   /* the digits above digs do not matter */
+   a0.used = MP_MIN(na, k);
+   b0.used = MP_MIN(nb, k);
+   a1.used = MP_MAX(na - k, 0);
+   b1.used = MP_MAX(nb - k, 0);
+   s_mp_copy_digs(a0.dp, a->dp, a0.used);
+   s_mp_copy_digs(b0.dp, b->dp, b0.used);
+   s_mp_copy_digs(a1.dp, a->dp + k, a1.used);
+   s_mp_copy_digs(b1.dp, b->dp + k, b1.used);
+   mp_clamp(&a0);
+   mp_clamp(&b0);
+   mp_clamp(&a1);
+   mp_clamp(&b1);
+
+   /* a1 = a1*b0 + a0*b1 mod B**l */
+   if ((err = mp_mul_low(&a1, &b0, l, &a1)) != MP_OKAY)           goto LBL_ERR;
+   if ((err = mp_mul_low(&a0, &b1, l, &b1)) != MP_OKAY)           goto LBL_ERR;
+   if ((err = s_mp_add(&a1, &b1, &a1)) != MP_OKAY)                goto LBL_ERR;
+
+   /* c = a0*b0 + a1 * B**k mod B**digs */
+   if ((err = mp_mul(&a0, &b0, &a0)) != MP_OKAY)                  goto LBL_ERR;
+   if ((err = mp_lshd(&a1, k)) != MP_OKAY)                        goto LBL_ERR;
+   if ((err = s_mp_add(&a0, &a1, c)) != MP_OKAY)                  goto LBL_ERR;
+   if (c->used > digs) {
+      s_mp_zero_digs(c->dp + digs, c->used - digs);
+      c->used = digs;
+      mp_clamp(c);
+   }
+
+LBL_ERR:
+   mp_clear(&b1);
+LBL_A1:
+   mp_clear(&a1);
+LBL_B0:
+   mp_clear(&b0);
+LBL_A0:
+   mp_clear(&a0);
+   return err;
+}
+#endif
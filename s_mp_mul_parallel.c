@@ -0,0 +1,57 @@
+#include "tommath_private.h"
+#ifdef S_MP_MUL_PARALLEL_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+
+/* c[i] = a[i] * b[i] for the independent products of one Karatsuba or
+ * Toom-Cook level, the c[i] were carved from s.
+ *
+ * If worker threads were started with mp_mul_threads() and the products
+ * have at least MP_MUL_PARALLEL_CUTOFF digits they are queued, computed by
+ * the workers and the calling thread together in their own ints and copied
+ * afterwards.  Otherwise they are computed one after the other, so a c[i]
+ * must not be an operand of a later product.
+ */
+mp_err s_mp_mul_parallel(const mp_int *a[], const mp_int *b[], mp_int *c[], int n, mp_scratch *s)
+{
+   mp_err err = MP_OKAY;
+   int i;
+
+#ifdef MP_USE_PTHREADS
+   /* Toom-Cook 3-way has the most */
+   mp_mul_task task[5];
+
+   if ((n <= 5) &&
+       (MP_MUL_WORKERS > 0) &&
+       (MP_MIN(a[0]->used, b[0]->used) >= MP_MUL_PARALLEL_CUTOFF)) {
+      for (i = 0; i < n; i++) {
+         if ((err = mp_init(&task[i].c)) != MP_OKAY) {
+            while (i-- > 0) {
+               mp_clear(&task[i].c);
+            }
+            return err;
+         }
+         task[i].a = a[i];
+         task[i].b = b[i];
+         task[i].run = NULL;
+      }
+      s_mp_mul_pool_run(task, n);
+
+      for (i = 0; i < n; i++) {
+         if (err == MP_OKAY) {
+            err = (task[i].err != MP_OKAY) ? task[i].err : mp_copy(&task[i].c, c[i]);
+         }
+         mp_clear(&task[i].c);
+      }
+      return err;
+   }
+#endif
+
+   for (i = 0; i < n; i++) {
+      if ((err = s_mp_mul_scratch(a[i], b[i], c[i], s)) != MP_OKAY) {
+         break;
+      }
+   }
+   return err;
+}
+#endif
@@ -0,0 +1,34 @@
+#include "tommath_private.h"
+#ifdef S_MP_MUL_POOL_RUN_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+
+/* Queues the n tasks for the worker threads and returns when all of them are done.
+ *
+ * The calling thread takes tasks off the queue, too, instead of waiting.  Called
+ * without the lock of the pool.
+ */
+#ifdef MP_USE_PTHREADS
+void s_mp_mul_pool_run(mp_mul_task *task, int n)
+{
+   int i, pending = n;
+
+   pthread_mutex_lock(&s_mp_mul_pool.lock);
+   for (i = 0; i < n; i++) {
+      task[i].pending = &pending;
+      task[i].next = s_mp_mul_pool.queue;
+      s_mp_mul_pool.queue = &task[i];
+   }
+   /* the threads waiting for their own tasks can take these, too */
+   pthread_cond_broadcast(&s_mp_mul_pool.work);
+   pthread_cond_broadcast(&s_mp_mul_pool.done);
+
+   while (pending > 0) {
+      if (!s_mp_mul_task_run()) {
+         pthread_cond_wait(&s_mp_mul_pool.done, &s_mp_mul_pool.lock);
+      }
+   }
+   pthread_mutex_unlock(&s_mp_mul_pool.lock);
+}
+#endif
+#endif
@@ -0,0 +1,85 @@
+#include "tommath_private.h"
+#ifdef S_MP_MUL_SCRATCH_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+
+/* c = a * b for the recursive multiplications, c was carved from s
+ *
+ * Chooses like mp_mul() does.  Balanced Karatsuba and Toom-Cook 3-way carve
+ * their temporaries from s, too, if the rest of s holds s_mp_scratch_size()
+ * for them.  The comba multipliers work in place and the BMI2/ADX ones unless
+ * c is a source.  Everything else, and the levels that do not fit, which only
+ * happens with the smallest cutoffs, is computed in s->t and copied to c.
+ */
+mp_err s_mp_mul_scratch(const mp_int *a, const mp_int *b, mp_int *c, mp_scratch *s)
+{
+   mp_err err;
+   int min = MP_MIN(a->used, b->used),
+       max = MP_MAX(a->used, b->used),
+       digs = a->used + b->used + 1;
+   bool neg = (a->sign != b->sign), here = false;
+   int left = s->alloc - s->used;
+
+   if (a == b) {
+      if ((MP_HAS(S_MP_SQR_FFT) && (a->used >= MP_SQR_FFT_CUTOFF)) ||
+          (MP_HAS(S_MP_SQR_TOOM4) && (a->used >= MP_SQR_TOOM4_CUTOFF))) {
+         /* not done here */
+      } else if (MP_HAS(S_MP_SQR_TOOM) && (a->used >= MP_SQR_TOOM_CUTOFF)) {
+         if (s_mp_scratch_size(a->used, a->used) <= left) {
+            err = s_mp_sqr_toom(a, c, s);
+            here = true;
+         }
+      } else if (MP_HAS(S_MP_SQR_KARATSUBA) && (a->used >= MP_SQR_KARATSUBA_CUTOFF)) {
+         if (s_mp_scratch_size(a->used, a->used) <= left) {
+            err = s_mp_sqr_karatsuba(a, c, s);
+            here = true;
+         }
+      } else if (MP_HAS(S_MP_SQR_ADX) && s_mp_cpu_adx()) {
+         /* in place it is not done here */
+         if (c != a) {
+            err = s_mp_sqr_adx(a, c);
+            here = true;
+         }
+      } else if (MP_HAS(S_MP_SQR_COMBA)) {
+         err = s_mp_sqr_comba(a, c);
+         here = true;
+      }
+   } else if ((min >= MP_MUL_KARATSUBA_CUTOFF) && ((4 * max) >= (5 * min))) {
+      /* the unbalanced variants are not done here */
+   } else if ((MP_HAS(S_MP_MUL_FFT) && (min >= MP_MUL_FFT_CUTOFF)) ||
+              (MP_HAS(S_MP_MUL_TOOM4) && (min >= MP_MUL_TOOM4_CUTOFF))) {
+      /* not done here */
+   } else if (MP_HAS(S_MP_MUL_TOOM) && (min >= MP_MUL_TOOM_CUTOFF)) {
+      if (s_mp_scratch_size(a->used, b->used) <= left) {
+         err = s_mp_mul_toom(a, b, c, s);
+         here = true;
+      }
+   } else if (MP_HAS(S_MP_MUL_KARATSUBA) && (min >= MP_MUL_KARATSUBA_CUTOFF)) {
+      if (s_mp_scratch_size(a->used, b->used) <= left) {
+         err = s_mp_mul_karatsuba(a, b, c, s);
+         here = true;
+      }
+   } else if (MP_HAS(S_MP_MUL_ADX) && s_mp_cpu_adx()) {
+      /* in place it is not done here */
+      if ((c != a) && (c != b)) {
+         err = s_mp_mul_adx(a, b, c, digs);
+         here = true;
+      }
+   } else if (MP_HAS(S_MP_MUL_COMBA)) {
+      err = s_mp_mul_comba(a, b, c, digs);
+      here = true;
+   }
+
+   if (!here) {
+      if ((s->t.dp == NULL) && ((err = mp_init(&s->t)) != MP_OKAY)) {
+         return err;
+      }
+      if ((err = mp_mul(a, b, &s->t)) != MP_OKAY) {
+         return err;
+      }
+      err = mp_copy(&s->t, c);
+   }
+   c->sign = ((c->used > 0) && neg) ? MP_NEG : MP_ZPOS;
+   return err;
+}
+#endif
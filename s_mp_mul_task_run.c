@@ -0,0 +1,34 @@
+#include "tommath_private.h"
+#ifdef S_MP_MUL_TASK_RUN_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+
+/* Takes a task off the queue and computes its product or runs it, false if there was none.
+ *
+ * Called with the lock of the pool held, it is released during the multiplication.
+ */
+#ifdef MP_USE_PTHREADS
+bool s_mp_mul_task_run(void)
+{
+   mp_mul_task *task = s_mp_mul_pool.queue;
+
+   if (task == NULL) {
+      return false;
+   }
+   s_mp_mul_pool.queue = task->next;
+
+   pthread_mutex_unlock(&s_mp_mul_pool.lock);
+   if (task->run != NULL) {
+      task->run(task->arg);
+   } else {
+      task->err = mp_mul(task->a, task->b, &task->c);
+   }
+   pthread_mutex_lock(&s_mp_mul_pool.lock);
+
+   if (--*task->pending == 0) {
+      pthread_cond_broadcast(&s_mp_mul_pool.done);
+   }
+   return true;
+}
+#endif
+#endif
@@ -27,26 +27,45 @@
 
      Bodrato, Marco, and Alberto Zanoni. "What about Toom-Cook matrices optimality."
      Centro Vito Volterra Universita di Roma Tor Vergata (2006)
+
+   All five points are evaluated first, the products may run in parallel,
+   see s_mp_mul_parallel().
 */
 
-mp_err s_mp_mul_toom(const mp_int *a, const mp_int *b, mp_int *c)
+mp_err s_mp_mul_toom(const mp_int *a, const mp_int *b, mp_int *c, mp_scratch *s)
 {
-   mp_int S1, S2, T1, a0, a1, a2, b0, b1, b2;
-   int B;
+   mp_int S1, S2, T1, a0, a1, a2, b0, b1, b2, *pc[5];
+   const mp_int *pa[5], *pb[5];
+   int B, P, mark;
    mp_err err;
 
-   /* init temps */
-   if ((err = mp_init_multi(&S1, &S2, &T1, NULL)) != MP_OKAY) {
+   /* the top level allocates the scratch space for all of them */
+   if (s == NULL) {
+      mp_scratch own;
+      if ((err = s_mp_scratch_init(&own, s_mp_scratch_size(a->used, b->used))) != MP_OKAY) {
+         return err;
+      }
+      err = s_mp_mul_toom(a, b, c, &own);
+      s_mp_scratch_clear(&own);
       return err;
    }
+   mark = s->used;
 
    /* B */
    B = MP_MIN(a->used, b->used) / 3;
 
+   /* room for a product and the carries of the sums */
+   P = a->used + b->used + 3;
+
+   /* carve the temps, a0, a1 and b1 take products later on */
+   if ((err = s_mp_scratch_get(s, &S1, P)) != MP_OKAY)            goto LBL_ERR;
+   if ((err = s_mp_scratch_get(s, &S2, P)) != MP_OKAY)            goto LBL_ERR;
+   if ((err = s_mp_scratch_get(s, &T1, P)) != MP_OKAY)            goto LBL_ERR;
+
    /** a = a2 * x^2 + a1 * x + a0; */
-   if ((err = mp_init_size(&a0, B)) != MP_OKAY)                   goto LBL_ERRa0;
-   if ((err = mp_init_size(&a1, B)) != MP_OKAY)                   goto LBL_ERRa1;
-   if ((err = mp_init_size(&a2, a->used - 2 * B)) != MP_OKAY)     goto LBL_ERRa2;
+   if ((err = s_mp_scratch_get(s, &a0, P)) != MP_OKAY)            goto LBL_ERR;
+   if ((err = s_mp_scratch_get(s, &a1, P)) != MP_OKAY)            goto LBL_ERR;
+   if ((err = s_mp_scratch_get(s, &a2, a->used - 2 * B)) != MP_OKAY) goto LBL_ERR;
 
    a0.used = a1.used = B;
    a2.used = a->used - 2 * B;
@@ -58,9 +77,9 @@ mp_err s_mp_mul_toom(const mp_int *a, const mp_int *b, mp_int *c)
    mp_clamp(&a2);
 
    /** b = b2 * x^2 + b1 * x + b0; */
-   if ((err = mp_init_size(&b0, B)) != MP_OKAY)                   goto LBL_ERRb0;
-   if ((err = mp_init_size(&b1, B)) != MP_OKAY)                   goto LBL_ERRb1;
-   if ((err = mp_init_size(&b2, b->used - 2 * B)) != MP_OKAY)     goto LBL_ERRb2;
+   if ((err = s_mp_scratch_get(s, &b0, B)) != MP_OKAY)            goto LBL_ERR;
+   if ((err = s_mp_scratch_get(s, &b1, P)) != MP_OKAY)            goto LBL_ERR;
+   if ((err = s_mp_scratch_get(s, &b2, b->used - 2 * B)) != MP_OKAY) goto LBL_ERR;
 
    b0.used = b1.used = B;
    b2.used = b->used - 2 * B;
@@ -84,9 +103,6 @@ mp_err s_mp_mul_toom(const mp_int *a, const mp_int *b, mp_int *c)
    /** S1 = c + b0; */
    if ((err = mp_add(c, &b0, &S1)) != MP_OKAY)                    goto LBL_ERR;
 
-   /** S1 = S1 * S2; */
-   if ((err = mp_mul(&S1, &S2, &S1)) != MP_OKAY)                  goto LBL_ERR;
-
    /** \\S2 = (4*a2+2*a1+a0) * (4*b2+2*b1+b0); */
    /** T1 = T1 + a2; */
    if ((err = mp_add(&T1, &a2, &T1)) != MP_OKAY)                  goto LBL_ERR;
@@ -106,9 +122,6 @@ mp_err s_mp_mul_toom(const mp_int *a, const mp_int *b, mp_int *c)
    /** c = c + b0; */
    if ((err = mp_add(c, &b0, c)) != MP_OKAY)                      goto LBL_ERR;
 
-   /** S2 = T1 * c; */
-   if ((err = mp_mul(&T1, c, &S2)) != MP_OKAY)                    goto LBL_ERR;
-
    /** \\S3 = (a2-a1+a0) * (b2-b1+b0); */
    /** a1 = a2 - a1; */
    if ((err = mp_sub(&a2, &a1, &a1)) != MP_OKAY)                  goto LBL_ERR;
@@ -122,11 +135,32 @@ mp_err s_mp_mul_toom(const mp_int *a, const mp_int *b, mp_int *c)
    /** b1 = b1 + b0; */
    if ((err = mp_add(&b1, &b0, &b1)) != MP_OKAY)                  goto LBL_ERR;
 
+   /* the five products are independent, compute them at once */
+   /** S1 = S1 * S2; */
+   pa[0] = &S1;
+   pb[0] = &S2;
+   pc[0] = &S1;
+
+   /** S2 = T1 * c; */
+   pa[1] = &T1;
+   pb[1] = c;
+   pc[1] = &S2;
+
    /** a1 = a1 * b1; */
-   if ((err = mp_mul(&a1, &b1, &a1)) != MP_OKAY)                  goto LBL_ERR;
+   pa[2] = &a1;
+   pb[2] = &b1;
+   pc[2] = &a1;
 
    /** b1 = a2 * b2; */
-   if ((err = mp_mul(&a2, &b2, &b1)) != MP_OKAY)                  goto LBL_ERR;
+   pa[3] = &a2;
+   pb[3] = &b2;
+   pc[3] = &b1;
+
+   /** a0 = a0 * b0; */
+   pa[4] = &a0;
+   pb[4] = &b0;
+   pc[4] = &a0;
+   if ((err = s_mp_mul_parallel(pa, pb, pc, 5, s)) != MP_OKAY)    goto LBL_ERR;
 
    /** \\S2 = (S2 - S3)/3; */
    /** S2 = S2 - a1; */
@@ -141,9 +175,6 @@ mp_err s_mp_mul_toom(const mp_int *a, const mp_int *b, mp_int *c)
    /** a1 = a1 >> 1; */
    if ((err = mp_div_2(&a1, &a1)) != MP_OKAY)                     goto LBL_ERR;
 
-   /** a0 = a0 * b0; */
-   if ((err = mp_mul(&a0, &b0, &a0)) != MP_OKAY)                  goto LBL_ERR;
-
    /** S1 = S1 - a0; */
    if ((err = mp_sub(&S1, &a0, &S1)) != MP_OKAY)                  goto LBL_ERR;
 
@@ -183,19 +214,8 @@ mp_err s_mp_mul_toom(const mp_int *a, const mp_int *b, mp_int *c)
 
 
 LBL_ERR:
-   mp_clear(&b2);
-LBL_ERRb2:
-   mp_clear(&b1);
-LBL_ERRb1:
-   mp_clear(&b0);
-LBL_ERRb0:
-   mp_clear(&a2);
-LBL_ERRa2:
-   mp_clear(&a1);
-LBL_ERRa1:
-   mp_clear(&a0);
-LBL_ERRa0:
-   mp_clear_multi(&S1, &S2, &T1, NULL);
+   /* give the temps back */
+   s->used = mark;
    return err;
 }
 
@@ -0,0 +1,74 @@
+#include "tommath_private.h"
+#ifdef S_MP_MUL_TOOM32_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+
+/* unbalanced Toom-Cook multiplication of a 3-piece a with a 2-piece b
+ *
+ * Meant for operands with a size ratio of about 3:2. Both are evaluated
+ * at the shared points 0, 1, -1 and infinity, which needs four
+ * multiplications of half the size of the smaller operand instead of the
+ * six a schoolbook split would need.
+ */
+mp_err s_mp_mul_toom32(const mp_int *a, const mp_int *b, mp_int *c)
+{
+   mp_int ap[3], bp[2], w0, w1, wm1, winf, t;
+   int B;
+   mp_err err;
+
+   if ((err = mp_init_multi(&ap[0], &ap[1], &ap[2], &bp[0], &bp[1], NULL)) != MP_OKAY) {
+      return err;
+   }
+   if ((err = mp_init_multi(&w0, &w1, &wm1, &winf, &t, NULL)) != MP_OKAY) {
+      goto LBL_ERRw;
+   }
+
+   /* Make sure that A is the larger one */
+   if (a->used < b->used) {
+      MP_EXCH(const mp_int *, a, b);
+   }
+
+   B = MP_MAX((a->used + 2) / 3, (b->used + 1) / 2);
+
+   /** a = a2*x^2 + a1*x + a0; b = b1*x + b0; */
+   if ((err = s_mp_toom_split(a, B, 3, ap)) != MP_OKAY)           goto LBL_ERR;
+   if ((err = s_mp_toom_split(b, B, 2, bp)) != MP_OKAY)           goto LBL_ERR;
+
+   /** w1 = (a0 + a1 + a2) * (b0 + b1); wm1 = (a0 - a1 + a2) * (b0 - b1); */
+   if ((err = mp_add(&ap[0], &ap[2], &t)) != MP_OKAY)             goto LBL_ERR;
+   if ((err = mp_add(&t, &ap[1], &w0)) != MP_OKAY)                goto LBL_ERR;
+   if ((err = mp_add(&bp[0], &bp[1], &winf)) != MP_OKAY)          goto LBL_ERR;
+   if ((err = mp_mul(&w0, &winf, &w1)) != MP_OKAY)                goto LBL_ERR;
+   if ((err = mp_sub(&t, &ap[1], &w0)) != MP_OKAY)                goto LBL_ERR;
+   if ((err = mp_sub(&bp[0], &bp[1], &winf)) != MP_OKAY)          goto LBL_ERR;
+   if ((err = mp_mul(&w0, &winf, &wm1)) != MP_OKAY)               goto LBL_ERR;
+
+   /** w0 = a0 * b0; winf = a2 * b1; */
+   if ((err = mp_mul(&ap[0], &bp[0], &w0)) != MP_OKAY)            goto LBL_ERR;
+   if ((err = mp_mul(&ap[2], &bp[1], &winf)) != MP_OKAY)          goto LBL_ERR;
+
+   /** t = (w1 - wm1)/2 - winf = c1; */
+   if ((err = mp_sub(&w1, &wm1, &t)) != MP_OKAY)                  goto LBL_ERR;
+   if ((err = mp_div_2(&t, &t)) != MP_OKAY)                       goto LBL_ERR;
+   if ((err = mp_sub(&t, &winf, &t)) != MP_OKAY)                  goto LBL_ERR;
+   /** w1 = (w1 + wm1)/2 - w0 = c2; */
+   if ((err = mp_add(&w1, &wm1, &w1)) != MP_OKAY)                 goto LBL_ERR;
+   if ((err = mp_div_2(&w1, &w1)) != MP_OKAY)                     goto LBL_ERR;
+   if ((err = mp_sub(&w1, &w0, &w1)) != MP_OKAY)                  goto LBL_ERR;
+
+   /** P = winf*x^3 + w1*x^2 + t*x + w0; */
+   if ((err = mp_lshd(&winf, 3 * B)) != MP_OKAY)                  goto LBL_ERR;
+   if ((err = mp_lshd(&w1, 2 * B)) != MP_OKAY)                    goto LBL_ERR;
+   if ((err = mp_add(&winf, &w1, &winf)) != MP_OKAY)              goto LBL_ERR;
+   if ((err = mp_lshd(&t, B)) != MP_OKAY)                         goto LBL_ERR;
+   if ((err = mp_add(&winf, &t, &winf)) != MP_OKAY)               goto LBL_ERR;
+   if ((err = mp_add(&winf, &w0, c)) != MP_OKAY)                  goto LBL_ERR;
+
+LBL_ERR:
+   mp_clear_multi(&w0, &w1, &wm1, &winf, &t, NULL);
+LBL_ERRw:
+   mp_clear_multi(&ap[0], &ap[1], &ap[2], &bp[0], &bp[1], NULL);
+   return err;
+}
+
+#endif
@@ -0,0 +1,112 @@
+#include "tommath_private.h"
+#ifdef S_MP_MUL_TOOM4_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+
+/* multiplication using the Toom-Cook 4-way algorithm
+ *
+ * Seven multiplications of a quarter of the size instead of the five
+ * of a third of the size in Toom-Cook 3-way, which gives an asymptotic
+ * running time of O(N**1.404).  Evaluation points are 0, 1, -1, 2, -2,
+ * 1/2 and infinity, see
+ *
+ *    Bodrato, Marco. "Towards optimal Toom-Cook multiplication for
+ *    univariate and multivariate polynomials in characteristic 2 and 0."
+ *    WAIFI 2007, LNCS 4547, Springer (2007)
+ */
+
+mp_err s_mp_mul_toom4(const mp_int *a, const mp_int *b, mp_int *c)
+{
+   mp_int ap[4], bp[4], w[7], sa, ta, sb, tb;
+   int B;
+   mp_err err;
+
+   if ((err = mp_init_multi(&ap[0], &ap[1], &ap[2], &ap[3], &bp[0], &bp[1], &bp[2], &bp[3], NULL)) != MP_OKAY) {
+      return err;
+   }
+   if ((err = mp_init_multi(&w[0], &w[1], &w[2], &w[3], &w[4], &w[5], &w[6], NULL)) != MP_OKAY) {
+      goto LBL_ERRw;
+   }
+   if ((err = mp_init_multi(&sa, &ta, &sb, &tb, NULL)) != MP_OKAY) {
+      goto LBL_ERRt;
+   }
+
+   B = MP_MIN(a->used, b->used) / 4;
+
+   /** a = a3*x^3 + a2*x^2 + a1*x + a0; */
+   if ((err = s_mp_toom_split(a, B, 4, ap)) != MP_OKAY)           goto LBL_ERR;
+   /** b = b3*x^3 + b2*x^2 + b1*x + b0; */
+   if ((err = s_mp_toom_split(b, B, 4, bp)) != MP_OKAY)           goto LBL_ERR;
+
+   /** \\ w1 = a(1)*b(1), w2 = a(-1)*b(-1) */
+   /** sa = a0 + a2; ta = a1 + a3; */
+   if ((err = mp_add(&ap[0], &ap[2], &sa)) != MP_OKAY)            goto LBL_ERR;
+   if ((err = mp_add(&ap[1], &ap[3], &ta)) != MP_OKAY)            goto LBL_ERR;
+   /** sb = b0 + b2; tb = b1 + b3; */
+   if ((err = mp_add(&bp[0], &bp[2], &sb)) != MP_OKAY)            goto LBL_ERR;
+   if ((err = mp_add(&bp[1], &bp[3], &tb)) != MP_OKAY)            goto LBL_ERR;
+   /** w1 = (sa + ta) * (sb + tb); */
+   if ((err = mp_add(&sa, &ta, &w[5])) != MP_OKAY)                goto LBL_ERR;
+   if ((err = mp_add(&sb, &tb, &w[6])) != MP_OKAY)                goto LBL_ERR;
+   if ((err = mp_mul(&w[5], &w[6], &w[1])) != MP_OKAY)            goto LBL_ERR;
+   /** w2 = (sa - ta) * (sb - tb); */
+   if ((err = mp_sub(&sa, &ta, &w[5])) != MP_OKAY)                goto LBL_ERR;
+   if ((err = mp_sub(&sb, &tb, &w[6])) != MP_OKAY)                goto LBL_ERR;
+   if ((err = mp_mul(&w[5], &w[6], &w[2])) != MP_OKAY)            goto LBL_ERR;
+
+   /** \\ w3 = a(2)*b(2), w4 = a(-2)*b(-2) */
+   /** sa = a0 + 4*a2; ta = 2*a1 + 8*a3; */
+   if ((err = mp_mul_2d(&ap[2], 2, &sa)) != MP_OKAY)              goto LBL_ERR;
+   if ((err = mp_add(&sa, &ap[0], &sa)) != MP_OKAY)               goto LBL_ERR;
+   if ((err = mp_mul_2d(&ap[3], 2, &ta)) != MP_OKAY)              goto LBL_ERR;
+   if ((err = mp_add(&ta, &ap[1], &ta)) != MP_OKAY)               goto LBL_ERR;
+   if ((err = mp_mul_2(&ta, &ta)) != MP_OKAY)                     goto LBL_ERR;
+   /** sb = b0 + 4*b2; tb = 2*b1 + 8*b3; */
+   if ((err = mp_mul_2d(&bp[2], 2, &sb)) != MP_OKAY)              goto LBL_ERR;
+   if ((err = mp_add(&sb, &bp[0], &sb)) != MP_OKAY)               goto LBL_ERR;
+   if ((err = mp_mul_2d(&bp[3], 2, &tb)) != MP_OKAY)              goto LBL_ERR;
+   if ((err = mp_add(&tb, &bp[1], &tb)) != MP_OKAY)               goto LBL_ERR;
+   if ((err = mp_mul_2(&tb, &tb)) != MP_OKAY)                     goto LBL_ERR;
+   /** w3 = (sa + ta) * (sb + tb); */
+   if ((err = mp_add(&sa, &ta, &w[5])) != MP_OKAY)                goto LBL_ERR;
+   if ((err = mp_add(&sb, &tb, &w[6])) != MP_OKAY)                goto LBL_ERR;
+   if ((err = mp_mul(&w[5], &w[6], &w[3])) != MP_OKAY)            goto LBL_ERR;
+   /** w4 = (sa - ta) * (sb - tb); */
+   if ((err = mp_sub(&sa, &ta, &w[5])) != MP_OKAY)                goto LBL_ERR;
+   if ((err = mp_sub(&sb, &tb, &w[6])) != MP_OKAY)                goto LBL_ERR;
+   if ((err = mp_mul(&w[5], &w[6], &w[4])) != MP_OKAY)            goto LBL_ERR;
+
+   /** \\ w5 = 2^6 * a(1/2)*b(1/2) */
+   /** sa = ((2*a0 + a1)*2 + a2)*2 + a3; */
+   if ((err = mp_mul_2(&ap[0], &sa)) != MP_OKAY)                  goto LBL_ERR;
+   if ((err = mp_add(&sa, &ap[1], &sa)) != MP_OKAY)               goto LBL_ERR;
+   if ((err = mp_mul_2(&sa, &sa)) != MP_OKAY)                     goto LBL_ERR;
+   if ((err = mp_add(&sa, &ap[2], &sa)) != MP_OKAY)               goto LBL_ERR;
+   if ((err = mp_mul_2(&sa, &sa)) != MP_OKAY)                     goto LBL_ERR;
+   if ((err = mp_add(&sa, &ap[3], &sa)) != MP_OKAY)               goto LBL_ERR;
+   /** sb = ((2*b0 + b1)*2 + b2)*2 + b3; */
+   if ((err = mp_mul_2(&bp[0], &sb)) != MP_OKAY)                  goto LBL_ERR;
+   if ((err = mp_add(&sb, &bp[1], &sb)) != MP_OKAY)               goto LBL_ERR;
+   if ((err = mp_mul_2(&sb, &sb)) != MP_OKAY)                     goto LBL_ERR;
+   if ((err = mp_add(&sb, &bp[2], &sb)) != MP_OKAY)               goto LBL_ERR;
+   if ((err = mp_mul_2(&sb, &sb)) != MP_OKAY)                     goto LBL_ERR;
+   if ((err = mp_add(&sb, &bp[3], &sb)) != MP_OKAY)               goto LBL_ERR;
+   /** w5 = sa * sb; */
+   if ((err = mp_mul(&sa, &sb, &w[5])) != MP_OKAY)                goto LBL_ERR;
+
+   /** w0 = a0 * b0; w6 = a3 * b3; */
+   if ((err = mp_mul(&ap[0], &bp[0], &w[0])) != MP_OKAY)          goto LBL_ERR;
+   if ((err = mp_mul(&ap[3], &bp[3], &w[6])) != MP_OKAY)          goto LBL_ERR;
+
+   err = s_mp_toom4_interpolate(w, B, c);
+
+LBL_ERR:
+   mp_clear_multi(&sa, &ta, &sb, &tb, NULL);
+LBL_ERRt:
+   mp_clear_multi(&w[0], &w[1], &w[2], &w[3], &w[4], &w[5], &w[6], NULL);
+LBL_ERRw:
+   mp_clear_multi(&ap[0], &ap[1], &ap[2], &ap[3], &bp[0], &bp[1], &bp[2], &bp[3], NULL);
+   return err;
+}
+
+#endif
@@ -0,0 +1,103 @@
+#include "tommath_private.h"
+#ifdef S_MP_MUL_TOOM42_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+
+/* unbalanced Toom-Cook multiplication of a 4-piece a with a 2-piece b
+ *
+ * Meant for operands with a size ratio of about 2:1. Both are evaluated
+ * at the shared points 0, 1, -1, 2 and infinity, which needs five
+ * multiplications of half the size of the smaller operand instead of the
+ * eight a schoolbook split would need.
+ */
+mp_err s_mp_mul_toom42(const mp_int *a, const mp_int *b, mp_int *c)
+{
+   mp_int ap[4], bp[2], w0, w1, wm1, w2, winf, s, t;
+   int B;
+   mp_err err;
+
+   if ((err = mp_init_multi(&ap[0], &ap[1], &ap[2], &ap[3], &bp[0], &bp[1], NULL)) != MP_OKAY) {
+      return err;
+   }
+   if ((err = mp_init_multi(&w0, &w1, &wm1, &w2, &winf, &s, &t, NULL)) != MP_OKAY) {
+      goto LBL_ERRw;
+   }
+
+   /* Make sure that A is the larger one */
+   if (a->used < b->used) {
+      MP_EXCH(const mp_int *, a, b);
+   }
+
+   B = MP_MAX((a->used + 3) / 4, (b->used + 1) / 2);
+
+   /** a = a3*x^3 + a2*x^2 + a1*x + a0; b = b1*x + b0; */
+   if ((err = s_mp_toom_split(a, B, 4, ap)) != MP_OKAY)           goto LBL_ERR;
+   if ((err = s_mp_toom_split(b, B, 2, bp)) != MP_OKAY)           goto LBL_ERR;
+
+   /** \\ w1 = a(1)*b(1), wm1 = a(-1)*b(-1) */
+   /** s = a0 + a2; t = a1 + a3; */
+   if ((err = mp_add(&ap[0], &ap[2], &s)) != MP_OKAY)             goto LBL_ERR;
+   if ((err = mp_add(&ap[1], &ap[3], &t)) != MP_OKAY)             goto LBL_ERR;
+   if ((err = mp_add(&s, &t, &w0)) != MP_OKAY)                    goto LBL_ERR;
+   if ((err = mp_add(&bp[0], &bp[1], &winf)) != MP_OKAY)          goto LBL_ERR;
+   if ((err = mp_mul(&w0, &winf, &w1)) != MP_OKAY)                goto LBL_ERR;
+   if ((err = mp_sub(&s, &t, &w0)) != MP_OKAY)                    goto LBL_ERR;
+   if ((err = mp_sub(&bp[0], &bp[1], &winf)) != MP_OKAY)          goto LBL_ERR;
+   if ((err = mp_mul(&w0, &winf, &wm1)) != MP_OKAY)               goto LBL_ERR;
+
+   /** \\ w2 = a(2)*b(2) */
+   /** s = ((8*a3 + 4*a2) + 2*a1) + a0; t = 2*b1 + b0; */
+   if ((err = mp_mul_2(&ap[3], &s)) != MP_OKAY)                   goto LBL_ERR;
+   if ((err = mp_add(&s, &ap[2], &s)) != MP_OKAY)                 goto LBL_ERR;
+   if ((err = mp_mul_2(&s, &s)) != MP_OKAY)                       goto LBL_ERR;
+   if ((err = mp_add(&s, &ap[1], &s)) != MP_OKAY)                 goto LBL_ERR;
+   if ((err = mp_mul_2(&s, &s)) != MP_OKAY)                       goto LBL_ERR;
+   if ((err = mp_add(&s, &ap[0], &s)) != MP_OKAY)                 goto LBL_ERR;
+   if ((err = mp_mul_2(&bp[1], &t)) != MP_OKAY)                   goto LBL_ERR;
+   if ((err = mp_add(&t, &bp[0], &t)) != MP_OKAY)                 goto LBL_ERR;
+   if ((err = mp_mul(&s, &t, &w2)) != MP_OKAY)                    goto LBL_ERR;
+
+   /** w0 = a0 * b0; winf = a3 * b1; */
+   if ((err = mp_mul(&ap[0], &bp[0], &w0)) != MP_OKAY)            goto LBL_ERR;
+   if ((err = mp_mul(&ap[3], &bp[1], &winf)) != MP_OKAY)          goto LBL_ERR;
+
+   /** s = (w1 - wm1)/2 = c1 + c3; */
+   if ((err = mp_sub(&w1, &wm1, &s)) != MP_OKAY)                  goto LBL_ERR;
+   if ((err = mp_div_2(&s, &s)) != MP_OKAY)                       goto LBL_ERR;
+   /** w1 = (w1 + wm1)/2 - w0 - winf = c2; */
+   if ((err = mp_add(&w1, &wm1, &w1)) != MP_OKAY)                 goto LBL_ERR;
+   if ((err = mp_div_2(&w1, &w1)) != MP_OKAY)                     goto LBL_ERR;
+   if ((err = mp_sub(&w1, &w0, &w1)) != MP_OKAY)                  goto LBL_ERR;
+   if ((err = mp_sub(&w1, &winf, &w1)) != MP_OKAY)                goto LBL_ERR;
+
+   /** w2 = (w2 - w0 - 4*w1 - 16*winf)/2 = c1 + 4*c3; */
+   if ((err = mp_sub(&w2, &w0, &w2)) != MP_OKAY)                  goto LBL_ERR;
+   if ((err = mp_mul_2d(&w1, 2, &t)) != MP_OKAY)                  goto LBL_ERR;
+   if ((err = mp_sub(&w2, &t, &w2)) != MP_OKAY)                   goto LBL_ERR;
+   if ((err = mp_mul_2d(&winf, 4, &t)) != MP_OKAY)                goto LBL_ERR;
+   if ((err = mp_sub(&w2, &t, &w2)) != MP_OKAY)                   goto LBL_ERR;
+   if ((err = mp_div_2(&w2, &w2)) != MP_OKAY)                     goto LBL_ERR;
+   /** w2 = (w2 - s)/3 = c3; */
+   if ((err = mp_sub(&w2, &s, &w2)) != MP_OKAY)                   goto LBL_ERR;
+   if ((err = s_mp_div_3(&w2, &w2, NULL)) != MP_OKAY)             goto LBL_ERR;
+   /** s = s - w2 = c1; */
+   if ((err = mp_sub(&s, &w2, &s)) != MP_OKAY)                    goto LBL_ERR;
+
+   /** P = winf*x^4 + w2*x^3 + w1*x^2 + s*x + w0; */
+   if ((err = mp_lshd(&winf, 4 * B)) != MP_OKAY)                  goto LBL_ERR;
+   if ((err = mp_lshd(&w2, 3 * B)) != MP_OKAY)                    goto LBL_ERR;
+   if ((err = mp_add(&winf, &w2, &winf)) != MP_OKAY)              goto LBL_ERR;
+   if ((err = mp_lshd(&w1, 2 * B)) != MP_OKAY)                    goto LBL_ERR;
+   if ((err = mp_add(&winf, &w1, &winf)) != MP_OKAY)              goto LBL_ERR;
+   if ((err = mp_lshd(&s, B)) != MP_OKAY)                         goto LBL_ERR;
+   if ((err = mp_add(&winf, &s, &winf)) != MP_OKAY)               goto LBL_ERR;
+   if ((err = mp_add(&winf, &w0, c)) != MP_OKAY)                  goto LBL_ERR;
+
+LBL_ERR:
+   mp_clear_multi(&w0, &w1, &wm1, &w2, &winf, &s, &t, NULL);
+LBL_ERRw:
+   mp_clear_multi(&ap[0], &ap[1], &ap[2], &ap[3], &bp[0], &bp[1], NULL);
+   return err;
+}
+
+#endif
@@ -0,0 +1,112 @@
+#include "tommath_private.h"
+#ifdef S_MP_MUL_TOOM53_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+
+/* unbalanced Toom-Cook multiplication of a 5-piece a with a 3-piece b
+ *
+ * Meant for large operands with a size ratio of about 5:3. The product
+ * has degree six like the one of Toom-Cook 4-way, so it is evaluated at
+ * the same points 0, 1, -1, 2, -2, 1/2 and infinity and shares the
+ * interpolation.  That are seven multiplications of a third of the size
+ * of the smaller operand instead of the fifteen of a schoolbook split.
+ */
+mp_err s_mp_mul_toom53(const mp_int *a, const mp_int *b, mp_int *c)
+{
+   mp_int ap[5], bp[3], w[7], sa, ta, sb, tb;
+   int B;
+   mp_err err;
+
+   if ((err = mp_init_multi(&ap[0], &ap[1], &ap[2], &ap[3], &ap[4], &bp[0], &bp[1], &bp[2], NULL)) != MP_OKAY) {
+      return err;
+   }
+   if ((err = mp_init_multi(&w[0], &w[1], &w[2], &w[3], &w[4], &w[5], &w[6], NULL)) != MP_OKAY) {
+      goto LBL_ERRw;
+   }
+   if ((err = mp_init_multi(&sa, &ta, &sb, &tb, NULL)) != MP_OKAY) {
+      goto LBL_ERRt;
+   }
+
+   /* Make sure that A is the larger one */
+   if (a->used < b->used) {
+      MP_EXCH(const mp_int *, a, b);
+   }
+
+   B = MP_MAX((a->used + 4) / 5, (b->used + 2) / 3);
+
+   /** a = a4*x^4 + a3*x^3 + a2*x^2 + a1*x + a0; */
+   if ((err = s_mp_toom_split(a, B, 5, ap)) != MP_OKAY)           goto LBL_ERR;
+   /** b = b2*x^2 + b1*x + b0; */
+   if ((err = s_mp_toom_split(b, B, 3, bp)) != MP_OKAY)           goto LBL_ERR;
+
+   /** \\ w1 = a(1)*b(1), w2 = a(-1)*b(-1) */
+   /** sa = a0 + a2 + a4; ta = a1 + a3; sb = b0 + b2; */
+   if ((err = mp_add(&ap[0], &ap[2], &sa)) != MP_OKAY)            goto LBL_ERR;
+   if ((err = mp_add(&sa, &ap[4], &sa)) != MP_OKAY)               goto LBL_ERR;
+   if ((err = mp_add(&ap[1], &ap[3], &ta)) != MP_OKAY)            goto LBL_ERR;
+   if ((err = mp_add(&bp[0], &bp[2], &sb)) != MP_OKAY)            goto LBL_ERR;
+   /** w1 = (sa + ta) * (sb + b1); */
+   if ((err = mp_add(&sa, &ta, &w[5])) != MP_OKAY)                goto LBL_ERR;
+   if ((err = mp_add(&sb, &bp[1], &w[6])) != MP_OKAY)             goto LBL_ERR;
+   if ((err = mp_mul(&w[5], &w[6], &w[1])) != MP_OKAY)            goto LBL_ERR;
+   /** w2 = (sa - ta) * (sb - b1); */
+   if ((err = mp_sub(&sa, &ta, &w[5])) != MP_OKAY)                goto LBL_ERR;
+   if ((err = mp_sub(&sb, &bp[1], &w[6])) != MP_OKAY)             goto LBL_ERR;
+   if ((err = mp_mul(&w[5], &w[6], &w[2])) != MP_OKAY)            goto LBL_ERR;
+
+   /** \\ w3 = a(2)*b(2), w4 = a(-2)*b(-2) */
+   /** sa = a0 + 4*a2 + 16*a4; ta = 2*a1 + 8*a3; */
+   if ((err = mp_mul_2d(&ap[4], 2, &sa)) != MP_OKAY)              goto LBL_ERR;
+   if ((err = mp_add(&sa, &ap[2], &sa)) != MP_OKAY)               goto LBL_ERR;
+   if ((err = mp_mul_2d(&sa, 2, &sa)) != MP_OKAY)                 goto LBL_ERR;
+   if ((err = mp_add(&sa, &ap[0], &sa)) != MP_OKAY)               goto LBL_ERR;
+   if ((err = mp_mul_2d(&ap[3], 2, &ta)) != MP_OKAY)              goto LBL_ERR;
+   if ((err = mp_add(&ta, &ap[1], &ta)) != MP_OKAY)               goto LBL_ERR;
+   if ((err = mp_mul_2(&ta, &ta)) != MP_OKAY)                     goto LBL_ERR;
+   /** sb = b0 + 4*b2; tb = 2*b1; */
+   if ((err = mp_mul_2d(&bp[2], 2, &sb)) != MP_OKAY)              goto LBL_ERR;
+   if ((err = mp_add(&sb, &bp[0], &sb)) != MP_OKAY)               goto LBL_ERR;
+   if ((err = mp_mul_2(&bp[1], &tb)) != MP_OKAY)                  goto LBL_ERR;
+   /** w3 = (sa + ta) * (sb + tb); */
+   if ((err = mp_add(&sa, &ta, &w[5])) != MP_OKAY)                goto LBL_ERR;
+   if ((err = mp_add(&sb, &tb, &w[6])) != MP_OKAY)                goto LBL_ERR;
+   if ((err = mp_mul(&w[5], &w[6], &w[3])) != MP_OKAY)            goto LBL_ERR;
+   /** w4 = (sa - ta) * (sb - tb); */
+   if ((err = mp_sub(&sa, &ta, &w[5])) != MP_OKAY)                goto LBL_ERR;
+   if ((err = mp_sub(&sb, &tb, &w[6])) != MP_OKAY)                goto LBL_ERR;
+   if ((err = mp_mul(&w[5], &w[6], &w[4])) != MP_OKAY)            goto LBL_ERR;
+
+   /** \\ w5 = 2^6 * a(1/2)*b(1/2) */
+   /** sa = (((2*a0 + a1)*2 + a2)*2 + a3)*2 + a4; */
+   if ((err = mp_mul_2(&ap[0], &sa)) != MP_OKAY)                  goto LBL_ERR;
+   if ((err = mp_add(&sa, &ap[1], &sa)) != MP_OKAY)               goto LBL_ERR;
+   if ((err = mp_mul_2(&sa, &sa)) != MP_OKAY)                     goto LBL_ERR;
+   if ((err = mp_add(&sa, &ap[2], &sa)) != MP_OKAY)               goto LBL_ERR;
+   if ((err = mp_mul_2(&sa, &sa)) != MP_OKAY)                     goto LBL_ERR;
+   if ((err = mp_add(&sa, &ap[3], &sa)) != MP_OKAY)               goto LBL_ERR;
+   if ((err = mp_mul_2(&sa, &sa)) != MP_OKAY)                     goto LBL_ERR;
+   if ((err = mp_add(&sa, &ap[4], &sa)) != MP_OKAY)               goto LBL_ERR;
+   /** sb = (2*b0 + b1)*2 + b2; */
+   if ((err = mp_mul_2(&bp[0], &sb)) != MP_OKAY)                  goto LBL_ERR;
+   if ((err = mp_add(&sb, &bp[1], &sb)) != MP_OKAY)               goto LBL_ERR;
+   if ((err = mp_mul_2(&sb, &sb)) != MP_OKAY)                     goto LBL_ERR;
+   if ((err = mp_add(&sb, &bp[2], &sb)) != MP_OKAY)               goto LBL_ERR;
+   /** w5 = sa * sb; */
+   if ((err = mp_mul(&sa, &sb, &w[5])) != MP_OKAY)                goto LBL_ERR;
+
+   /** w0 = a0 * b0; w6 = a4 * b2; */
+   if ((err = mp_mul(&ap[0], &bp[0], &w[0])) != MP_OKAY)          goto LBL_ERR;
+   if ((err = mp_mul(&ap[4], &bp[2], &w[6])) != MP_OKAY)          goto LBL_ERR;
+
+   err = s_mp_toom4_interpolate(w, B, c);
+
+LBL_ERR:
+   mp_clear_multi(&sa, &ta, &sb, &tb, NULL);
+LBL_ERRt:
+   mp_clear_multi(&w[0], &w[1], &w[2], &w[3], &w[4], &w[5], &w[6], NULL);
+LBL_ERRw:
+   mp_clear_multi(&ap[0], &ap[1], &ap[2], &ap[3], &ap[4], &bp[0], &bp[1], &bp[2], NULL);
+   return err;
+}
+
+#endif
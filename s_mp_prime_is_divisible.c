@@ -7,22 +7,28 @@
  * of the first PRIME_SIZE primes or not
  *
  * sets result to 0 if not, 1 if yes
+ *
+ * The residues are computed in one pass over a for a chunk of the primes
+ * each, the first chunk rejects most candidates already.
  */
 mp_err s_mp_prime_is_divisible(const mp_int *a, bool *result)
 {
-   int i;
-   for (i = 0; i < MP_PRIME_TAB_SIZE; i++) {
+   int i, j;
+   for (i = 0; i < MP_PRIME_TAB_SIZE; i += 32) {
       /* what is a mod LBL_prime_tab[i] */
       mp_err err;
-      mp_digit res;
-      if ((err = mp_mod_d(a, s_mp_prime_tab[i], &res)) != MP_OKAY) {
+      mp_digit res[32];
+      int n = MP_MIN(32, MP_PRIME_TAB_SIZE - i);
+      if ((err = s_mp_mod_d_multi(a, s_mp_prime_tab + i, n, res)) != MP_OKAY) {
          return err;
       }
 
-      /* is the residue zero? */
-      if (res == 0u) {
-         *result = true;
-         return MP_OKAY;
+      /* is a residue zero? */
+      for (j = 0; j < n; j++) {
+         if (res[j] == 0u) {
+            *result = true;
+            return MP_OKAY;
+         }
       }
    }
 
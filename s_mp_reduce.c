@@ -0,0 +1,89 @@
+#include "tommath_private.h"
+#ifdef S_MP_REDUCE_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+
+/* reduces x mod m, assumes 0 < x < m**2, mu is
+ * precomputed via mp_reduce_setup.
+ * From HAC pp.604 Algorithm 14.42
+ *
+ * The temporaries q and t come from the caller and keep their digits for
+ * the next reduction, see mp_reduce().  The products go from one to the
+ * other, none is computed in place.
+ */
+mp_err s_mp_reduce(mp_int *x, const mp_int *m, const mp_int *mu, mp_int *q, mp_int *t)
+{
+   mp_err  err;
+   int     um = m->used;
+
+   /* q = x */
+   if ((err = mp_copy(x, q)) != MP_OKAY) {
+      return err;
+   }
+
+   /* q1 = x / b**(k-1)  */
+   mp_rshd(q, um - 1);
+
+   /* t = q3 = q2 / b**(k+1), the exact short product for large moduli */
+   if (MP_HAS(MP_MUL_HIGH) && (um >= MP_REDUCE_MUL_CUTOFF)) {
+      if ((err = mp_mul_high(q, mu, um + 1, t)) != MP_OKAY) {
+         return err;
+      }
+   } else {
+      /* according to HAC this optimization is ok: leaving out the columns
+       * below k - 1 takes less than one off q3, below k it could be k
+       */
+      if ((mp_digit)um > ((mp_digit)1 << (MP_DIGIT_BIT - 1))) {
+         if ((err = mp_mul(q, mu, t)) != MP_OKAY) {
+            return err;
+         }
+      } else if (MP_HAS(S_MP_MUL_HIGH)) {
+         if ((err = s_mp_mul_high(q, mu, t, um - 1)) != MP_OKAY) {
+            return err;
+         }
+      } else if (MP_HAS(S_MP_MUL_HIGH_COMBA)) {
+         if ((err = s_mp_mul_high_comba(q, mu, t, um - 1)) != MP_OKAY) {
+            return err;
+         }
+      } else {
+         return MP_VAL;
+      }
+      mp_rshd(t, um + 1);
+   }
+
+   /* x = x mod b**(k+1), quick (no division) */
+   if ((err = mp_mod_2d(x, MP_DIGIT_BIT * (um + 1), x)) != MP_OKAY) {
+      return err;
+   }
+
+   /* q = q * m mod b**(k+1), quick (no division) */
+   if ((err = mp_mul_low(t, m, um + 1, q)) != MP_OKAY) {
+      return err;
+   }
+
+   /* x = x - q */
+   if ((err = mp_sub(x, q, x)) != MP_OKAY) {
+      return err;
+   }
+
+   /* If x < 0, add b**(k+1) to it */
+   if (mp_cmp_d(x, 0uL) == MP_LT) {
+      mp_set(q, 1uL);
+      if ((err = mp_lshd(q, um + 1)) != MP_OKAY) {
+         return err;
+      }
+      if ((err = mp_add(x, q, x)) != MP_OKAY) {
+         return err;
+      }
+   }
+
+   /* Back off if it's too big */
+   while (mp_cmp(x, m) != MP_LT) {
+      if ((err = s_mp_sub(x, m, x)) != MP_OKAY) {
+         return err;
+      }
+   }
+
+   return MP_OKAY;
+}
+#endif
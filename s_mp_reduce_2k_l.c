@@ -0,0 +1,45 @@
+#include "tommath_private.h"
+#ifdef S_MP_REDUCE_2K_L_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+
+/* reduces a modulo n where n is of the form 2**p - d
+   This differs from reduce_2k since "d" can be larger
+   than a single digit.  The temporaries q and t are the caller's.
+*/
+mp_err s_mp_reduce_2k_l(mp_int *a, const mp_int *n, const mp_int *d, mp_int *q, mp_int *t)
+{
+   mp_err err;
+   int    p;
+
+   p = mp_count_bits(n);
+
+   for (;;) {
+      /* q = a/2**p, a = a mod 2**p */
+      if ((err = mp_div_2d(a, p, q, a)) != MP_OKAY) {
+         return err;
+      }
+
+      /* t = q * d */
+      if ((err = mp_mul(q, d, t)) != MP_OKAY) {
+         return err;
+      }
+
+      /* a = a + t */
+      if ((err = s_mp_add(a, t, a)) != MP_OKAY) {
+         return err;
+      }
+
+      if (mp_cmp_mag(a, n) == MP_LT) {
+         break;
+      }
+      if ((err = s_mp_sub(a, n, a)) != MP_OKAY) {
+         return err;
+      }
+
+   }
+
+   return MP_OKAY;
+}
+
+#endif
@@ -0,0 +1,14 @@
+#include "tommath_private.h"
+#ifdef S_MP_SCRATCH_CLEAR_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+
+/* free the scratch space, the carved ints are gone with it */
+void s_mp_scratch_clear(mp_scratch *s)
+{
+   MP_FREE_DIGS(s->dp, MP_MAX(s->alloc, 1));
+   s->dp = NULL;
+   s->used = s->alloc = 0;
+   mp_clear(&s->t);
+}
+#endif
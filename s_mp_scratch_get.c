@@ -0,0 +1,28 @@
+#include "tommath_private.h"
+#ifdef S_MP_SCRATCH_GET_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+
+/* carve a zero of size digits out of the scratch space
+ *
+ * The size must cover everything the int will ever hold, it can not grow.
+ */
+mp_err s_mp_scratch_get(mp_scratch *s, mp_int *a, int size)
+{
+   size = MP_MAX(MP_MIN_DIGIT_COUNT, size);
+
+   /* not reached, s_mp_mul_scratch() does not go down without the room */
+   if (size > (s->alloc - s->used)) {
+      return MP_BUF;
+   }
+
+   a->dp = s->dp + s->used;
+   a->used = 0;
+   a->alloc = size;
+   a->sign = MP_ZPOS;
+   s_mp_zero_digs(a->dp, size);
+   s->used += size;
+
+   return MP_OKAY;
+}
+#endif
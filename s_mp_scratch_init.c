@@ -0,0 +1,30 @@
+#include "tommath_private.h"
+#ifdef S_MP_SCRATCH_INIT_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+
+/* one allocation of size digits for the temporaries, see s_mp_scratch_size() */
+mp_err s_mp_scratch_init(mp_scratch *s, int size)
+{
+   if (size < 0) {
+      return MP_VAL;
+   }
+   if (size > MP_MAX_DIGIT_COUNT) {
+      return MP_OVF;
+   }
+
+   s->dp = (mp_digit *) MP_MALLOC(sizeof(mp_digit) * (size_t)MP_MAX(size, 1));
+   if (s->dp == NULL) {
+      return MP_MEM;
+   }
+   s->used = 0;
+   s->alloc = size;
+
+   /* the int for the other products is allocated when it is needed */
+   s->t.dp = NULL;
+   s->t.used = s->t.alloc = 0;
+   s->t.sign = MP_ZPOS;
+
+   return MP_OKAY;
+}
+#endif
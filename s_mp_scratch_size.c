@@ -0,0 +1,38 @@
+#include "tommath_private.h"
+#ifdef S_MP_SCRATCH_SIZE_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+
+/* number of scratch digits for Karatsuba or Toom-Cook 3-way of an na x nb product
+ *
+ * A level with operands of at most n digits carves at most nine temporaries,
+ * six of them of 2n+3 digits (Toom-Cook) or four of them (Karatsuba), less
+ * than 14n + 18 digits.  The levels below are only done in the scratch space if
+ * they are balanced, that is 4*max < 5*min, so their operands have at most
+ * n - min/2 + 1 digits.  A level of at most that size needs no more than the
+ * rest of the sum, s_mp_mul_scratch() checks it before it goes down.  Only
+ * with the smallest cutoffs the operands may not shrink, the sum stops there
+ * and the levels below get their own scratch space.
+ */
+int s_mp_scratch_size(int na, int nb)
+{
+   int n = MP_MAX(na, nb), min = MP_MIN(na, nb), size = 0,
+       cutoff = MP_MIN(MP_MUL_KARATSUBA_CUTOFF, MP_SQR_KARATSUBA_CUTOFF);
+
+   /* does not fit anyway, let s_mp_scratch_init() fail */
+   if (n > (MP_MAX_DIGIT_COUNT / 40)) {
+      return INT_MAX;
+   }
+
+   for (;;) {
+      int sub = (n - (min / 2)) + 1;
+      size += (14 * n) + 18 + (9 * MP_MIN_DIGIT_COUNT);
+      if ((sub < cutoff) || (sub >= n)) {
+         break;
+      }
+      n = sub;
+      min = (4 * n) / 5;
+   }
+   return size;
+}
+#endif
@@ -0,0 +1,49 @@
+#include "tommath_private.h"
+#ifdef S_MP_SOLINAS_FIND_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+
+/* determines if p is one of the moduli in s_mp_solinas_tab, form is its index
+ *
+ * Only the moduli of the same size are compared, word by word from the bottom
+ * and with the words of 2**bits - d computed on the way.
+ */
+bool s_mp_solinas_find(const mp_int *p, int *form)
+{
+   uint32_t w[MP_SOLINAS_MAX_WORDS];
+   int bits, ix, t, n;
+
+   if (mp_isneg(p)) {
+      return false;
+   }
+
+   bits = mp_count_bits(p);
+   n = (bits + 31) / 32;
+   for (ix = 0; ix < MP_SOLINAS_TAB_SIZE; ix++) {
+      const mp_solinas *s = &s_mp_solinas_tab[ix];
+      int64_t acc = 0;
+
+      if (s->bits != bits) {
+         continue;
+      }
+
+      s_mp_to_words(p, w, n);
+      for (t = 0; t < n; t++) {
+         acc -= (t < MP_SOLINAS_D_WORDS) ? s->d[t] : 0;
+         if (t == (bits / 32)) {
+            acc += (int64_t)1 << (bits % 32);
+         }
+         if (w[t] != (uint32_t)((uint64_t)acc & 0xFFFFFFFFu)) {
+            break;
+         }
+         acc = (acc - (int64_t)w[t]) / ((int64_t)1 << 32);
+      }
+
+      if (t == n) {
+         *form = ix;
+         return true;
+      }
+   }
+   return false;
+}
+#endif
@@ -0,0 +1,113 @@
+#include "tommath_private.h"
+#ifdef S_MP_SOLINAS_MUL_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+
+/* c = a * b mod p for the modulus p = 2**bits - d of s_mp_solinas_tab[form]
+ *
+ * The numbers are the n = bits/32 (rounded up) words of 32 bits of a, b < p,
+ * c is the same.  The columns of the product sum the low and the high halves
+ * of their products separately, in 64 bits.  Then, with 2**(32 n) = d * 2**s
+ * (mod p) for s = 32 n - bits, every word x[j], j >= n, of the product goes
+ * down into the words x[j - n + i] as x[j] * d[i] * 2**s, top word first.
+ * Like this the whole product is folded in a single pass of signed additions
+ * without any further multiplication of words.  See J. Solinas, "Generalized
+ * Mersenne Numbers", 1999.  What remains above 2**bits is folded again until
+ * the result is below 2**bits, then p is subtracted at most once.
+ */
+void s_mp_solinas_mul(const uint32_t *a, const uint32_t *b, uint32_t *c, int form)
+{
+   const mp_solinas *s = &s_mp_solinas_tab[form];
+   int64_t w[(2 * MP_SOLINAS_MAX_WORDS) + 1], d[MP_SOLINAS_D_WORDS], hi;
+   int e[MP_SOLINAS_D_WORDS], n = (s->bits + 31) / 32, shift = (32 * n) - s->bits,
+       m = 2 * n, nd, ix, t;
+
+   /* the nonzero coefficients of d */
+   for (ix = nd = 0; ix < MP_MIN(n, MP_SOLINAS_D_WORDS); ix++) {
+      if (s->d[ix] != 0) {
+         e[nd] = ix;
+         d[nd++] = s->d[ix];
+      }
+   }
+
+   /* the columns of a * b, every one of them is below 2n * 2**32 */
+   w[0] = 0;
+   for (t = 0; t < (m - 1); t++) {
+      uint64_t lo = 0u, up = 0u, pr;
+      ix = MP_MAX(0, (t - n) + 1);
+      if (a == b) {
+         for (; ix < (t - ix); ix++) {
+            pr = (uint64_t)a[ix] * a[t - ix];
+            lo += (pr & 0xFFFFFFFFu) << 1;
+            up += (pr >> 32) << 1;
+         }
+         if (ix == (t - ix)) {
+            pr = (uint64_t)a[ix] * a[ix];
+            lo += pr & 0xFFFFFFFFu;
+            up += pr >> 32;
+         }
+      } else {
+         for (; ix <= MP_MIN(t, n - 1); ix++) {
+            pr = (uint64_t)a[ix] * b[t - ix];
+            lo += pr & 0xFFFFFFFFu;
+            up += pr >> 32;
+         }
+      }
+      w[t] += (int64_t)lo;
+      w[t + 1] = (int64_t)up;
+   }
+
+   for (;;) {
+      /* fold the upper words */
+      for (t = m - 1; t >= n; t--) {
+         int64_t x = w[t] * ((int64_t)1 << shift);
+         w[t] = 0;
+         for (ix = 0; ix < nd; ix++) {
+            w[(t - n) + e[ix]] += x * d[ix];
+         }
+      }
+
+      /* propagate the signed carries, the one out of the top word is folded again */
+      for (t = 0; t < n; t++) {
+         int64_t low = (int64_t)((uint64_t)w[t] & 0xFFFFFFFFu);
+         w[t + 1] += (w[t] - low) / ((int64_t)1 << 32);
+         w[t] = low;
+      }
+      if (w[n] != 0) {
+         m = n + 1;
+         continue;
+      }
+
+      /* and the bits above 2**bits, 2**bits = d (mod p) */
+      hi = (shift == 0) ? 0 : (w[n - 1] >> (32 - shift));
+      if (hi == 0) {
+         break;
+      }
+      w[n - 1] &= ((int64_t)1 << (32 - shift)) - 1;
+      for (ix = 0; ix < nd; ix++) {
+         w[e[ix]] += hi * d[ix];
+      }
+      m = n;
+   }
+
+   /* w < 2**bits, w - p = w + d - 2**bits is the result if it is not negative */
+   hi = 0;
+   for (t = 0, ix = 0; t < n; t++) {
+      int64_t u = w[t] + hi;
+      if ((ix < nd) && (e[ix] == t)) {
+         u += d[ix++];
+      }
+      c[t] = (uint32_t)((uint64_t)u & 0xFFFFFFFFu);
+      hi = (u - (int64_t)c[t]) / ((int64_t)1 << 32);
+   }
+   if (shift != 0) {
+      hi = (int64_t)(c[n - 1] >> (32 - shift));
+      c[n - 1] &= (uint32_t)(((uint64_t)1 << (32 - shift)) - 1u);
+   }
+   if (hi == 0) {
+      for (t = 0; t < n; t++) {
+         c[t] = (uint32_t)w[t];
+      }
+   }
+}
+#endif
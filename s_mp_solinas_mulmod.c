@@ -0,0 +1,40 @@
+#include "tommath_private.h"
+#ifdef S_MP_SOLINAS_MULMOD_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+
+/* c = a * b (mod p) for the modulus p of s_mp_solinas_tab[form], see s_mp_solinas_mul()
+ *
+ * Only inputs that are negative or longer than p need a division first.
+ */
+mp_err s_mp_solinas_mulmod(const mp_int *a, const mp_int *b, const mp_int *p, mp_int *c, int form)
+{
+   uint32_t A[MP_SOLINAS_MAX_WORDS], B[MP_SOLINAS_MAX_WORDS];
+   int n = (s_mp_solinas_tab[form].bits + 31) / 32;
+   mp_err err;
+
+   if (mp_isneg(a) || (mp_cmp_mag(a, p) != MP_LT) || mp_isneg(b) || (mp_cmp_mag(b, p) != MP_LT)) {
+      mp_int ta, tb;
+      if ((err = mp_init_multi(&ta, &tb, NULL)) != MP_OKAY) {
+         return err;
+      }
+      if ((err = mp_mod(a, p, &ta)) != MP_OKAY) {
+         goto LBL_ERR;
+      }
+      if ((err = mp_mod(b, p, &tb)) != MP_OKAY) {
+         goto LBL_ERR;
+      }
+      err = s_mp_solinas_mulmod(&ta, (a == b) ? &ta : &tb, p, c, form);
+LBL_ERR:
+      mp_clear_multi(&ta, &tb, NULL);
+      return err;
+   }
+
+   s_mp_to_words(a, A, n);
+   if (a != b) {
+      s_mp_to_words(b, B, n);
+   }
+   s_mp_solinas_mul(A, (a == b) ? A : B, A, form);
+   return s_mp_from_words(A, n, c);
+}
+#endif
@@ -0,0 +1,30 @@
+#include "tommath_private.h"
+#ifdef S_MP_SOLINAS_TAB_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+
+/* The generalized Mersenne moduli p = 2**bits - sum(d[i] * 2**(32 * i)) that
+ * s_mp_solinas_mul() folds with word shifts and additions, ordered by size.
+ * The coefficients must keep the folds within 64 bits, times 2**(32 n - bits)
+ * if bits is not a multiple of 32.  At most MP_SOLINAS_MAX_WORDS words.
+ */
+const mp_solinas s_mp_solinas_tab[] = {
+   /* NIST P-192 = 2**192 - 2**64 - 1 */
+   { 192, {   1,   0,   1,   0,   0,   0,   0,   0 } },
+   /* NIST P-224 = 2**224 - 2**96 + 1 */
+   { 224, {  -1,   0,   0,   1,   0,   0,   0,   0 } },
+   /* Curve25519 = 2**255 - 19 */
+   { 255, {  19,   0,   0,   0,   0,   0,   0,   0 } },
+   /* NIST P-256 = 2**256 - 2**224 + 2**192 + 2**96 - 1 */
+   { 256, {   1,   0,   0,  -1,   0,   0,  -1,   1 } },
+   /* secp256k1 = 2**256 - 2**32 - 977 */
+   { 256, { 977,   1,   0,   0,   0,   0,   0,   0 } },
+   /* NIST P-384 = 2**384 - 2**128 - 2**96 + 2**32 - 1 */
+   { 384, {   1,  -1,   0,   1,   1,   0,   0,   0 } },
+   /* Goldilocks = 2**448 - 2**224 - 1 */
+   { 448, {   1,   0,   0,   0,   0,   0,   0,   1 } },
+   /* NIST P-521 = 2**521 - 1 */
+   { 521, {   1,   0,   0,   0,   0,   0,   0,   0 } }
+};
+
+#endif
@@ -3,11 +3,17 @@
 /* LibTomMath, multiple-precision integer library -- Tom St Denis */
 /* SPDX-License-Identifier: Unlicense */
 
-/* low level squaring, b = a*a, HAC pp.596-597, Algorithm 14.16 */
+/* low level squaring, b = a*a, HAC pp.596-597, Algorithm 14.16
+ *
+ * The doubled cross products a[i]*a[j] can be one bit larger than a
+ * mp_word if the digits have no nail bits, so they are summed first,
+ * doubled by a shift and the squares a[i]*a[i] are added last.
+ */
 mp_err s_mp_sqr(const mp_int *a, mp_int *b)
 {
    mp_int   t;
    int      ix, pa;
+   mp_digit u;
    mp_err   err;
 
    pa = a->used;
@@ -18,30 +24,15 @@ mp_err s_mp_sqr(const mp_int *a, mp_int *b)
    /* default used is maximum possible size */
    t.used = (2 * pa) + 1;
 
+   /* sum of the cross products a[ix]*a[iy] with ix < iy */
    for (ix = 0; ix < pa; ix++) {
-      mp_digit u;
       int iy;
 
-      /* first calculate the digit at 2*ix */
-      /* calculate double precision result */
-      mp_word r = (mp_word)t.dp[2*ix] +
-                  ((mp_word)a->dp[ix] * (mp_word)a->dp[ix]);
-
-      /* store lower part in result */
-      t.dp[ix+ix] = (mp_digit)(r & (mp_word)MP_MASK);
-
-      /* get the carry */
-      u           = (mp_digit)(r >> (mp_word)MP_DIGIT_BIT);
-
+      u = 0;
       for (iy = ix + 1; iy < pa; iy++) {
-         /* first calculate the product */
-         r       = (mp_word)a->dp[ix] * (mp_word)a->dp[iy];
-
-         /* now calculate the double precision result, note we use
-          * addition instead of *2 since it's easier to optimize.
-          */
-         /* Some architectures and/or compilers seem to prefer a bit-shift nowadays */
-         r       = (mp_word)t.dp[ix + iy] + (r<<1) + (mp_word)u;
+         /* calculate double precision result */
+         mp_word r = (mp_word)t.dp[ix + iy] +
+                     ((mp_word)a->dp[ix] * (mp_word)a->dp[iy]) + (mp_word)u;
 
          /* store lower part */
          t.dp[ix + iy] = (mp_digit)(r & (mp_word)MP_MASK);
@@ -49,25 +40,27 @@ mp_err s_mp_sqr(const mp_int *a, mp_int *b)
          /* get carry */
          u       = (mp_digit)(r >> (mp_word)MP_DIGIT_BIT);
       }
-      /* propagate upwards */
-      while (u != 0uL) {
-         mp_digit tmp;
-         /*
-            "u" can get bigger than MP_DIGIT_MAX and would need a bigger type
-            for the sum (mp_word). That is costly if mp_word is not a native
-            integer but a bigint from the compiler library. We do a manual
-            multiword addition instead.
-          */
-         /* t.dp[ix + iy] has been masked off by MP_MASK and is hence of the correct size
-            and we can just add the lower part of "u". Carry is guaranteed to fit into
-            the type used for mp_digit, too, so we can extract it later. */
-         tmp = t.dp[ix + iy] + (u & MP_MASK);
-         /* t.dp[ix + iy] is set to the result minus the carry, carry is still in "tmp" */
-         t.dp[ix + iy] = tmp & MP_MASK;
-         /* Add high part of "u" and the carry from "tmp" to get the next "u" */
-         u = (u >> MP_DIGIT_BIT) + (tmp >> MP_DIGIT_BIT);
-         ++iy;
-      }
+      /* the digit above the row has not been touched yet */
+      t.dp[ix + pa] = u;
+   }
+
+   /* double it */
+   u = 0;
+   for (ix = 0; ix < (2 * pa); ix++) {
+      mp_digit rr = t.dp[ix] >> (mp_digit)(MP_DIGIT_BIT - 1);
+      t.dp[ix] = ((t.dp[ix] << 1) | u) & MP_MASK;
+      u = rr;
+   }
+
+   /* add the squares a[ix]*a[ix] at 2*ix */
+   u = 0;
+   for (ix = 0; ix < pa; ix++) {
+      mp_word r = (mp_word)t.dp[2 * ix] +
+                  ((mp_word)a->dp[ix] * (mp_word)a->dp[ix]) + (mp_word)u;
+      t.dp[2 * ix] = (mp_digit)(r & (mp_word)MP_MASK);
+      r = (r >> (mp_word)MP_DIGIT_BIT) + (mp_word)t.dp[(2 * ix) + 1];
+      t.dp[(2 * ix) + 1] = (mp_digit)(r & (mp_word)MP_MASK);
+      u = (mp_digit)(r >> (mp_word)MP_DIGIT_BIT);
    }
 
    mp_clamp(&t);
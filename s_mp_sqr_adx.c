@@ -0,0 +1,67 @@
+#include "tommath_private.h"
+#ifdef S_MP_SQR_ADX_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+
+/* low level squaring, b = a*a
+ *
+ * Same as s_mp_sqr but the rows of cross products are computed by
+ * s_mp_addmul_adx.  They go straight into b unless it is also the source.
+ */
+mp_err s_mp_sqr_adx(const mp_int *a, mp_int *b)
+{
+   mp_int   t, *d;
+   int      ix, pa;
+   mp_digit u;
+   mp_err   err;
+
+   pa = a->used;
+   if (b != a) {
+      if ((err = mp_grow(b, (2 * pa) + 1)) != MP_OKAY) {
+         return err;
+      }
+      s_mp_zero_digs(b->dp, MP_MAX(b->used, (2 * pa) + 1));
+      b->sign = MP_ZPOS;
+      d = b;
+   } else {
+      if ((err = mp_init_size(&t, (2 * pa) + 1)) != MP_OKAY) {
+         return err;
+      }
+      d = &t;
+   }
+
+   /* default used is maximum possible size */
+   d->used = (2 * pa) + 1;
+
+   /* sum of the cross products a[ix]*a[iy] with ix < iy */
+   for (ix = 0; ix < (pa - 1); ix++) {
+      d->dp[ix + pa] = s_mp_addmul_adx(d->dp + (2 * ix) + 1, a->dp + ix + 1, pa - ix - 1, a->dp[ix]);
+   }
+
+   /* double it */
+   u = 0;
+   for (ix = 0; ix < (2 * pa); ix++) {
+      mp_digit rr = d->dp[ix] >> (mp_digit)(MP_DIGIT_BIT - 1);
+      d->dp[ix] = ((d->dp[ix] << 1) | u) & MP_MASK;
+      u = rr;
+   }
+
+   /* add the squares a[ix]*a[ix] at 2*ix */
+   u = 0;
+   for (ix = 0; ix < pa; ix++) {
+      mp_word r = (mp_word)d->dp[2 * ix] +
+                  ((mp_word)a->dp[ix] * (mp_word)a->dp[ix]) + (mp_word)u;
+      d->dp[2 * ix] = (mp_digit)(r & (mp_word)MP_MASK);
+      r = (r >> (mp_word)MP_DIGIT_BIT) + (mp_word)d->dp[(2 * ix) + 1];
+      d->dp[(2 * ix) + 1] = (mp_digit)(r & (mp_word)MP_MASK);
+      u = (mp_digit)(r >> (mp_word)MP_DIGIT_BIT);
+   }
+
+   mp_clamp(d);
+   if (d == &t) {
+      mp_exch(&t, b);
+      mp_clear(&t);
+   }
+   return MP_OKAY;
+}
+#endif
@@ -11,12 +11,15 @@
  * you add in the inner loop
 
 After that loop you do the squares and add them in.
+
+The digits go straight into b unless it is also the source, see
+s_mp_mul_comba().
 */
 
 mp_err s_mp_sqr_comba(const mp_int *a, mp_int *b)
 {
    int       oldused, pa, ix;
-   mp_digit  W[MP_WARRAY];
+   mp_digit  buf[MP_COMBA_STACK], *W, C1;
    mp_word   W1;
    mp_err err;
 
@@ -26,14 +29,25 @@ mp_err s_mp_sqr_comba(const mp_int *a, mp_int *b)
       return err;
    }
 
+   if (b != a) {
+      W = b->dp;
+   } else if (pa <= MP_COMBA_STACK) {
+      W = buf;
+   } else if ((W = (mp_digit *) MP_MALLOC(sizeof(mp_digit) * (size_t)pa)) == NULL) {
+      return MP_MEM;
+   }
+
    /* number of output digits to produce */
    W1 = 0;
+   C1 = 0;
    for (ix = 0; ix < pa; ix++) {
       int      tx, ty, iy, iz;
       mp_word  _W;
+      mp_digit _C;
 
       /* clear counter */
       _W = 0;
+      _C = 0;
 
       /* get offsets into the two bignums */
       ty = MP_MIN(a->used-1, ix);
@@ -51,31 +65,45 @@ mp_err s_mp_sqr_comba(const mp_int *a, mp_int *b)
       iy = MP_MIN(iy, ((ty-tx)+1)>>1);
 
       /* execute loop */
-      for (iz = 0; iz < iy; iz++) {
-         _W += (mp_word)a->dp[tx + iz] * (mp_word)a->dp[ty - iz];
+      if (iy <= MP_COMBA_BLOCK) {
+         for (iz = 0; iz < iy; iz++) {
+            MP_COMBA_ADD(_W, _C, (mp_word)a->dp[tx + iz] * (mp_word)a->dp[ty - iz]);
+         }
+      } else {
+         mp_digit hi;
+         MP_COMBA_ADD(_W, _C, s_mp_comba_column(a->dp + tx, a->dp + ty, iy, &hi));
+         _C += hi;
+         MP_COMBA_FOLD(_W, _C);
       }
 
       /* double the inner product and add carry */
-      _W = _W + _W + W1;
+      MP_COMBA_DBL(_W, _C);
+      MP_COMBA_ADD(_W, _C, W1);
+      _C += C1;
 
       /* even columns have the square term in them */
       if (((unsigned)ix & 1u) == 0u) {
-         _W += (mp_word)a->dp[ix>>1] * (mp_word)a->dp[ix>>1];
+         MP_COMBA_ADD(_W, _C, (mp_word)a->dp[ix>>1] * (mp_word)a->dp[ix>>1]);
       }
 
       /* store it */
       W[ix] = (mp_digit)_W & MP_MASK;
 
       /* make next carry */
-      W1 = _W >> (mp_word)MP_DIGIT_BIT;
+      MP_COMBA_SHIFT(_W, _C);
+      W1 = _W;
+      C1 = _C;
    }
 
    /* setup dest */
    oldused  = b->used;
    b->used = a->used+a->used;
 
-   for (ix = 0; ix < pa; ix++) {
-      b->dp[ix] = W[ix] & MP_MASK;
+   if (W != b->dp) {
+      s_mp_copy_digs(b->dp, W, pa);
+      if (W != buf) {
+         MP_FREE_BUF(W, sizeof(mp_digit) * (size_t)pa);
+      }
    }
 
    /* clear unused digits [that existed in the old copy of c] */
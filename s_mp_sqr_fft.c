@@ -0,0 +1,15 @@
+#include "tommath_private.h"
+#ifdef S_MP_SQR_FFT_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+
+/* squaring using a number theoretic transform
+ *
+ * s_mp_mul_fft recognizes identical operands and saves
+ * one of the two forward transforms per prime.
+ */
+mp_err s_mp_sqr_fft(const mp_int *a, mp_int *b)
+{
+   return s_mp_mul_fft(a, a, b);
+}
+#endif
@@ -10,33 +10,46 @@
  * is essentially the same algorithm but merely
  * tuned to perform recursive squarings.
  */
-mp_err s_mp_sqr_karatsuba(const mp_int *a, mp_int *b)
+mp_err s_mp_sqr_karatsuba(const mp_int *a, mp_int *b, mp_scratch *s)
 {
    mp_int  x0, x1, t1, t2, x0x0, x1x1;
-   int B;
+   int B, P, mark;
    mp_err  err;
 
+   /* the top level allocates the scratch space for all of them */
+   if (s == NULL) {
+      mp_scratch own;
+      if ((err = s_mp_scratch_init(&own, s_mp_scratch_size(a->used, a->used))) != MP_OKAY) {
+         return err;
+      }
+      err = s_mp_sqr_karatsuba(a, b, &own);
+      s_mp_scratch_clear(&own);
+      return err;
+   }
+   mark = s->used;
+
    /* min # of digits */
    B = a->used;
 
    /* now divide in two */
    B = B >> 1;
 
-   /* init copy all the temps */
-   if ((err = mp_init_size(&x0, B)) != MP_OKAY)
-      goto LBL_ERR;
-   if ((err = mp_init_size(&x1, a->used - B)) != MP_OKAY)
-      goto X0;
+   /* room for a square and the carries of the sums */
+   P = (a->used * 2) + 3;
 
-   /* init temps */
-   if ((err = mp_init_size(&t1, a->used * 2)) != MP_OKAY)
-      goto X1;
-   if ((err = mp_init_size(&t2, a->used * 2)) != MP_OKAY)
-      goto T1;
-   if ((err = mp_init_size(&x0x0, B * 2)) != MP_OKAY)
-      goto T2;
-   if ((err = mp_init_size(&x1x1, (a->used - B) * 2)) != MP_OKAY)
-      goto X0X0;
+   /* carve all the temps */
+   if ((err = s_mp_scratch_get(s, &x0, B)) != MP_OKAY)
+      goto LBL_ERR;
+   if ((err = s_mp_scratch_get(s, &x1, a->used - B)) != MP_OKAY)
+      goto LBL_ERR;
+   if ((err = s_mp_scratch_get(s, &t1, P)) != MP_OKAY)
+      goto LBL_ERR;
+   if ((err = s_mp_scratch_get(s, &t2, P)) != MP_OKAY)
+      goto LBL_ERR;
+   if ((err = s_mp_scratch_get(s, &x0x0, P)) != MP_OKAY)
+      goto LBL_ERR;
+   if ((err = s_mp_scratch_get(s, &x1x1, P)) != MP_OKAY)
+      goto LBL_ERR;
 
    /* now shift the digits */
    x0.used = B;
@@ -46,47 +59,37 @@ mp_err s_mp_sqr_karatsuba(const mp_int *a, mp_int *b)
    mp_clamp(&x0);
 
    /* now calc the products x0*x0 and x1*x1 */
-   if ((err = mp_sqr(&x0, &x0x0)) != MP_OKAY)
-      goto X1X1;           /* x0x0 = x0*x0 */
-   if ((err = mp_sqr(&x1, &x1x1)) != MP_OKAY)
-      goto X1X1;           /* x1x1 = x1*x1 */
+   if ((err = s_mp_mul_scratch(&x0, &x0, &x0x0, s)) != MP_OKAY)
+      goto LBL_ERR;        /* x0x0 = x0*x0 */
+   if ((err = s_mp_mul_scratch(&x1, &x1, &x1x1, s)) != MP_OKAY)
+      goto LBL_ERR;        /* x1x1 = x1*x1 */
 
    /* now calc (x1+x0)**2 */
    if ((err = s_mp_add(&x1, &x0, &t1)) != MP_OKAY)
-      goto X1X1;           /* t1 = x1 - x0 */
-   if ((err = mp_sqr(&t1, &t1)) != MP_OKAY)
-      goto X1X1;           /* t1 = (x1 - x0) * (x1 - x0) */
+      goto LBL_ERR;        /* t1 = x1 - x0 */
+   if ((err = s_mp_mul_scratch(&t1, &t1, &t2, s)) != MP_OKAY)
+      goto LBL_ERR;        /* t2 = (x1 + x0) * (x1 + x0), not in place */
 
    /* add x0y0 */
-   if ((err = s_mp_add(&x0x0, &x1x1, &t2)) != MP_OKAY)
-      goto X1X1;           /* t2 = x0x0 + x1x1 */
-   if ((err = s_mp_sub(&t1, &t2, &t1)) != MP_OKAY)
-      goto X1X1;           /* t1 = (x1+x0)**2 - (x0x0 + x1x1) */
+   if ((err = s_mp_add(&x0x0, &x1x1, &t1)) != MP_OKAY)
+      goto LBL_ERR;        /* t1 = x0x0 + x1x1 */
+   if ((err = s_mp_sub(&t2, &t1, &t1)) != MP_OKAY)
+      goto LBL_ERR;        /* t1 = (x1+x0)**2 - (x0x0 + x1x1) */
 
    /* shift by B */
    if ((err = mp_lshd(&t1, B)) != MP_OKAY)
-      goto X1X1;           /* t1 = (x0x0 + x1x1 - (x1-x0)*(x1-x0))<<B */
+      goto LBL_ERR;        /* t1 = (x0x0 + x1x1 - (x1-x0)*(x1-x0))<<B */
    if ((err = mp_lshd(&x1x1, B * 2)) != MP_OKAY)
-      goto X1X1;           /* x1x1 = x1x1 << 2*B */
+      goto LBL_ERR;        /* x1x1 = x1x1 << 2*B */
 
    if ((err = mp_add(&x0x0, &t1, &t1)) != MP_OKAY)
-      goto X1X1;           /* t1 = x0x0 + t1 */
+      goto LBL_ERR;        /* t1 = x0x0 + t1 */
    if ((err = mp_add(&t1, &x1x1, b)) != MP_OKAY)
-      goto X1X1;           /* t1 = x0x0 + t1 + x1x1 */
+      goto LBL_ERR;        /* t1 = x0x0 + t1 + x1x1 */
 
-X1X1:
-   mp_clear(&x1x1);
-X0X0:
-   mp_clear(&x0x0);
-T2:
-   mp_clear(&t2);
-T1:
-   mp_clear(&t1);
-X1:
-   mp_clear(&x1);
-X0:
-   mp_clear(&x0);
 LBL_ERR:
+   /* give the temps back */
+   s->used = mark;
    return err;
 }
 #endif
@@ -17,25 +17,42 @@
      Chung, Jaewook, and M. Anwar Hasan. "Asymmetric squaring formulae."
      18th IEEE Symposium on Computer Arithmetic (ARITH'07). IEEE, 2007.
 
+   The first sum goes to T1 instead of a0, so all five points are evaluated
+   first and the products may run in parallel, see s_mp_mul_parallel().
 */
-mp_err s_mp_sqr_toom(const mp_int *a, mp_int *b)
+mp_err s_mp_sqr_toom(const mp_int *a, mp_int *b, mp_scratch *s)
 {
-   mp_int S0, a0, a1, a2;
-   int B;
+   mp_int S0, T1, a0, a1, a2, *pc[5];
+   const mp_int *pa[5], *pb[5];
+   int B, P, mark;
    mp_err err;
 
-   /* init temps */
-   if ((err = mp_init(&S0)) != MP_OKAY) {
+   /* the top level allocates the scratch space for all of them */
+   if (s == NULL) {
+      mp_scratch own;
+      if ((err = s_mp_scratch_init(&own, s_mp_scratch_size(a->used, a->used))) != MP_OKAY) {
+         return err;
+      }
+      err = s_mp_sqr_toom(a, b, &own);
+      s_mp_scratch_clear(&own);
       return err;
    }
+   mark = s->used;
 
    /* B */
    B = a->used / 3;
 
+   /* room for a square and the carries of the sums */
+   P = (a->used * 2) + 3;
+
+   /* carve the temps, all but a0 take products later on */
+   if ((err = s_mp_scratch_get(s, &S0, P)) != MP_OKAY)            goto LBL_ERR;
+   if ((err = s_mp_scratch_get(s, &T1, P)) != MP_OKAY)            goto LBL_ERR;
+
    /** a = a2 * x^2 + a1 * x + a0; */
-   if ((err = mp_init_size(&a0, B)) != MP_OKAY)                   goto LBL_ERRa0;
-   if ((err = mp_init_size(&a1, B)) != MP_OKAY)                   goto LBL_ERRa1;
-   if ((err = mp_init_size(&a2, a->used - (2 * B))) != MP_OKAY)   goto LBL_ERRa2;
+   if ((err = s_mp_scratch_get(s, &a0, B)) != MP_OKAY)            goto LBL_ERR;
+   if ((err = s_mp_scratch_get(s, &a1, P)) != MP_OKAY)            goto LBL_ERR;
+   if ((err = s_mp_scratch_get(s, &a2, P)) != MP_OKAY)            goto LBL_ERR;
 
    a0.used = a1.used = B;
    a2.used = a->used - 2 * B;
@@ -46,54 +63,61 @@ mp_err s_mp_sqr_toom(const mp_int *a, mp_int *b)
    mp_clamp(&a1);
    mp_clamp(&a2);
 
-   /** S0 = a0^2;  */
-   if ((err = mp_sqr(&a0, &S0)) != MP_OKAY)                       goto LBL_ERR;
-
    /** \\S1 = (a2 + a1 + a0)^2 */
    /** \\S2 = (a2 - a1 + a0)^2  */
    /** \\S1 = a0 + a2; */
-   /** a0 = a0 + a2; */
-   if ((err = mp_add(&a0, &a2, &a0)) != MP_OKAY)                  goto LBL_ERR;
+   /** T1 = a0 + a2; */
+   if ((err = mp_add(&a0, &a2, &T1)) != MP_OKAY)                  goto LBL_ERR;
    /** \\S2 = S1 - a1; */
-   /** b = a0 - a1; */
-   if ((err = mp_sub(&a0, &a1, b)) != MP_OKAY)                    goto LBL_ERR;
+   /** b = T1 - a1; */
+   if ((err = mp_sub(&T1, &a1, b)) != MP_OKAY)                    goto LBL_ERR;
    /** \\S1 = S1 + a1; */
-   /** a0 = a0 + a1; */
-   if ((err = mp_add(&a0, &a1, &a0)) != MP_OKAY)                  goto LBL_ERR;
+   /** T1 = T1 + a1; */
+   if ((err = mp_add(&T1, &a1, &T1)) != MP_OKAY)                  goto LBL_ERR;
+
+   /* the five products are independent, compute them at once */
+   /** S0 = a0^2;  */
+   pa[0] = pb[0] = &a0;
+   pc[0] = &S0;
    /** \\S1 = S1^2;  */
-   /** a0 = a0^2; */
-   if ((err = mp_sqr(&a0, &a0)) != MP_OKAY)                       goto LBL_ERR;
+   /** T1 = T1^2; */
+   pa[1] = pb[1] = &T1;
+   pc[1] = &T1;
    /** \\S2 = S2^2;  */
    /** b = b^2; */
-   if ((err = mp_sqr(b, b)) != MP_OKAY)                           goto LBL_ERR;
-
+   pa[2] = pb[2] = b;
+   pc[2] = b;
    /** \\ S3 = 2 * a1 * a2  */
    /** \\S3 = a1 * a2;  */
    /** a1 = a1 * a2; */
-   if ((err = mp_mul(&a1, &a2, &a1)) != MP_OKAY)                  goto LBL_ERR;
+   pa[3] = &a1;
+   pb[3] = &a2;
+   pc[3] = &a1;
+   /** \\S4 = a2^2;  */
+   /** a2 = a2^2; */
+   pa[4] = pb[4] = &a2;
+   pc[4] = &a2;
+   if ((err = s_mp_mul_parallel(pa, pb, pc, 5, s)) != MP_OKAY)    goto LBL_ERR;
+
    /** \\S3 = S3 << 1;  */
    /** a1 = a1 << 1; */
    if ((err = mp_mul_2(&a1, &a1)) != MP_OKAY)                     goto LBL_ERR;
 
-   /** \\S4 = a2^2;  */
-   /** a2 = a2^2; */
-   if ((err = mp_sqr(&a2, &a2)) != MP_OKAY)                       goto LBL_ERR;
-
    /** \\ tmp = (S1 + S2)/2  */
    /** \\tmp = S1 + S2; */
-   /** b = a0 + b; */
-   if ((err = mp_add(&a0, b, b)) != MP_OKAY)                      goto LBL_ERR;
+   /** b = T1 + b; */
+   if ((err = mp_add(&T1, b, b)) != MP_OKAY)                      goto LBL_ERR;
    /** \\tmp = tmp >> 1; */
    /** b = b >> 1; */
    if ((err = mp_div_2(b, b)) != MP_OKAY)                         goto LBL_ERR;
 
    /** \\ S1 = S1 - tmp - S3  */
    /** \\S1 = S1 - tmp; */
-   /** a0 = a0 - b; */
-   if ((err = mp_sub(&a0, b, &a0)) != MP_OKAY)                    goto LBL_ERR;
+   /** T1 = T1 - b; */
+   if ((err = mp_sub(&T1, b, &T1)) != MP_OKAY)                    goto LBL_ERR;
    /** \\S1 = S1 - S3;  */
-   /** a0 = a0 - a1; */
-   if ((err = mp_sub(&a0, &a1, &a0)) != MP_OKAY)                  goto LBL_ERR;
+   /** T1 = T1 - a1; */
+   if ((err = mp_sub(&T1, &a1, &T1)) != MP_OKAY)                  goto LBL_ERR;
 
    /** \\S2 = tmp - S4 -S0  */
    /** \\S2 = tmp - S4;  */
@@ -105,28 +129,22 @@ mp_err s_mp_sqr_toom(const mp_int *a, mp_int *b)
 
 
    /** \\P = S4*x^4 + S3*x^3 + S2*x^2 + S1*x + S0; */
-   /** P = a2*x^4 + a1*x^3 + b*x^2 + a0*x + S0; */
+   /** P = a2*x^4 + a1*x^3 + b*x^2 + T1*x + S0; */
 
    if ((err = mp_lshd(&a2, 4 * B)) != MP_OKAY)                    goto LBL_ERR;
    if ((err = mp_lshd(&a1, 3 * B)) != MP_OKAY)                    goto LBL_ERR;
    if ((err = mp_lshd(b, 2 * B)) != MP_OKAY)                      goto LBL_ERR;
-   if ((err = mp_lshd(&a0, 1 * B)) != MP_OKAY)                    goto LBL_ERR;
+   if ((err = mp_lshd(&T1, 1 * B)) != MP_OKAY)                    goto LBL_ERR;
    if ((err = mp_add(&a2, &a1, &a2)) != MP_OKAY)                  goto LBL_ERR;
    if ((err = mp_add(&a2, b, b)) != MP_OKAY)                      goto LBL_ERR;
-   if ((err = mp_add(b, &a0, b)) != MP_OKAY)                      goto LBL_ERR;
+   if ((err = mp_add(b, &T1, b)) != MP_OKAY)                      goto LBL_ERR;
    if ((err = mp_add(b, &S0, b)) != MP_OKAY)                      goto LBL_ERR;
    /** a^2 - P  */
 
 
 LBL_ERR:
-   mp_clear(&a2);
-LBL_ERRa2:
-   mp_clear(&a1);
-LBL_ERRa1:
-   mp_clear(&a0);
-LBL_ERRa0:
-   mp_clear(&S0);
-
+   /* give the temps back */
+   s->used = mark;
    return err;
 }
 
@@ -0,0 +1,73 @@
+#include "tommath_private.h"
+#ifdef S_MP_SQR_TOOM4_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+
+/* squaring using the Toom-Cook 4-way algorithm
+ *
+ * Same evaluation points and interpolation as s_mp_mul_toom4
+ * but with seven squarings instead of seven multiplications.
+ */
+
+mp_err s_mp_sqr_toom4(const mp_int *a, mp_int *b)
+{
+   mp_int ap[4], w[7], sa, ta;
+   int B;
+   mp_err err;
+
+   if ((err = mp_init_multi(&ap[0], &ap[1], &ap[2], &ap[3], &sa, &ta, NULL)) != MP_OKAY) {
+      return err;
+   }
+   if ((err = mp_init_multi(&w[0], &w[1], &w[2], &w[3], &w[4], &w[5], &w[6], NULL)) != MP_OKAY) {
+      goto LBL_ERRw;
+   }
+
+   B = a->used / 4;
+
+   /** a = a3*x^3 + a2*x^2 + a1*x + a0; */
+   if ((err = s_mp_toom_split(a, B, 4, ap)) != MP_OKAY)           goto LBL_ERR;
+
+   /** sa = a0 + a2; ta = a1 + a3; */
+   if ((err = mp_add(&ap[0], &ap[2], &sa)) != MP_OKAY)            goto LBL_ERR;
+   if ((err = mp_add(&ap[1], &ap[3], &ta)) != MP_OKAY)            goto LBL_ERR;
+   /** w1 = (sa + ta)^2; w2 = (sa - ta)^2; */
+   if ((err = mp_add(&sa, &ta, &w[5])) != MP_OKAY)                goto LBL_ERR;
+   if ((err = mp_sqr(&w[5], &w[1])) != MP_OKAY)                   goto LBL_ERR;
+   if ((err = mp_sub(&sa, &ta, &w[5])) != MP_OKAY)                goto LBL_ERR;
+   if ((err = mp_sqr(&w[5], &w[2])) != MP_OKAY)                   goto LBL_ERR;
+
+   /** sa = a0 + 4*a2; ta = 2*a1 + 8*a3; */
+   if ((err = mp_mul_2d(&ap[2], 2, &sa)) != MP_OKAY)              goto LBL_ERR;
+   if ((err = mp_add(&sa, &ap[0], &sa)) != MP_OKAY)               goto LBL_ERR;
+   if ((err = mp_mul_2d(&ap[3], 2, &ta)) != MP_OKAY)              goto LBL_ERR;
+   if ((err = mp_add(&ta, &ap[1], &ta)) != MP_OKAY)               goto LBL_ERR;
+   if ((err = mp_mul_2(&ta, &ta)) != MP_OKAY)                     goto LBL_ERR;
+   /** w3 = (sa + ta)^2; w4 = (sa - ta)^2; */
+   if ((err = mp_add(&sa, &ta, &w[5])) != MP_OKAY)                goto LBL_ERR;
+   if ((err = mp_sqr(&w[5], &w[3])) != MP_OKAY)                   goto LBL_ERR;
+   if ((err = mp_sub(&sa, &ta, &w[5])) != MP_OKAY)                goto LBL_ERR;
+   if ((err = mp_sqr(&w[5], &w[4])) != MP_OKAY)                   goto LBL_ERR;
+
+   /** sa = ((2*a0 + a1)*2 + a2)*2 + a3; w5 = sa^2; */
+   if ((err = mp_mul_2(&ap[0], &sa)) != MP_OKAY)                  goto LBL_ERR;
+   if ((err = mp_add(&sa, &ap[1], &sa)) != MP_OKAY)               goto LBL_ERR;
+   if ((err = mp_mul_2(&sa, &sa)) != MP_OKAY)                     goto LBL_ERR;
+   if ((err = mp_add(&sa, &ap[2], &sa)) != MP_OKAY)               goto LBL_ERR;
+   if ((err = mp_mul_2(&sa, &sa)) != MP_OKAY)                     goto LBL_ERR;
+   if ((err = mp_add(&sa, &ap[3], &sa)) != MP_OKAY)               goto LBL_ERR;
+   if ((err = mp_sqr(&sa, &w[5])) != MP_OKAY)                     goto LBL_ERR;
+
+   /** w0 = a0^2; w6 = a3^2; */
+   if ((err = mp_sqr(&ap[0], &w[0])) != MP_OKAY)                  goto LBL_ERR;
+   if ((err = mp_sqr(&ap[3], &w[6])) != MP_OKAY)                  goto LBL_ERR;
+
+   err = s_mp_toom4_interpolate(w, B, b);
+
+LBL_ERR:
+   mp_clear_multi(&w[0], &w[1], &w[2], &w[3], &w[4], &w[5], &w[6], NULL);
+LBL_ERRw:
+   mp_clear_multi(&ap[0], &ap[1], &ap[2], &ap[3], &sa, &ta, NULL);
+   return err;
+}
+
+#endif
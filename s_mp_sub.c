@@ -21,29 +21,29 @@ mp_err s_mp_sub(const mp_int *a, const mp_int *b, mp_int *c)
    u = 0;
    for (i = 0; i < min; i++) {
       /* T[i] = A[i] - B[i] - U */
-      c->dp[i] = (a->dp[i] - b->dp[i]) - u;
+      mp_word t = ((mp_word)a->dp[i] - (mp_word)b->dp[i]) - (mp_word)u;
 
       /* U = carry bit of T[i]
        * Note this saves performing an AND operation since
        * if a carry does occur it will propagate all the way to the
-       * MSB.  As a result a single shift is enough to get the carry
+       * MSB of the mp_word.  As a result a single shift is enough to get the carry
        */
-      u = c->dp[i] >> (MP_SIZEOF_BITS(mp_digit) - 1u);
+      u = (mp_digit)(t >> (MP_SIZEOF_BITS(mp_word) - 1u));
 
       /* Clear carry from T[i] */
-      c->dp[i] &= MP_MASK;
+      c->dp[i] = (mp_digit)(t & (mp_word)MP_MASK);
    }
 
    /* now copy higher words if any, e.g. if A has more digits than B  */
    for (; i < max; i++) {
       /* T[i] = A[i] - U */
-      c->dp[i] = a->dp[i] - u;
+      mp_word t = (mp_word)a->dp[i] - (mp_word)u;
 
       /* U = carry bit of T[i] */
-      u = c->dp[i] >> (MP_SIZEOF_BITS(mp_digit) - 1u);
+      u = (mp_digit)(t >> (MP_SIZEOF_BITS(mp_word) - 1u));
 
       /* Clear carry from T[i] */
-      c->dp[i] &= MP_MASK;
+      c->dp[i] = (mp_digit)(t & (mp_word)MP_MASK);
    }
 
    /* clear digits above used (since we may not have grown result above) */
@@ -0,0 +1,22 @@
+#include "tommath_private.h"
+#ifdef S_MP_TO_WORDS_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+
+/* w[0..n-1] = the lowest n 32-bit words of |a| */
+void s_mp_to_words(const mp_int *a, uint32_t *w, int n)
+{
+   int i;
+   for (i = 0; i < n; i++) {
+      int pos = i * 32, ix = pos / MP_DIGIT_BIT, got;
+      uint64_t v = 0u;
+      if (ix < a->used) {
+         v = (uint64_t)(a->dp[ix] >> (pos % MP_DIGIT_BIT));
+         for (got = MP_DIGIT_BIT - (pos % MP_DIGIT_BIT); (got < 32) && (++ix < a->used); got += MP_DIGIT_BIT) {
+            v |= (uint64_t)a->dp[ix] << got;
+         }
+      }
+      w[i] = (uint32_t)v;
+   }
+}
+#endif
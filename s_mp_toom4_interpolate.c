@@ -0,0 +1,107 @@
+#include "tommath_private.h"
+#ifdef S_MP_TOOM4_INTERPOLATE_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+
+/* Interpolation for the Toom-Cook 4-way multiplication and squaring
+ * and for the unbalanced Toom-Cook 5x3 multiplication
+ *
+ * Input are the values of the degree six product polynomial at the
+ * points 0, 1, -1, 2, -2, 1/2 and infinity, where the value at 1/2 is
+ * scaled by 2^6 to keep it integral:
+ *
+ *    w[0] = c(0), w[1] = c(1), w[2] = c(-1), w[3] = c(2),
+ *    w[4] = c(-2), w[5] = 2^6 * c(1/2), w[6] = c(inf)
+ *
+ * The w[] are destroyed.  All divisions are exact.  The coefficients
+ * are recombined as c = sum c_i * x^i with x = 2^(B * MP_DIGIT_BIT).
+ */
+mp_err s_mp_toom4_interpolate(mp_int *w, int B, mp_int *c)
+{
+   mp_int t;
+   mp_err err;
+
+   if ((err = mp_init(&t)) != MP_OKAY) {
+      return err;
+   }
+
+   /** w2 = (w1 - w2)/2 = c1 + c3 + c5; */
+   if ((err = mp_sub(&w[1], &w[2], &w[2])) != MP_OKAY)            goto LBL_ERR;
+   if ((err = mp_div_2(&w[2], &w[2])) != MP_OKAY)                 goto LBL_ERR;
+   /** w1 = w1 - w2 - w0 - w6 = c2 + c4; */
+   if ((err = mp_sub(&w[1], &w[2], &w[1])) != MP_OKAY)            goto LBL_ERR;
+   if ((err = mp_sub(&w[1], &w[0], &w[1])) != MP_OKAY)            goto LBL_ERR;
+   if ((err = mp_sub(&w[1], &w[6], &w[1])) != MP_OKAY)            goto LBL_ERR;
+
+   /** w4 = (w3 - w4)/2 = 2*c1 + 8*c3 + 32*c5; */
+   if ((err = mp_sub(&w[3], &w[4], &w[4])) != MP_OKAY)            goto LBL_ERR;
+   if ((err = mp_div_2(&w[4], &w[4])) != MP_OKAY)                 goto LBL_ERR;
+   /** w3 = (w3 - w4 - w0 - 64*w6)/4 = c2 + 4*c4; */
+   if ((err = mp_sub(&w[3], &w[4], &w[3])) != MP_OKAY)            goto LBL_ERR;
+   if ((err = mp_sub(&w[3], &w[0], &w[3])) != MP_OKAY)            goto LBL_ERR;
+   if ((err = mp_mul_2d(&w[6], 6, &t)) != MP_OKAY)                goto LBL_ERR;
+   if ((err = mp_sub(&w[3], &t, &w[3])) != MP_OKAY)               goto LBL_ERR;
+   if ((err = mp_div_2d(&w[3], 2, &w[3], NULL)) != MP_OKAY)       goto LBL_ERR;
+   /** w4 = w4/2 = c1 + 4*c3 + 16*c5; */
+   if ((err = mp_div_2(&w[4], &w[4])) != MP_OKAY)                 goto LBL_ERR;
+
+   /** w3 = (w3 - w1)/3 = c4; */
+   if ((err = mp_sub(&w[3], &w[1], &w[3])) != MP_OKAY)            goto LBL_ERR;
+   if ((err = s_mp_div_3(&w[3], &w[3], NULL)) != MP_OKAY)         goto LBL_ERR;
+   /** w1 = w1 - w3 = c2; */
+   if ((err = mp_sub(&w[1], &w[3], &w[1])) != MP_OKAY)            goto LBL_ERR;
+
+   /** w5 = (w5 - 64*w0 - 16*w1 - 4*w3 - w6)/2 = 16*c1 + 4*c3 + c5; */
+   if ((err = mp_mul_2d(&w[0], 6, &t)) != MP_OKAY)                goto LBL_ERR;
+   if ((err = mp_sub(&w[5], &t, &w[5])) != MP_OKAY)               goto LBL_ERR;
+   if ((err = mp_mul_2d(&w[1], 4, &t)) != MP_OKAY)                goto LBL_ERR;
+   if ((err = mp_sub(&w[5], &t, &w[5])) != MP_OKAY)               goto LBL_ERR;
+   if ((err = mp_mul_2d(&w[3], 2, &t)) != MP_OKAY)                goto LBL_ERR;
+   if ((err = mp_sub(&w[5], &t, &w[5])) != MP_OKAY)               goto LBL_ERR;
+   if ((err = mp_sub(&w[5], &w[6], &w[5])) != MP_OKAY)            goto LBL_ERR;
+   if ((err = mp_div_2(&w[5], &w[5])) != MP_OKAY)                 goto LBL_ERR;
+
+   /** w5 = (w5 - w2)/3 = 5*c1 + c3; */
+   if ((err = mp_sub(&w[5], &w[2], &w[5])) != MP_OKAY)            goto LBL_ERR;
+   if ((err = s_mp_div_3(&w[5], &w[5], NULL)) != MP_OKAY)         goto LBL_ERR;
+   /** w4 = (w4 - w2)/3 = c3 + 5*c5; */
+   if ((err = mp_sub(&w[4], &w[2], &w[4])) != MP_OKAY)            goto LBL_ERR;
+   if ((err = s_mp_div_3(&w[4], &w[4], NULL)) != MP_OKAY)         goto LBL_ERR;
+
+   /** t = (5*w2 - w5 - w4)/3 = c3; */
+   if ((err = mp_mul_d(&w[2], 5u, &t)) != MP_OKAY)                goto LBL_ERR;
+   if ((err = mp_sub(&t, &w[5], &t)) != MP_OKAY)                  goto LBL_ERR;
+   if ((err = mp_sub(&t, &w[4], &t)) != MP_OKAY)                  goto LBL_ERR;
+   if ((err = s_mp_div_3(&t, &t, NULL)) != MP_OKAY)               goto LBL_ERR;
+
+   /** w5 = (w5 - w4)/5 = c1 - c5; */
+   if ((err = mp_sub(&w[5], &w[4], &w[5])) != MP_OKAY)            goto LBL_ERR;
+   if ((err = mp_div_d(&w[5], 5u, &w[5], NULL)) != MP_OKAY)       goto LBL_ERR;
+   /** w2 = w2 - t = c1 + c5; */
+   if ((err = mp_sub(&w[2], &t, &w[2])) != MP_OKAY)               goto LBL_ERR;
+   /** w4 = (w2 + w5)/2 = c1; */
+   if ((err = mp_add(&w[2], &w[5], &w[4])) != MP_OKAY)            goto LBL_ERR;
+   if ((err = mp_div_2(&w[4], &w[4])) != MP_OKAY)                 goto LBL_ERR;
+   /** w2 = w2 - w4 = c5; */
+   if ((err = mp_sub(&w[2], &w[4], &w[2])) != MP_OKAY)            goto LBL_ERR;
+
+   /** P = w6*x^6 + w2*x^5 + w3*x^4 + t*x^3 + w1*x^2 + w4*x + w0; */
+   if ((err = mp_lshd(&w[6], 6 * B)) != MP_OKAY)                  goto LBL_ERR;
+   if ((err = mp_lshd(&w[2], 5 * B)) != MP_OKAY)                  goto LBL_ERR;
+   if ((err = mp_add(&w[6], &w[2], &w[6])) != MP_OKAY)            goto LBL_ERR;
+   if ((err = mp_lshd(&w[3], 4 * B)) != MP_OKAY)                  goto LBL_ERR;
+   if ((err = mp_add(&w[6], &w[3], &w[6])) != MP_OKAY)            goto LBL_ERR;
+   if ((err = mp_lshd(&t, 3 * B)) != MP_OKAY)                     goto LBL_ERR;
+   if ((err = mp_add(&w[6], &t, &w[6])) != MP_OKAY)               goto LBL_ERR;
+   if ((err = mp_lshd(&w[1], 2 * B)) != MP_OKAY)                  goto LBL_ERR;
+   if ((err = mp_add(&w[6], &w[1], &w[6])) != MP_OKAY)            goto LBL_ERR;
+   if ((err = mp_lshd(&w[4], 1 * B)) != MP_OKAY)                  goto LBL_ERR;
+   if ((err = mp_add(&w[6], &w[4], &w[6])) != MP_OKAY)            goto LBL_ERR;
+   if ((err = mp_add(&w[6], &w[0], c)) != MP_OKAY)                goto LBL_ERR;
+
+LBL_ERR:
+   mp_clear(&t);
+   return err;
+}
+
+#endif
@@ -0,0 +1,29 @@
+#include "tommath_private.h"
+#ifdef S_MP_TOOM_SPLIT_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+
+/* cut a into k slices of B digits each, the last one takes the rest
+ *
+ * Slices past the end of a are zero.  The Toom-Cook variants stay correct
+ * for any B, the choice of B only decides how well balanced the pieces are.
+ */
+mp_err s_mp_toom_split(const mp_int *a, int B, int k, mp_int *p)
+{
+   mp_err err;
+   int i, n, off;
+   for (i = 0; i < k; i++) {
+      off = MP_MIN(i * B, a->used);
+      n = (i < (k - 1)) ? MP_MIN(B, a->used - off) : (a->used - off);
+      if ((err = mp_grow(&p[i], n)) != MP_OKAY) {
+         return err;
+      }
+      p[i].used = n;
+      p[i].sign = MP_ZPOS;
+      s_mp_copy_digs(p[i].dp, a->dp + off, n);
+      mp_clamp(&p[i]);
+   }
+   return MP_OKAY;
+}
+
+#endif
@@ -8,6 +8,11 @@ mp_add.c
 mp_add_d.c
 mp_addmod.c
 mp_and.c
+mp_barrett_ctx_clear.c
+mp_barrett_ctx_init.c
+mp_barrett_exptmod.c
+mp_barrett_mulmod.c
+mp_barrett_reduce.c
 mp_clamp.c
 mp_clear.c
 mp_clear_multi.c
@@ -18,11 +23,19 @@ mp_cnt_lsb.c
 mp_complement.c
 mp_copy.c
 mp_count_bits.c
+mp_crt_ctx_clear.c
+mp_crt_ctx_init.c
+mp_crt_exptmod.c
 mp_cutoffs.c
 mp_div.c
 mp_div_2.c
 mp_div_2d.c
+mp_div_ctx_clear.c
+mp_div_ctx_divmod.c
+mp_div_ctx_init.c
 mp_div_d.c
+mp_divexact.c
+mp_divexact_d.c
 mp_dr_is_modulus.c
 mp_dr_reduce.c
 mp_dr_setup.c
@@ -30,7 +43,16 @@ mp_error_to_string.c
 mp_exch.c
 mp_expt_n.c
 mp_exptmod.c
+mp_exptmod_batch.c
+mp_exptmod_crt.c
+mp_exptmod_multi.c
 mp_exteuclid.c
+mp_fixed_base_count.c
+mp_fixed_base_ctx_clear.c
+mp_fixed_base_ctx_import.c
+mp_fixed_base_ctx_init.c
+mp_fixed_base_export.c
+mp_fixed_base_exptmod.c
 mp_fread.c
 mp_from_sbin.c
 mp_from_ubin.c
@@ -65,6 +87,13 @@ mp_log_n.c
 mp_lshd.c
 mp_mod.c
 mp_mod_2d.c
+mp_mont_ctx_clear.c
+mp_mont_ctx_init.c
+mp_mont_exptmod.c
+mp_mont_from.c
+mp_mont_mul.c
+mp_mont_sqr.c
+mp_mont_to.c
 mp_montgomery_calc_normalization.c
 mp_montgomery_reduce.c
 mp_montgomery_setup.c
@@ -72,6 +101,9 @@ mp_mul.c
 mp_mul_2.c
 mp_mul_2d.c
 mp_mul_d.c
+mp_mul_high.c
+mp_mul_low.c
+mp_mul_threads.c
 mp_mulmod.c
 mp_neg.c
 mp_or.c
@@ -125,37 +157,88 @@ mp_unpack.c
 mp_xor.c
 mp_zero.c
 s_mp_add.c
+s_mp_addmul_adx.c
+s_mp_comba_column.c
 s_mp_copy_digs.c
+s_mp_cpu_adx.c
+s_mp_cpu_ifma.c
 s_mp_div_3.c
+s_mp_div_3by2.c
+s_mp_div_barrett.c
+s_mp_div_newton.c
+s_mp_div_recip.c
 s_mp_div_recursive.c
 s_mp_div_school.c
 s_mp_div_small.c
 s_mp_exptmod.c
 s_mp_exptmod_fast.c
+s_mp_exptmod_ifma.c
+s_mp_exptmod_lazy.c
+s_mp_exptmod_solinas.c
+s_mp_exptmod_window.c
+s_mp_exptmod_winsize.c
+s_mp_fixed_base_setup.c
 s_mp_fp_log.c
 s_mp_fp_log_d.c
+s_mp_from_words.c
 s_mp_get_bit.c
+s_mp_ifma_rr.c
 s_mp_invmod.c
 s_mp_invmod_odd.c
+s_mp_invmod_radix.c
 s_mp_log_2expt.c
+s_mp_mod_d_multi.c
+s_mp_mont_mul_comba.c
+s_mp_mont_mul_lazy.c
+s_mp_montgomery_reduce_adx.c
 s_mp_montgomery_reduce_comba.c
+s_mp_montgomery_reduce_mul.c
 s_mp_mul.c
+s_mp_mul_adx.c
 s_mp_mul_balance.c
 s_mp_mul_comba.c
+s_mp_mul_fft.c
 s_mp_mul_high.c
 s_mp_mul_high_comba.c
+s_mp_mul_high_mulders.c
 s_mp_mul_karatsuba.c
+s_mp_mul_low_mulders.c
+s_mp_mul_parallel.c
+s_mp_mul_pool_run.c
+s_mp_mul_scratch.c
+s_mp_mul_task_run.c
 s_mp_mul_toom.c
+s_mp_mul_toom32.c
+s_mp_mul_toom4.c
+s_mp_mul_toom42.c
+s_mp_mul_toom53.c
 s_mp_prime_is_divisible.c
 s_mp_prime_tab.c
 s_mp_radix_map.c
 s_mp_radix_size_overestimate.c
 s_mp_rand_platform.c
+s_mp_reduce.c
+s_mp_reduce_2k.c
+s_mp_reduce_2k_l.c
+s_mp_scratch_clear.c
+s_mp_scratch_get.c
+s_mp_scratch_init.c
+s_mp_scratch_size.c
+s_mp_solinas_find.c
+s_mp_solinas_mul.c
+s_mp_solinas_mulmod.c
+s_mp_solinas_tab.c
 s_mp_sqr.c
+s_mp_sqr_adx.c
 s_mp_sqr_comba.c
+s_mp_sqr_fft.c
 s_mp_sqr_karatsuba.c
 s_mp_sqr_toom.c
+s_mp_sqr_toom4.c
 s_mp_sub.c
+s_mp_to_words.c
+s_mp_toom4_interpolate.c
+s_mp_toom_split.c
 s_mp_zero_buf.c
 s_mp_zero_digs.c
 )
@@ -16,6 +16,11 @@
 extern "C" {
 #endif
 
+/* full-radix 64-bit digits are a variant of the 64-bit configuration */
+#if defined(MP_64BIT_FULL) && !defined(MP_64BIT)
+#   define MP_64BIT
+#endif
+
 /* MS Visual C++ doesn't have a 128bit type for words, so fall back to 32bit MPI's (where words are 64bit) */
 #if (defined(_MSC_VER) || defined(__LLP64__) || defined(__e2k__) || defined(__LCC__)) && !defined(MP_64BIT)
 #   define MP_32BIT
@@ -40,7 +45,7 @@ extern "C" {
 #endif
 
 #ifdef MP_DIGIT_BIT
-#   error Defining MP_DIGIT_BIT is disallowed, use MP_16/31/32/64BIT
+#   error Defining MP_DIGIT_BIT is disallowed, use MP_16/31/32/64BIT or MP_64BIT_FULL
 #endif
 
 /* some default configurations.
@@ -48,6 +53,9 @@ extern "C" {
  * A "mp_digit" must be able to hold MP_DIGIT_BIT + 1 bits
  * A "mp_word" must be able to hold 2*MP_DIGIT_BIT + 1 bits
  *
+ * The exception is MP_64BIT_FULL which uses all 64 bits of a mp_digit.
+ * Without the spare (nail) bit the carries are taken from the mp_word.
+ *
  * At the very least a mp_digit must be able to hold 7 bits
  * [any size beyond that is ok provided it doesn't overflow the data type]
  */
@@ -57,7 +65,11 @@ typedef uint16_t             mp_digit;
 #   define MP_DIGIT_BIT 15
 #elif ((defined (MP_64BIT)) && !(defined(MP_31BIT)) )
 typedef uint64_t mp_digit;
-#   define MP_DIGIT_BIT 60
+#   ifdef MP_64BIT_FULL
+#      define MP_DIGIT_BIT 64
+#   else
+#      define MP_DIGIT_BIT 60
+#   endif
 #else
 typedef uint32_t             mp_digit;
 #   ifdef MP_31BIT
@@ -75,7 +87,11 @@ typedef uint32_t             mp_digit;
 #   endif
 #endif
 
-#define MP_MASK          ((((mp_digit)1)<<((mp_digit)MP_DIGIT_BIT))-((mp_digit)1))
+#ifdef MP_64BIT_FULL
+#   define MP_MASK       (~(mp_digit)0)
+#else
+#   define MP_MASK       ((((mp_digit)1)<<((mp_digit)MP_DIGIT_BIT))-((mp_digit)1))
+#endif
 #define MP_DIGIT_MAX     MP_MASK
 
 /* Primality generation flags */
@@ -121,7 +137,14 @@ extern int
 MP_MUL_KARATSUBA_CUTOFF,
 MP_SQR_KARATSUBA_CUTOFF,
 MP_MUL_TOOM_CUTOFF,
-MP_SQR_TOOM_CUTOFF;
+MP_SQR_TOOM_CUTOFF,
+MP_MUL_TOOM4_CUTOFF,
+MP_SQR_TOOM4_CUTOFF,
+MP_MUL_FFT_CUTOFF,
+MP_SQR_FFT_CUTOFF,
+MP_MUL_PARALLEL_CUTOFF,
+MP_DIV_NEWTON_CUTOFF,
+MP_REDUCE_MUL_CUTOFF;
 #endif
 
 /* define this to use lower memory usage routines (exptmods mostly) */
@@ -353,12 +376,42 @@ mp_err mp_sub(const mp_int *a, const mp_int *b, mp_int *c) MP_WUR;
 /* c = a * b */
 mp_err mp_mul(const mp_int *a, const mp_int *b, mp_int *c) MP_WUR;
 
+/* c = a * b mod B**digs, only the lower digs digits of the product */
+mp_err mp_mul_low(const mp_int *a, const mp_int *b, int digs, mp_int *c) MP_WUR;
+
+/* c = a * b / B**digs, only the digits of the product above the lower digs */
+mp_err mp_mul_high(const mp_int *a, const mp_int *b, int digs, mp_int *c) MP_WUR;
+
+/* use that many worker threads for the sub-products of huge multiplications, 0 for none */
+mp_err mp_mul_threads(int threads) MP_WUR;
+
 /* b = a*a  */
 #define mp_sqr(a, b) mp_mul((a), (a), (b))
 
 /* a/b => cb + d == a */
 mp_err mp_div(const mp_int *a, const mp_int *b, mp_int *c, mp_int *d) MP_WUR;
 
+/* a divisor prepared for many divisions by it */
+typedef struct {
+   mp_int   b,      /* the divisor, shifted left by norm bits */
+            x;      /* its reciprocal if it is long enough */
+   mp_digit v;      /* the reciprocal of its upper two digits */
+   mp_sign  sign;
+   int      norm;
+} mp_div_ctx;
+
+/* prepares ctx for the divisions by b */
+mp_err mp_div_ctx_init(mp_div_ctx *ctx, const mp_int *b) MP_WUR;
+
+/* frees ctx */
+void mp_div_ctx_clear(mp_div_ctx *ctx);
+
+/* c = a / b, d = a mod b like mp_div() with the b of ctx */
+mp_err mp_div_ctx_divmod(const mp_div_ctx *ctx, const mp_int *a, mp_int *c, mp_int *d) MP_WUR;
+
+/* c = a / b for a b that divides a, faster than mp_div() */
+mp_err mp_divexact(const mp_int *a, const mp_int *b, mp_int *c) MP_WUR;
+
 /* c = a mod b, 0 <= c < b  */
 mp_err mp_mod(const mp_int *a, const mp_int *b, mp_int *c) MP_WUR;
 
@@ -385,6 +438,9 @@ mp_err mp_mul_d(const mp_int *a, mp_digit b, mp_int *c) MP_WUR;
 /* a/b => cb + d == a */
 mp_err mp_div_d(const mp_int *a, mp_digit b, mp_int *c, mp_digit *d) MP_WUR;
 
+/* c = a / b for a b that divides a, faster than mp_div_d() */
+mp_err mp_divexact_d(const mp_int *a, mp_digit b, mp_int *c) MP_WUR;
+
 /* c = a mod b, 0 <= c < b  */
 #define mp_mod_d(a, b, c) mp_div_d((a), (b), NULL, (c))
 
@@ -451,6 +507,27 @@ mp_err mp_reduce_setup(mp_int *a, const mp_int *b) MP_WUR;
  */
 mp_err mp_reduce(mp_int *x, const mp_int *m, const mp_int *mu) MP_WUR;
 
+/* a modulus prepared for Barrett reduction, any m > 0 */
+typedef struct {
+   mp_int   m,      /* the modulus */
+            mu;     /* floor(B**(2*m.used) / m) */
+} mp_barrett_ctx;
+
+/* prepares ctx for the reductions modulo m */
+mp_err mp_barrett_ctx_init(mp_barrett_ctx *ctx, const mp_int *m) MP_WUR;
+
+/* frees ctx */
+void mp_barrett_ctx_clear(mp_barrett_ctx *ctx);
+
+/* c = a mod m, 0 <= c < m */
+mp_err mp_barrett_reduce(const mp_barrett_ctx *ctx, const mp_int *a, mp_int *c) MP_WUR;
+
+/* c = a*b mod m */
+mp_err mp_barrett_mulmod(const mp_barrett_ctx *ctx, const mp_int *a, const mp_int *b, mp_int *c) MP_WUR;
+
+/* Y = G**X mod m */
+mp_err mp_barrett_exptmod(const mp_barrett_ctx *ctx, const mp_int *G, const mp_int *X, mp_int *Y) MP_WUR;
+
 /* setups the montgomery reduction */
 mp_err mp_montgomery_setup(const mp_int *n, mp_digit *rho) MP_WUR;
 
@@ -462,6 +539,88 @@ mp_err mp_montgomery_calc_normalization(mp_int *a, const mp_int *b) MP_WUR;
 /* computes x/R == x (mod N) via Montgomery Reduction */
 mp_err mp_montgomery_reduce(mp_int *x, const mp_int *n, mp_digit rho) MP_WUR;
 
+/* an odd modulus prepared for Montgomery arithmetic with R = B**n.used */
+typedef struct {
+   mp_int   n,      /* the modulus */
+            r,      /* R mod n, the one of the Montgomery domain */
+            rr,     /* R**2 mod n */
+            ninv,   /* 1/n mod R from MP_REDUCE_MUL_CUTOFF digits on, else zero */
+            ifma;   /* R**2 mod n in the 52-bit limbs of AVX-512 IFMA if used, else zero */
+   mp_digit rho;    /* -1/n mod B */
+} mp_mont_ctx;
+
+/* prepares ctx for the arithmetic modulo n */
+mp_err mp_mont_ctx_init(mp_mont_ctx *ctx, const mp_int *n) MP_WUR;
+
+/* frees ctx */
+void mp_mont_ctx_clear(mp_mont_ctx *ctx);
+
+/* c = a*R mod n, into the Montgomery domain */
+mp_err mp_mont_to(const mp_mont_ctx *ctx, const mp_int *a, mp_int *c) MP_WUR;
+
+/* c = a/R mod n, out of the Montgomery domain, 0 <= a < n */
+mp_err mp_mont_from(const mp_mont_ctx *ctx, const mp_int *a, mp_int *c) MP_WUR;
+
+/* c = a*b/R mod n, 0 <= a, b < n */
+mp_err mp_mont_mul(const mp_mont_ctx *ctx, const mp_int *a, const mp_int *b, mp_int *c) MP_WUR;
+
+/* c = a*a/R mod n, 0 <= a < n */
+mp_err mp_mont_sqr(const mp_mont_ctx *ctx, const mp_int *a, mp_int *c) MP_WUR;
+
+/* Y = G**X mod n, outside of the Montgomery domain */
+mp_err mp_mont_exptmod(const mp_mont_ctx *ctx, const mp_int *G, const mp_int *X, mp_int *Y) MP_WUR;
+
+/* a base g prepared for g**X mod an odd n, a Lim-Lee comb for X of up to bits bits */
+typedef struct {
+   mp_mont_ctx mont;    /* the Montgomery arithmetic modulo n */
+   mp_int   g;          /* the base mod n */
+   mp_digit *table;     /* v * (2**h - 1) powers of g in the Montgomery domain, n.used digits each */
+   int      bits,       /* the longest exponent the comb covers */
+            h,          /* rows of the comb, bits of a table index */
+            v;          /* columns of the comb */
+} mp_fixed_base_ctx;
+
+/* prepares ctx for the powers of G modulo n with exponents of up to bits bits */
+mp_err mp_fixed_base_ctx_init(mp_fixed_base_ctx *ctx, const mp_int *G, const mp_int *n, int bits) MP_WUR;
+
+/* like mp_fixed_base_ctx_init() with the table of mp_fixed_base_export() */
+mp_err mp_fixed_base_ctx_import(mp_fixed_base_ctx *ctx, const mp_int *G, const mp_int *n, int bits,
+                                const mp_digit *buf, size_t count) MP_WUR;
+
+/* frees ctx */
+void mp_fixed_base_ctx_clear(mp_fixed_base_ctx *ctx);
+
+/* number of digits of the table of ctx */
+size_t mp_fixed_base_count(const mp_fixed_base_ctx *ctx) MP_WUR;
+
+/* copies the table of ctx to buf */
+mp_err mp_fixed_base_export(const mp_fixed_base_ctx *ctx, mp_digit *buf, size_t maxcount, size_t *written) MP_WUR;
+
+/* Y = g**X mod n for X >= 0 with the base and modulus of ctx */
+mp_err mp_fixed_base_exptmod(const mp_fixed_base_ctx *ctx, const mp_int *X, mp_int *Y) MP_WUR;
+
+/* an RSA private key in CRT form prepared for mp_crt_exptmod() */
+typedef struct {
+   mp_mont_ctx p, q;    /* the Montgomery arithmetic modulo the primes */
+   mp_int   dp, dq,     /* d mod (p - 1) and d mod (q - 1) */
+            qinv;       /* 1/q mod p in the Montgomery domain of p */
+   bool     threads;    /* the power modulo q on a second thread */
+} mp_crt_ctx;
+
+/* prepares ctx for c**d mod p*q, threads for the two halves on two threads */
+mp_err mp_crt_ctx_init(mp_crt_ctx *ctx, const mp_int *dp, const mp_int *dq, const mp_int *p, const mp_int *q,
+                       const mp_int *qinv, bool threads) MP_WUR;
+
+/* frees ctx */
+void mp_crt_ctx_clear(mp_crt_ctx *ctx);
+
+/* out = c**d mod p*q with the key of ctx */
+mp_err mp_crt_exptmod(const mp_crt_ctx *ctx, const mp_int *c, mp_int *out) MP_WUR;
+
+/* out = c**d mod p*q from dp = d mod (p - 1), dq = d mod (q - 1) and qinv = 1/q mod p */
+mp_err mp_exptmod_crt(const mp_int *c, const mp_int *dp, const mp_int *dq, const mp_int *p, const mp_int *q,
+                      const mp_int *qinv, mp_int *out) MP_WUR;
+
 /* returns 1 if a is a valid DR modulus */
 bool mp_dr_is_modulus(const mp_int *a) MP_WUR;
 
@@ -492,6 +651,14 @@ mp_err mp_reduce_2k_l(mp_int *a, const mp_int *n, const mp_int *d) MP_WUR;
 /* Y = G**X (mod P) */
 mp_err mp_exptmod(const mp_int *G, const mp_int *X, const mp_int *P, mp_int *Y) MP_WUR;
 
+/* Y = bases[0]**exps[0] * ... * bases[n-1]**exps[n-1] (mod P) with one chain of squarings */
+mp_err mp_exptmod_multi(const mp_int **bases, const mp_int **exps, int n, const mp_int *P, mp_int *Y) MP_WUR;
+
+/* Y[i] = G[i]**X[i] mod P[i] for n independent jobs, on the threads of mp_mul_threads() if there are any,
+ * errs[i] the result of each job if errs is not NULL
+ */
+mp_err mp_exptmod_batch(const mp_int **G, const mp_int **X, const mp_int **P, mp_int **Y, int n, mp_err *errs) MP_WUR;
+
 #if defined(MP_16BIT)
 typedef uint32_t mp_hval;
 #else
@@ -17,6 +17,11 @@
 #   define MP_ADD_D_C
 #   define MP_ADDMOD_C
 #   define MP_AND_C
+#   define MP_BARRETT_CTX_CLEAR_C
+#   define MP_BARRETT_CTX_INIT_C
+#   define MP_BARRETT_EXPTMOD_C
+#   define MP_BARRETT_MULMOD_C
+#   define MP_BARRETT_REDUCE_C
 #   define MP_CLAMP_C
 #   define MP_CLEAR_C
 #   define MP_CLEAR_MULTI_C
@@ -27,11 +32,19 @@
 #   define MP_COMPLEMENT_C
 #   define MP_COPY_C
 #   define MP_COUNT_BITS_C
+#   define MP_CRT_CTX_CLEAR_C
+#   define MP_CRT_CTX_INIT_C
+#   define MP_CRT_EXPTMOD_C
 #   define MP_CUTOFFS_C
 #   define MP_DIV_C
 #   define MP_DIV_2_C
 #   define MP_DIV_2D_C
+#   define MP_DIV_CTX_CLEAR_C
+#   define MP_DIV_CTX_DIVMOD_C
+#   define MP_DIV_CTX_INIT_C
 #   define MP_DIV_D_C
+#   define MP_DIVEXACT_C
+#   define MP_DIVEXACT_D_C
 #   define MP_DR_IS_MODULUS_C
 #   define MP_DR_REDUCE_C
 #   define MP_DR_SETUP_C
@@ -39,7 +52,16 @@
 #   define MP_EXCH_C
 #   define MP_EXPT_N_C
 #   define MP_EXPTMOD_C
+#   define MP_EXPTMOD_BATCH_C
+#   define MP_EXPTMOD_CRT_C
+#   define MP_EXPTMOD_MULTI_C
 #   define MP_EXTEUCLID_C
+#   define MP_FIXED_BASE_COUNT_C
+#   define MP_FIXED_BASE_CTX_CLEAR_C
+#   define MP_FIXED_BASE_CTX_IMPORT_C
+#   define MP_FIXED_BASE_CTX_INIT_C
+#   define MP_FIXED_BASE_EXPORT_C
+#   define MP_FIXED_BASE_EXPTMOD_C
 #   define MP_FREAD_C
 #   define MP_FROM_SBIN_C
 #   define MP_FROM_UBIN_C
@@ -74,6 +96,13 @@
 #   define MP_LSHD_C
 #   define MP_MOD_C
 #   define MP_MOD_2D_C
+#   define MP_MONT_CTX_CLEAR_C
+#   define MP_MONT_CTX_INIT_C
+#   define MP_MONT_EXPTMOD_C
+#   define MP_MONT_FROM_C
+#   define MP_MONT_MUL_C
+#   define MP_MONT_SQR_C
+#   define MP_MONT_TO_C
 #   define MP_MONTGOMERY_CALC_NORMALIZATION_C
 #   define MP_MONTGOMERY_REDUCE_C
 #   define MP_MONTGOMERY_SETUP_C
@@ -81,6 +110,9 @@
 #   define MP_MUL_2_C
 #   define MP_MUL_2D_C
 #   define MP_MUL_D_C
+#   define MP_MUL_HIGH_C
+#   define MP_MUL_LOW_C
+#   define MP_MUL_THREADS_C
 #   define MP_MULMOD_C
 #   define MP_NEG_C
 #   define MP_OR_C
@@ -134,37 +166,88 @@
 #   define MP_XOR_C
 #   define MP_ZERO_C
 #   define S_MP_ADD_C
+#   define S_MP_ADDMUL_ADX_C
+#   define S_MP_COMBA_COLUMN_C
 #   define S_MP_COPY_DIGS_C
+#   define S_MP_CPU_ADX_C
+#   define S_MP_CPU_IFMA_C
 #   define S_MP_DIV_3_C
+#   define S_MP_DIV_3BY2_C
+#   define S_MP_DIV_BARRETT_C
+#   define S_MP_DIV_NEWTON_C
+#   define S_MP_DIV_RECIP_C
 #   define S_MP_DIV_RECURSIVE_C
 #   define S_MP_DIV_SCHOOL_C
 #   define S_MP_DIV_SMALL_C
 #   define S_MP_EXPTMOD_C
 #   define S_MP_EXPTMOD_FAST_C
+#   define S_MP_EXPTMOD_IFMA_C
+#   define S_MP_EXPTMOD_LAZY_C
+#   define S_MP_EXPTMOD_SOLINAS_C
+#   define S_MP_EXPTMOD_WINDOW_C
+#   define S_MP_EXPTMOD_WINSIZE_C
+#   define S_MP_FIXED_BASE_SETUP_C
 #   define S_MP_FP_LOG_C
 #   define S_MP_FP_LOG_D_C
+#   define S_MP_FROM_WORDS_C
 #   define S_MP_GET_BIT_C
+#   define S_MP_IFMA_RR_C
 #   define S_MP_INVMOD_C
 #   define S_MP_INVMOD_ODD_C
+#   define S_MP_INVMOD_RADIX_C
 #   define S_MP_LOG_2EXPT_C
+#   define S_MP_MOD_D_MULTI_C
+#   define S_MP_MONT_MUL_COMBA_C
+#   define S_MP_MONT_MUL_LAZY_C
+#   define S_MP_MONTGOMERY_REDUCE_ADX_C
 #   define S_MP_MONTGOMERY_REDUCE_COMBA_C
+#   define S_MP_MONTGOMERY_REDUCE_MUL_C
 #   define S_MP_MUL_C
+#   define S_MP_MUL_ADX_C
 #   define S_MP_MUL_BALANCE_C
 #   define S_MP_MUL_COMBA_C
+#   define S_MP_MUL_FFT_C
 #   define S_MP_MUL_HIGH_C
 #   define S_MP_MUL_HIGH_COMBA_C
+#   define S_MP_MUL_HIGH_MULDERS_C
 #   define S_MP_MUL_KARATSUBA_C
+#   define S_MP_MUL_LOW_MULDERS_C
+#   define S_MP_MUL_PARALLEL_C
+#   define S_MP_MUL_POOL_RUN_C
+#   define S_MP_MUL_SCRATCH_C
+#   define S_MP_MUL_TASK_RUN_C
 #   define S_MP_MUL_TOOM_C
+#   define S_MP_MUL_TOOM32_C
+#   define S_MP_MUL_TOOM4_C
+#   define S_MP_MUL_TOOM42_C
+#   define S_MP_MUL_TOOM53_C
 #   define S_MP_PRIME_IS_DIVISIBLE_C
 #   define S_MP_PRIME_TAB_C
 #   define S_MP_RADIX_MAP_C
 #   define S_MP_RADIX_SIZE_OVERESTIMATE_C
 #   define S_MP_RAND_PLATFORM_C
+#   define S_MP_REDUCE_C
+#   define S_MP_REDUCE_2K_C
+#   define S_MP_REDUCE_2K_L_C
+#   define S_MP_SCRATCH_CLEAR_C
+#   define S_MP_SCRATCH_GET_C
+#   define S_MP_SCRATCH_INIT_C
+#   define S_MP_SCRATCH_SIZE_C
+#   define S_MP_SOLINAS_FIND_C
+#   define S_MP_SOLINAS_MUL_C
+#   define S_MP_SOLINAS_MULMOD_C
+#   define S_MP_SOLINAS_TAB_C
 #   define S_MP_SQR_C
+#   define S_MP_SQR_ADX_C
 #   define S_MP_SQR_COMBA_C
+#   define S_MP_SQR_FFT_C
 #   define S_MP_SQR_KARATSUBA_C
 #   define S_MP_SQR_TOOM_C
+#   define S_MP_SQR_TOOM4_C
 #   define S_MP_SUB_C
+#   define S_MP_TO_WORDS_C
+#   define S_MP_TOOM4_INTERPOLATE_C
+#   define S_MP_TOOM_SPLIT_C
 #   define S_MP_ZERO_BUF_C
 #   define S_MP_ZERO_DIGS_C
 #endif
@@ -201,6 +284,55 @@
 #   define MP_GROW_C
 #endif
 
+#if defined(MP_BARRETT_CTX_CLEAR_C)
+#   define MP_CLEAR_MULTI_C
+#endif
+
+#if defined(MP_BARRETT_CTX_INIT_C)
+#   define MP_CLEAR_MULTI_C
+#   define MP_COPY_C
+#   define MP_INIT_MULTI_C
+#   define MP_REDUCE_SETUP_C
+#endif
+
+#if defined(MP_BARRETT_EXPTMOD_C)
+#   define MP_BARRETT_MULMOD_C
+#   define MP_BARRETT_REDUCE_C
+#   define MP_CLEAR_C
+#   define MP_CLEAR_MULTI_C
+#   define MP_COPY_C
+#   define MP_COUNT_BITS_C
+#   define MP_EXCH_C
+#   define MP_INIT_C
+#   define MP_INIT_SIZE_C
+#   define MP_SET_C
+#   define S_MP_EXPTMOD_WINDOW_C
+#   define S_MP_EXPTMOD_WINSIZE_C
+#endif
+
+#if defined(MP_BARRETT_MULMOD_C)
+#   define MP_BARRETT_REDUCE_C
+#   define MP_MUL_C
+#endif
+
+#if defined(MP_BARRETT_REDUCE_C)
+#   define MP_2EXPT_C
+#   define MP_ABS_C
+#   define MP_ADD_C
+#   define MP_CLEAR_C
+#   define MP_CMP_MAG_C
+#   define MP_INIT_SIZE_C
+#   define MP_MOD_2D_C
+#   define MP_MOD_C
+#   define MP_MUL_C
+#   define MP_MUL_HIGH_C
+#   define MP_MUL_LOW_C
+#   define MP_RSHD_C
+#   define MP_SUB_C
+#   define S_MP_MUL_HIGH_C
+#   define S_MP_SUB_C
+#endif
+
 #if defined(MP_CLAMP_C)
 #endif
 
@@ -238,6 +370,33 @@
 #if defined(MP_COUNT_BITS_C)
 #endif
 
+#if defined(MP_CRT_CTX_CLEAR_C)
+#   define MP_CLEAR_MULTI_C
+#   define MP_MONT_CTX_CLEAR_C
+#endif
+
+#if defined(MP_CRT_CTX_INIT_C)
+#   define MP_CLEAR_MULTI_C
+#   define MP_CMP_D_C
+#   define MP_COPY_C
+#   define MP_INIT_MULTI_C
+#   define MP_MONT_CTX_CLEAR_C
+#   define MP_MONT_CTX_INIT_C
+#   define MP_MONT_TO_C
+#   define MP_MULMOD_C
+#endif
+
+#if defined(MP_CRT_EXPTMOD_C)
+#   define MP_ADD_C
+#   define MP_CLEAR_MULTI_C
+#   define MP_INIT_MULTI_C
+#   define MP_MOD_C
+#   define MP_MONT_EXPTMOD_C
+#   define MP_MONT_MUL_C
+#   define MP_MUL_C
+#   define MP_SUB_C
+#endif
+
 #if defined(MP_CUTOFFS_C)
 #endif
 
@@ -245,6 +404,7 @@
 #   define MP_CMP_MAG_C
 #   define MP_COPY_C
 #   define MP_ZERO_C
+#   define S_MP_DIV_NEWTON_C
 #   define S_MP_DIV_RECURSIVE_C
 #   define S_MP_DIV_SCHOOL_C
 #   define S_MP_DIV_SMALL_C
@@ -263,6 +423,36 @@
 #   define MP_RSHD_C
 #endif
 
+#if defined(MP_DIV_CTX_CLEAR_C)
+#   define MP_CLEAR_MULTI_C
+#endif
+
+#if defined(MP_DIV_CTX_DIVMOD_C)
+#   define MP_CLAMP_C
+#   define MP_CLEAR_MULTI_C
+#   define MP_CMP_MAG_C
+#   define MP_DIV_2D_C
+#   define MP_EXCH_C
+#   define MP_GROW_C
+#   define MP_INIT_MULTI_C
+#   define MP_MUL_2D_C
+#   define S_MP_DIV_3BY2_C
+#   define S_MP_DIV_BARRETT_C
+#endif
+
+#if defined(MP_DIV_CTX_INIT_C)
+#   define MP_2EXPT_C
+#   define MP_CLEAR_MULTI_C
+#   define MP_COPY_C
+#   define MP_COUNT_BITS_C
+#   define MP_INIT_MULTI_C
+#   define MP_LSHD_C
+#   define MP_MUL_2D_C
+#   define MP_RSHD_C
+#   define MP_SUB_D_C
+#   define S_MP_DIV_RECIP_C
+#endif
+
 #if defined(MP_DIV_D_C)
 #   define MP_CLAMP_C
 #   define MP_CLEAR_C
@@ -274,6 +464,33 @@
 #   define S_MP_DIV_3_C
 #endif
 
+#if defined(MP_DIVEXACT_C)
+#   define MP_CLAMP_C
+#   define MP_CLEAR_MULTI_C
+#   define MP_CMP_MAG_C
+#   define MP_CNT_LSB_C
+#   define MP_DIVEXACT_D_C
+#   define MP_DIV_2D_C
+#   define MP_EXCH_C
+#   define MP_GROW_C
+#   define MP_INIT_MULTI_C
+#   define MP_MOD_2D_C
+#   define MP_MONTGOMERY_SETUP_C
+#   define MP_MUL_C
+#   define MP_MUL_LOW_C
+#   define MP_RSHD_C
+#   define MP_SUB_C
+#   define MP_ZERO_C
+#   define S_MP_COPY_DIGS_C
+#   define S_MP_INVMOD_RADIX_C
+#   define S_MP_ZERO_DIGS_C
+#endif
+
+#if defined(MP_DIVEXACT_D_C)
+#   define MP_CLAMP_C
+#   define MP_DIV_2D_C
+#endif
+
 #if defined(MP_DR_IS_MODULUS_C)
 #endif
 
@@ -311,6 +528,57 @@
 #   define MP_REDUCE_IS_2K_L_C
 #   define S_MP_EXPTMOD_C
 #   define S_MP_EXPTMOD_FAST_C
+#   define S_MP_EXPTMOD_SOLINAS_C
+#   define S_MP_SOLINAS_FIND_C
+#endif
+
+#if defined(MP_EXPTMOD_BATCH_C)
+#   define MP_CMP_C
+#   define MP_EXPTMOD_C
+#   define MP_MONT_CTX_CLEAR_C
+#   define MP_MONT_CTX_INIT_C
+#   define MP_MONT_EXPTMOD_C
+#   define S_MP_ZERO_BUF_C
+#endif
+
+#if defined(MP_EXPTMOD_CRT_C)
+#   define MP_CRT_CTX_CLEAR_C
+#   define MP_CRT_CTX_INIT_C
+#   define MP_CRT_EXPTMOD_C
+#endif
+
+#if defined(MP_EXPTMOD_MULTI_C)
+#   define MP_2EXPT_C
+#   define MP_CLAMP_C
+#   define MP_CLEAR_C
+#   define MP_CLEAR_MULTI_C
+#   define MP_CMP_D_C
+#   define MP_CMP_MAG_C
+#   define MP_COPY_C
+#   define MP_COUNT_BITS_C
+#   define MP_EXCH_C
+#   define MP_EXPTMOD_C
+#   define MP_GROW_C
+#   define MP_INIT_C
+#   define MP_INIT_MULTI_C
+#   define MP_INIT_SIZE_C
+#   define MP_INVMOD_C
+#   define MP_MOD_C
+#   define MP_MONTGOMERY_SETUP_C
+#   define MP_MONT_CTX_CLEAR_C
+#   define MP_MONT_CTX_INIT_C
+#   define MP_MONT_MUL_C
+#   define MP_MONT_SQR_C
+#   define MP_MULMOD_C
+#   define MP_SET_C
+#   define MP_SQRMOD_C
+#   define S_MP_COPY_DIGS_C
+#   define S_MP_EXPTMOD_WINSIZE_C
+#   define S_MP_GET_BIT_C
+#   define S_MP_MONT_MUL_LAZY_C
+#   define S_MP_SUB_C
+#   define S_MP_ZERO_BUF_C
+#   define S_MP_ZERO_DIGS_C
 #endif
 
 #if defined(MP_EXTEUCLID_C)
@@ -325,6 +593,56 @@
 #   define MP_SUB_C
 #endif
 
+#if defined(MP_FIXED_BASE_COUNT_C)
+#endif
+
+#if defined(MP_FIXED_BASE_CTX_CLEAR_C)
+#   define MP_CLEAR_C
+#   define MP_FIXED_BASE_COUNT_C
+#   define MP_MONT_CTX_CLEAR_C
+#   define S_MP_ZERO_BUF_C
+#endif
+
+#if defined(MP_FIXED_BASE_CTX_IMPORT_C)
+#   define MP_CLAMP_C
+#   define MP_CMP_MAG_C
+#   define MP_FIXED_BASE_COUNT_C
+#   define MP_FIXED_BASE_CTX_CLEAR_C
+#   define S_MP_COPY_DIGS_C
+#   define S_MP_FIXED_BASE_SETUP_C
+#endif
+
+#if defined(MP_FIXED_BASE_CTX_INIT_C)
+#   define MP_CLAMP_C
+#   define MP_CLEAR_C
+#   define MP_FIXED_BASE_CTX_CLEAR_C
+#   define MP_INIT_SIZE_C
+#   define MP_MONT_MUL_C
+#   define MP_MONT_SQR_C
+#   define MP_MONT_TO_C
+#   define S_MP_COPY_DIGS_C
+#   define S_MP_FIXED_BASE_SETUP_C
+#   define S_MP_ZERO_DIGS_C
+#endif
+
+#if defined(MP_FIXED_BASE_EXPORT_C)
+#   define MP_FIXED_BASE_COUNT_C
+#   define S_MP_COPY_DIGS_C
+#endif
+
+#if defined(MP_FIXED_BASE_EXPTMOD_C)
+#   define MP_CLAMP_C
+#   define MP_CLEAR_C
+#   define MP_COPY_C
+#   define MP_COUNT_BITS_C
+#   define MP_INIT_SIZE_C
+#   define MP_MONT_EXPTMOD_C
+#   define MP_MONT_FROM_C
+#   define MP_MONT_MUL_C
+#   define MP_MONT_SQR_C
+#   define S_MP_GET_BIT_C
+#endif
+
 #if defined(MP_FREAD_C)
 #   define MP_ADD_D_C
 #   define MP_MUL_D_C
@@ -475,7 +793,7 @@
 #if defined(MP_LCM_C)
 #   define MP_CLEAR_MULTI_C
 #   define MP_CMP_MAG_C
-#   define MP_DIV_C
+#   define MP_DIVEXACT_C
 #   define MP_GCD_C
 #   define MP_INIT_MULTI_C
 #   define MP_MUL_C
@@ -489,9 +807,9 @@
 #   define MP_CMP_D_C
 #   define MP_CNT_LSB_C
 #   define MP_COUNT_BITS_C
+#   define MP_DIVEXACT_C
 #   define MP_DIV_2_C
 #   define MP_DIV_C
-#   define MP_DIV_D_C
 #   define MP_EXPT_N_C
 #   define MP_GET_I32_C
 #   define MP_INIT_C
@@ -526,6 +844,71 @@
 #   define S_MP_ZERO_DIGS_C
 #endif
 
+#if defined(MP_MONT_CTX_CLEAR_C)
+#   define MP_CLEAR_MULTI_C
+#endif
+
+#if defined(MP_MONT_CTX_INIT_C)
+#   define MP_2EXPT_C
+#   define MP_CLEAR_MULTI_C
+#   define MP_COPY_C
+#   define MP_COUNT_BITS_C
+#   define MP_INIT_MULTI_C
+#   define MP_MOD_C
+#   define MP_MONTGOMERY_SETUP_C
+#   define MP_SQRMOD_C
+#   define S_MP_CPU_IFMA_C
+#   define S_MP_IFMA_RR_C
+#   define S_MP_INVMOD_RADIX_C
+#endif
+
+#if defined(MP_MONT_EXPTMOD_C)
+#   define MP_CLEAR_C
+#   define MP_COPY_C
+#   define MP_COUNT_BITS_C
+#   define MP_INIT_SIZE_C
+#   define MP_MONT_FROM_C
+#   define MP_MONT_MUL_C
+#   define MP_MONT_SQR_C
+#   define MP_MONT_TO_C
+#   define S_MP_CPU_IFMA_C
+#   define S_MP_EXPTMOD_IFMA_C
+#   define S_MP_EXPTMOD_WINDOW_C
+#   define S_MP_EXPTMOD_WINSIZE_C
+#   define S_MP_ZERO_BUF_C
+#endif
+
+#if defined(MP_MONT_FROM_C)
+#   define MP_COPY_C
+#   define MP_MONTGOMERY_REDUCE_C
+#   define S_MP_MONTGOMERY_REDUCE_MUL_C
+#endif
+
+#if defined(MP_MONT_MUL_C)
+#   define MP_CLEAR_C
+#   define MP_INIT_C
+#   define MP_MOD_C
+#   define MP_MONTGOMERY_REDUCE_C
+#   define MP_MONT_FROM_C
+#   define MP_MUL_C
+#   define S_MP_CPU_ADX_C
+#   define S_MP_MONTGOMERY_REDUCE_MUL_C
+#   define S_MP_MONT_MUL_COMBA_C
+#endif
+
+#if defined(MP_MONT_SQR_C)
+#   define MP_MONTGOMERY_REDUCE_C
+#   define MP_MONT_MUL_C
+#   define MP_MUL_C
+#   define S_MP_MONTGOMERY_REDUCE_MUL_C
+#endif
+
+#if defined(MP_MONT_TO_C)
+#   define MP_CMP_MAG_C
+#   define MP_MOD_C
+#   define MP_MONT_MUL_C
+#endif
+
 #if defined(MP_MONTGOMERY_CALC_NORMALIZATION_C)
 #   define MP_2EXPT_C
 #   define MP_CMP_MAG_C
@@ -540,6 +923,8 @@
 #   define MP_CMP_MAG_C
 #   define MP_GROW_C
 #   define MP_RSHD_C
+#   define S_MP_CPU_ADX_C
+#   define S_MP_MONTGOMERY_REDUCE_ADX_C
 #   define S_MP_MONTGOMERY_REDUCE_COMBA_C
 #   define S_MP_SUB_C
 #endif
@@ -548,14 +933,24 @@
 #endif
 
 #if defined(MP_MUL_C)
+#   define S_MP_CPU_ADX_C
+#   define S_MP_MUL_ADX_C
 #   define S_MP_MUL_BALANCE_C
 #   define S_MP_MUL_C
 #   define S_MP_MUL_COMBA_C
+#   define S_MP_MUL_FFT_C
 #   define S_MP_MUL_KARATSUBA_C
+#   define S_MP_MUL_TOOM32_C
+#   define S_MP_MUL_TOOM42_C
+#   define S_MP_MUL_TOOM4_C
+#   define S_MP_MUL_TOOM53_C
 #   define S_MP_MUL_TOOM_C
+#   define S_MP_SQR_ADX_C
 #   define S_MP_SQR_C
 #   define S_MP_SQR_COMBA_C
+#   define S_MP_SQR_FFT_C
 #   define S_MP_SQR_KARATSUBA_C
+#   define S_MP_SQR_TOOM4_C
 #   define S_MP_SQR_TOOM_C
 #endif
 
@@ -580,9 +975,38 @@
 #   define S_MP_ZERO_DIGS_C
 #endif
 
+#if defined(MP_MUL_HIGH_C)
+#   define MP_CLAMP_C
+#   define MP_CLEAR_MULTI_C
+#   define MP_EXCH_C
+#   define MP_GROW_C
+#   define MP_INIT_MULTI_C
+#   define MP_MUL_C
+#   define MP_RSHD_C
+#   define MP_SET_L_C
+#   define S_MP_ADD_C
+#   define S_MP_COPY_DIGS_C
+#   define S_MP_MUL_HIGH_C
+#endif
+
+#if defined(MP_MUL_LOW_C)
+#   define MP_MOD_2D_C
+#   define MP_MUL_C
+#   define S_MP_CPU_ADX_C
+#   define S_MP_MUL_ADX_C
+#   define S_MP_MUL_C
+#   define S_MP_MUL_COMBA_C
+#   define S_MP_MUL_LOW_MULDERS_C
+#endif
+
+#if defined(MP_MUL_THREADS_C)
+#endif
+
 #if defined(MP_MULMOD_C)
 #   define MP_MOD_C
 #   define MP_MUL_C
+#   define S_MP_SOLINAS_FIND_C
+#   define S_MP_SOLINAS_MULMOD_C
 #endif
 
 #if defined(MP_NEG_C)
@@ -667,11 +1091,11 @@
 #   define MP_ADD_D_C
 #   define MP_CLEAR_C
 #   define MP_CMP_D_C
-#   define MP_DIV_D_C
 #   define MP_INIT_C
 #   define MP_PRIME_IS_PRIME_C
 #   define MP_SET_C
 #   define MP_SUB_D_C
+#   define S_MP_MOD_D_MULTI_C
 #endif
 
 #if defined(MP_PRIME_RABIN_MILLER_TRIALS_C)
@@ -740,47 +1164,25 @@
 #endif
 
 #if defined(MP_REDUCE_C)
-#   define MP_ADD_C
-#   define MP_CLEAR_C
-#   define MP_CMP_C
-#   define MP_CMP_D_C
-#   define MP_INIT_COPY_C
-#   define MP_LSHD_C
-#   define MP_MOD_2D_C
-#   define MP_MUL_C
-#   define MP_RSHD_C
-#   define MP_SET_C
-#   define MP_SUB_C
-#   define S_MP_MUL_C
-#   define S_MP_MUL_HIGH_C
-#   define S_MP_MUL_HIGH_COMBA_C
-#   define S_MP_SUB_C
+#   define MP_CLEAR_MULTI_C
+#   define MP_INIT_MULTI_C
+#   define S_MP_REDUCE_C
 #endif
 
 #if defined(MP_REDUCE_2K_C)
 #   define MP_CLEAR_C
-#   define MP_CMP_MAG_C
-#   define MP_COUNT_BITS_C
-#   define MP_DIV_2D_C
 #   define MP_INIT_C
-#   define MP_MUL_D_C
-#   define S_MP_ADD_C
-#   define S_MP_SUB_C
+#   define S_MP_REDUCE_2K_C
 #endif
 
 #if defined(MP_REDUCE_2K_L_C)
-#   define MP_CLEAR_C
-#   define MP_CMP_MAG_C
-#   define MP_COUNT_BITS_C
-#   define MP_DIV_2D_C
-#   define MP_INIT_C
-#   define MP_MUL_C
-#   define S_MP_ADD_C
-#   define S_MP_SUB_C
-#endif
-
-#if defined(MP_REDUCE_2K_SETUP_C)
-#   define MP_2EXPT_C
+#   define MP_CLEAR_MULTI_C
+#   define MP_INIT_MULTI_C
+#   define S_MP_REDUCE_2K_L_C
+#endif
+
+#if defined(MP_REDUCE_2K_SETUP_C)
+#   define MP_2EXPT_C
 #   define MP_CLEAR_C
 #   define MP_COUNT_BITS_C
 #   define MP_INIT_C
@@ -880,6 +1282,8 @@
 #if defined(MP_SQRMOD_C)
 #   define MP_MOD_C
 #   define MP_MUL_C
+#   define S_MP_SOLINAS_FIND_C
+#   define S_MP_SOLINAS_MULMOD_C
 #endif
 
 #if defined(MP_SQRT_C)
@@ -972,14 +1376,77 @@
 #   define S_MP_ZERO_DIGS_C
 #endif
 
+#if defined(S_MP_ADDMUL_ADX_C)
+#endif
+
+#if defined(S_MP_COMBA_COLUMN_C)
+#endif
+
 #if defined(S_MP_COPY_DIGS_C)
 #endif
 
+#if defined(S_MP_CPU_ADX_C)
+#endif
+
+#if defined(S_MP_CPU_IFMA_C)
+#endif
+
 #if defined(S_MP_DIV_3_C)
 #   define MP_CLAMP_C
+#   define MP_GROW_C
+#   define S_MP_ZERO_DIGS_C
+#endif
+
+#if defined(S_MP_DIV_3BY2_C)
+#endif
+
+#if defined(S_MP_DIV_BARRETT_C)
+#   define MP_2EXPT_C
+#   define MP_ADD_C
+#   define MP_ADD_D_C
+#   define MP_CLAMP_C
 #   define MP_CLEAR_C
+#   define MP_CLEAR_MULTI_C
+#   define MP_CMP_C
+#   define MP_COPY_C
+#   define MP_COUNT_BITS_C
 #   define MP_EXCH_C
-#   define MP_INIT_SIZE_C
+#   define MP_GROW_C
+#   define MP_INIT_C
+#   define MP_INIT_MULTI_C
+#   define MP_LSHD_C
+#   define MP_MOD_2D_C
+#   define MP_MUL_HIGH_C
+#   define MP_MUL_LOW_C
+#   define MP_RSHD_C
+#   define MP_SUB_C
+#   define MP_SUB_D_C
+#   define MP_ZERO_C
+#   define S_MP_COPY_DIGS_C
+#   define S_MP_SUB_C
+#endif
+
+#if defined(S_MP_DIV_NEWTON_C)
+#   define MP_CLEAR_MULTI_C
+#   define MP_DIV_2D_C
+#   define MP_EXCH_C
+#   define MP_INIT_MULTI_C
+#   define MP_MUL_2D_C
+#   define S_MP_DIV_BARRETT_C
+#   define S_MP_DIV_RECIP_C
+#endif
+
+#if defined(S_MP_DIV_RECIP_C)
+#   define MP_2EXPT_C
+#   define MP_ADD_C
+#   define MP_CLEAR_MULTI_C
+#   define MP_COPY_C
+#   define MP_INIT_MULTI_C
+#   define MP_LSHD_C
+#   define MP_MUL_HIGH_C
+#   define MP_RSHD_C
+#   define MP_SUB_C
+#   define S_MP_DIV_SCHOOL_C
 #endif
 
 #if defined(S_MP_DIV_RECURSIVE_C)
@@ -1035,38 +1502,123 @@
 #endif
 
 #if defined(S_MP_EXPTMOD_C)
-#   define MP_CLEAR_C
+#   define MP_CLEAR_MULTI_C
 #   define MP_COPY_C
 #   define MP_COUNT_BITS_C
 #   define MP_EXCH_C
-#   define MP_INIT_C
+#   define MP_INIT_MULTI_C
 #   define MP_MOD_C
-#   define MP_MUL_C
-#   define MP_REDUCE_2K_L_C
 #   define MP_REDUCE_2K_SETUP_L_C
-#   define MP_REDUCE_C
 #   define MP_REDUCE_SETUP_C
 #   define MP_SET_C
+#   define S_MP_EXPTMOD_WINSIZE_C
+#   define S_MP_MUL_SCRATCH_C
+#   define S_MP_REDUCE_2K_L_C
+#   define S_MP_REDUCE_C
+#   define S_MP_SCRATCH_CLEAR_C
+#   define S_MP_SCRATCH_GET_C
+#   define S_MP_SCRATCH_INIT_C
+#   define S_MP_SCRATCH_SIZE_C
 #endif
 
 #if defined(S_MP_EXPTMOD_FAST_C)
-#   define MP_CLEAR_C
+#   define MP_CLEAR_MULTI_C
 #   define MP_COPY_C
 #   define MP_COUNT_BITS_C
 #   define MP_DR_REDUCE_C
 #   define MP_DR_SETUP_C
 #   define MP_EXCH_C
-#   define MP_INIT_SIZE_C
+#   define MP_INIT_MULTI_C
 #   define MP_MOD_C
 #   define MP_MONTGOMERY_CALC_NORMALIZATION_C
 #   define MP_MONTGOMERY_REDUCE_C
 #   define MP_MONTGOMERY_SETUP_C
+#   define MP_MONT_CTX_CLEAR_C
+#   define MP_MONT_CTX_INIT_C
+#   define MP_MONT_EXPTMOD_C
 #   define MP_MULMOD_C
-#   define MP_MUL_C
-#   define MP_REDUCE_2K_C
 #   define MP_REDUCE_2K_SETUP_C
 #   define MP_SET_C
+#   define S_MP_CPU_ADX_C
+#   define S_MP_CPU_IFMA_C
+#   define S_MP_EXPTMOD_IFMA_C
+#   define S_MP_EXPTMOD_LAZY_C
+#   define S_MP_EXPTMOD_WINSIZE_C
+#   define S_MP_MONTGOMERY_REDUCE_ADX_C
 #   define S_MP_MONTGOMERY_REDUCE_COMBA_C
+#   define S_MP_MUL_SCRATCH_C
+#   define S_MP_REDUCE_2K_C
+#   define S_MP_SCRATCH_CLEAR_C
+#   define S_MP_SCRATCH_GET_C
+#   define S_MP_SCRATCH_INIT_C
+#   define S_MP_SCRATCH_SIZE_C
+#endif
+
+#if defined(S_MP_EXPTMOD_IFMA_C)
+#   define MP_CLAMP_C
+#   define MP_CLEAR_C
+#   define MP_CMP_MAG_C
+#   define MP_COUNT_BITS_C
+#   define MP_EXCH_C
+#   define MP_GROW_C
+#   define MP_INIT_SIZE_C
+#   define MP_MOD_C
+#   define S_MP_GET_BIT_C
+#   define S_MP_IFMA_RR_C
+#   define S_MP_SUB_C
+#   define S_MP_ZERO_BUF_C
+#   define S_MP_ZERO_DIGS_C
+#endif
+
+#if defined(S_MP_EXPTMOD_LAZY_C)
+#   define MP_2EXPT_C
+#   define MP_CLAMP_C
+#   define MP_CLEAR_MULTI_C
+#   define MP_CMP_MAG_C
+#   define MP_COUNT_BITS_C
+#   define MP_EXCH_C
+#   define MP_GROW_C
+#   define MP_INIT_MULTI_C
+#   define MP_MOD_C
+#   define MP_MONTGOMERY_SETUP_C
+#   define MP_MULMOD_C
+#   define S_MP_COPY_DIGS_C
+#   define S_MP_EXPTMOD_WINDOW_C
+#   define S_MP_EXPTMOD_WINSIZE_C
+#   define S_MP_MONT_MUL_LAZY_C
+#   define S_MP_SUB_C
+#   define S_MP_ZERO_BUF_C
+#   define S_MP_ZERO_DIGS_C
+#endif
+
+#if defined(S_MP_EXPTMOD_SOLINAS_C)
+#   define MP_CLEAR_C
+#   define MP_COUNT_BITS_C
+#   define MP_EXCH_C
+#   define MP_INIT_SIZE_C
+#   define MP_MOD_C
+#   define S_MP_EXPTMOD_WINDOW_C
+#   define S_MP_EXPTMOD_WINSIZE_C
+#   define S_MP_FROM_WORDS_C
+#   define S_MP_SOLINAS_MUL_C
+#   define S_MP_TO_WORDS_C
+#endif
+
+#if defined(S_MP_EXPTMOD_WINDOW_C)
+#   define MP_COUNT_BITS_C
+#   define S_MP_GET_BIT_C
+#endif
+
+#if defined(S_MP_EXPTMOD_WINSIZE_C)
+#endif
+
+#if defined(S_MP_FIXED_BASE_SETUP_C)
+#   define MP_CLEAR_C
+#   define MP_FIXED_BASE_COUNT_C
+#   define MP_INIT_C
+#   define MP_MOD_C
+#   define MP_MONT_CTX_CLEAR_C
+#   define MP_MONT_CTX_INIT_C
 #endif
 
 #if defined(S_MP_FP_LOG_C)
@@ -1095,9 +1647,21 @@
 #   define S_MP_FP_LOG_FRACTION_D_C
 #endif
 
+#if defined(S_MP_FROM_WORDS_C)
+#   define MP_CLAMP_C
+#   define MP_GROW_C
+#   define S_MP_ZERO_DIGS_C
+#endif
+
 #if defined(S_MP_GET_BIT_C)
 #endif
 
+#if defined(S_MP_IFMA_RR_C)
+#   define MP_2EXPT_C
+#   define MP_COUNT_BITS_C
+#   define MP_MOD_C
+#endif
+
 #if defined(S_MP_INVMOD_C)
 #   define MP_ADD_C
 #   define MP_CLEAR_MULTI_C
@@ -1128,36 +1692,99 @@
 #   define MP_SUB_C
 #endif
 
+#if defined(S_MP_INVMOD_RADIX_C)
+#   define MP_2EXPT_C
+#   define MP_ADD_C
+#   define MP_CLEAR_MULTI_C
+#   define MP_INIT_MULTI_C
+#   define MP_LSHD_C
+#   define MP_MOD_2D_C
+#   define MP_MONTGOMERY_SETUP_C
+#   define MP_MUL_LOW_C
+#   define MP_RSHD_C
+#   define MP_SET_C
+#   define MP_SUB_C
+#   define MP_SUB_D_C
+#endif
+
 #if defined(S_MP_LOG_2EXPT_C)
 #   define MP_COUNT_BITS_C
 #endif
 
-#if defined(S_MP_MONTGOMERY_REDUCE_COMBA_C)
+#if defined(S_MP_MOD_D_MULTI_C)
+#endif
+
+#if defined(S_MP_MONT_MUL_COMBA_C)
 #   define MP_CLAMP_C
 #   define MP_CMP_MAG_C
 #   define MP_GROW_C
+#   define S_MP_COPY_DIGS_C
 #   define S_MP_SUB_C
 #   define S_MP_ZERO_BUF_C
 #   define S_MP_ZERO_DIGS_C
 #endif
 
+#if defined(S_MP_MONT_MUL_LAZY_C)
+#   define S_MP_ADDMUL_ADX_C
+#   define S_MP_COMBA_COLUMN_C
+#   define S_MP_COPY_DIGS_C
+#   define S_MP_CPU_ADX_C
+#   define S_MP_ZERO_DIGS_C
+#endif
+
+#if defined(S_MP_MONTGOMERY_REDUCE_ADX_C)
+#   define MP_CLAMP_C
+#   define MP_CMP_MAG_C
+#   define MP_GROW_C
+#   define MP_RSHD_C
+#   define S_MP_ADDMUL_ADX_C
+#   define S_MP_SUB_C
+#endif
+
+#if defined(S_MP_MONTGOMERY_REDUCE_COMBA_C)
+#   define MP_CLAMP_C
+#   define MP_CMP_MAG_C
+#   define MP_GROW_C
+#   define S_MP_COMBA_COLUMN_C
+#   define S_MP_SUB_C
+#   define S_MP_ZERO_DIGS_C
+#endif
+
+#if defined(S_MP_MONTGOMERY_REDUCE_MUL_C)
+#   define MP_ADD_C
+#   define MP_CLEAR_C
+#   define MP_INIT_C
+#   define MP_MOD_2D_C
+#   define MP_MUL_HIGH_C
+#   define MP_MUL_LOW_C
+#   define MP_RSHD_C
+#   define MP_SUB_C
+#endif
+
 #if defined(S_MP_MUL_C)
 #   define MP_CLAMP_C
 #   define MP_CLEAR_C
 #   define MP_EXCH_C
 #   define MP_INIT_SIZE_C
-#   define S_MP_MUL_COMBA_C
+#endif
+
+#if defined(S_MP_MUL_ADX_C)
+#   define MP_CLAMP_C
+#   define MP_CLEAR_C
+#   define MP_EXCH_C
+#   define MP_GROW_C
+#   define MP_INIT_SIZE_C
+#   define S_MP_ADDMUL_ADX_C
+#   define S_MP_ZERO_DIGS_C
 #endif
 
 #if defined(S_MP_MUL_BALANCE_C)
-#   define MP_ADD_C
 #   define MP_CLAMP_C
 #   define MP_CLEAR_C
 #   define MP_CLEAR_MULTI_C
 #   define MP_EXCH_C
-#   define MP_INIT_MULTI_C
+#   define MP_INIT_C
 #   define MP_INIT_SIZE_C
-#   define MP_LSHD_C
 #   define MP_MUL_C
 #   define S_MP_COPY_DIGS_C
 #endif
@@ -1165,53 +1792,171 @@
 #if defined(S_MP_MUL_COMBA_C)
 #   define MP_CLAMP_C
 #   define MP_GROW_C
+#   define S_MP_COMBA_COLUMN_C
+#   define S_MP_COPY_DIGS_C
+#   define S_MP_ZERO_BUF_C
 #   define S_MP_ZERO_DIGS_C
 #endif
 
+#if defined(S_MP_MUL_FFT_C)
+#   define MP_CLAMP_C
+#   define MP_CLEAR_C
+#   define MP_COUNT_BITS_C
+#   define MP_EXCH_C
+#   define MP_INIT_SIZE_C
+#   define MP_ZERO_C
+#   define S_MP_ZERO_BUF_C
+#endif
+
 #if defined(S_MP_MUL_HIGH_C)
 #   define MP_CLAMP_C
 #   define MP_CLEAR_C
 #   define MP_EXCH_C
 #   define MP_INIT_SIZE_C
 #   define S_MP_MUL_HIGH_COMBA_C
+#   define S_MP_MUL_HIGH_MULDERS_C
 #endif
 
 #if defined(S_MP_MUL_HIGH_COMBA_C)
 #   define MP_CLAMP_C
 #   define MP_GROW_C
+#   define S_MP_COMBA_COLUMN_C
+#   define S_MP_COPY_DIGS_C
+#   define S_MP_ZERO_BUF_C
 #   define S_MP_ZERO_DIGS_C
 #endif
 
+#if defined(S_MP_MUL_HIGH_MULDERS_C)
+#   define MP_CLAMP_C
+#   define MP_CLEAR_C
+#   define MP_INIT_SIZE_C
+#   define MP_LSHD_C
+#   define MP_MUL_C
+#   define MP_ZERO_C
+#   define S_MP_ADD_C
+#   define S_MP_COPY_DIGS_C
+#   define S_MP_MUL_HIGH_C
+#endif
+
 #if defined(S_MP_MUL_KARATSUBA_C)
 #   define MP_ADD_C
 #   define MP_CLAMP_C
+#   define MP_LSHD_C
+#   define S_MP_ADD_C
+#   define S_MP_COPY_DIGS_C
+#   define S_MP_MUL_PARALLEL_C
+#   define S_MP_SCRATCH_CLEAR_C
+#   define S_MP_SCRATCH_GET_C
+#   define S_MP_SCRATCH_INIT_C
+#   define S_MP_SCRATCH_SIZE_C
+#   define S_MP_SUB_C
+#endif
+
+#if defined(S_MP_MUL_LOW_MULDERS_C)
+#   define MP_CLAMP_C
 #   define MP_CLEAR_C
 #   define MP_INIT_SIZE_C
 #   define MP_LSHD_C
 #   define MP_MUL_C
+#   define MP_MUL_LOW_C
 #   define S_MP_ADD_C
 #   define S_MP_COPY_DIGS_C
-#   define S_MP_SUB_C
+#   define S_MP_ZERO_DIGS_C
+#endif
+
+#if defined(S_MP_MUL_PARALLEL_C)
+#   define S_MP_MUL_SCRATCH_C
+#endif
+
+#if defined(S_MP_MUL_POOL_RUN_C)
+#endif
+
+#if defined(S_MP_MUL_SCRATCH_C)
+#   define MP_COPY_C
+#   define MP_INIT_C
+#   define MP_MUL_C
+#   define S_MP_CPU_ADX_C
+#   define S_MP_MUL_ADX_C
+#   define S_MP_MUL_COMBA_C
+#   define S_MP_MUL_KARATSUBA_C
+#   define S_MP_MUL_TOOM_C
+#   define S_MP_SCRATCH_SIZE_C
+#   define S_MP_SQR_ADX_C
+#   define S_MP_SQR_COMBA_C
+#   define S_MP_SQR_KARATSUBA_C
+#   define S_MP_SQR_TOOM_C
+#endif
+
+#if defined(S_MP_MUL_TASK_RUN_C)
 #endif
 
 #if defined(S_MP_MUL_TOOM_C)
 #   define MP_ADD_C
 #   define MP_CLAMP_C
-#   define MP_CLEAR_C
+#   define MP_DIV_2_C
+#   define MP_LSHD_C
+#   define MP_MUL_2_C
+#   define MP_SUB_C
+#   define S_MP_COPY_DIGS_C
+#   define S_MP_DIV_3_C
+#   define S_MP_MUL_PARALLEL_C
+#   define S_MP_SCRATCH_CLEAR_C
+#   define S_MP_SCRATCH_GET_C
+#   define S_MP_SCRATCH_INIT_C
+#   define S_MP_SCRATCH_SIZE_C
+#endif
+
+#if defined(S_MP_MUL_TOOM32_C)
+#   define MP_ADD_C
 #   define MP_CLEAR_MULTI_C
 #   define MP_DIV_2_C
 #   define MP_INIT_MULTI_C
-#   define MP_INIT_SIZE_C
 #   define MP_LSHD_C
+#   define MP_MUL_C
+#   define MP_SUB_C
+#   define S_MP_TOOM_SPLIT_C
+#endif
+
+#if defined(S_MP_MUL_TOOM4_C)
+#   define MP_ADD_C
+#   define MP_CLEAR_MULTI_C
+#   define MP_INIT_MULTI_C
+#   define MP_MUL_2D_C
+#   define MP_MUL_2_C
+#   define MP_MUL_C
+#   define MP_SUB_C
+#   define S_MP_TOOM4_INTERPOLATE_C
+#   define S_MP_TOOM_SPLIT_C
+#endif
+
+#if defined(S_MP_MUL_TOOM42_C)
+#   define MP_ADD_C
+#   define MP_CLEAR_MULTI_C
+#   define MP_DIV_2_C
+#   define MP_INIT_MULTI_C
+#   define MP_LSHD_C
+#   define MP_MUL_2D_C
 #   define MP_MUL_2_C
 #   define MP_MUL_C
 #   define MP_SUB_C
-#   define S_MP_COPY_DIGS_C
 #   define S_MP_DIV_3_C
+#   define S_MP_TOOM_SPLIT_C
+#endif
+
+#if defined(S_MP_MUL_TOOM53_C)
+#   define MP_ADD_C
+#   define MP_CLEAR_MULTI_C
+#   define MP_INIT_MULTI_C
+#   define MP_MUL_2D_C
+#   define MP_MUL_2_C
+#   define MP_MUL_C
+#   define MP_SUB_C
+#   define S_MP_TOOM4_INTERPOLATE_C
+#   define S_MP_TOOM_SPLIT_C
 #endif
 
 #if defined(S_MP_PRIME_IS_DIVISIBLE_C)
-#   define MP_DIV_D_C
+#   define S_MP_MOD_D_MULTI_C
 #endif
 
 #if defined(S_MP_PRIME_TAB_C)
@@ -1234,6 +1979,78 @@
 #if defined(S_MP_RAND_PLATFORM_C)
 #endif
 
+#if defined(S_MP_REDUCE_C)
+#   define MP_ADD_C
+#   define MP_CMP_C
+#   define MP_CMP_D_C
+#   define MP_COPY_C
+#   define MP_LSHD_C
+#   define MP_MOD_2D_C
+#   define MP_MUL_C
+#   define MP_MUL_HIGH_C
+#   define MP_MUL_LOW_C
+#   define MP_RSHD_C
+#   define MP_SET_C
+#   define MP_SUB_C
+#   define S_MP_MUL_HIGH_C
+#   define S_MP_MUL_HIGH_COMBA_C
+#   define S_MP_SUB_C
+#endif
+
+#if defined(S_MP_REDUCE_2K_C)
+#   define MP_CMP_MAG_C
+#   define MP_COUNT_BITS_C
+#   define MP_DIV_2D_C
+#   define MP_MUL_D_C
+#   define S_MP_ADD_C
+#   define S_MP_SUB_C
+#endif
+
+#if defined(S_MP_REDUCE_2K_L_C)
+#   define MP_CMP_MAG_C
+#   define MP_COUNT_BITS_C
+#   define MP_DIV_2D_C
+#   define MP_MUL_C
+#   define S_MP_ADD_C
+#   define S_MP_SUB_C
+#endif
+
+#if defined(S_MP_SCRATCH_CLEAR_C)
+#   define MP_CLEAR_C
+#   define S_MP_ZERO_DIGS_C
+#endif
+
+#if defined(S_MP_SCRATCH_GET_C)
+#   define S_MP_ZERO_DIGS_C
+#endif
+
+#if defined(S_MP_SCRATCH_INIT_C)
+#endif
+
+#if defined(S_MP_SCRATCH_SIZE_C)
+#endif
+
+#if defined(S_MP_SOLINAS_FIND_C)
+#   define MP_COUNT_BITS_C
+#   define S_MP_TO_WORDS_C
+#endif
+
+#if defined(S_MP_SOLINAS_MUL_C)
+#endif
+
+#if defined(S_MP_SOLINAS_MULMOD_C)
+#   define MP_CLEAR_MULTI_C
+#   define MP_CMP_MAG_C
+#   define MP_INIT_MULTI_C
+#   define MP_MOD_C
+#   define S_MP_FROM_WORDS_C
+#   define S_MP_SOLINAS_MUL_C
+#   define S_MP_TO_WORDS_C
+#endif
+
+#if defined(S_MP_SOLINAS_TAB_C)
+#endif
+
 #if defined(S_MP_SQR_C)
 #   define MP_CLAMP_C
 #   define MP_CLEAR_C
@@ -1241,36 +2058,68 @@
 #   define MP_INIT_SIZE_C
 #endif
 
+#if defined(S_MP_SQR_ADX_C)
+#   define MP_CLAMP_C
+#   define MP_CLEAR_C
+#   define MP_EXCH_C
+#   define MP_GROW_C
+#   define MP_INIT_SIZE_C
+#   define S_MP_ADDMUL_ADX_C
+#   define S_MP_ZERO_DIGS_C
+#endif
+
 #if defined(S_MP_SQR_COMBA_C)
 #   define MP_CLAMP_C
 #   define MP_GROW_C
+#   define S_MP_COMBA_COLUMN_C
+#   define S_MP_COPY_DIGS_C
+#   define S_MP_ZERO_BUF_C
 #   define S_MP_ZERO_DIGS_C
 #endif
 
+#if defined(S_MP_SQR_FFT_C)
+#   define S_MP_MUL_FFT_C
+#endif
+
 #if defined(S_MP_SQR_KARATSUBA_C)
 #   define MP_ADD_C
 #   define MP_CLAMP_C
-#   define MP_CLEAR_C
-#   define MP_INIT_SIZE_C
 #   define MP_LSHD_C
-#   define MP_MUL_C
 #   define S_MP_ADD_C
 #   define S_MP_COPY_DIGS_C
+#   define S_MP_MUL_SCRATCH_C
+#   define S_MP_SCRATCH_CLEAR_C
+#   define S_MP_SCRATCH_GET_C
+#   define S_MP_SCRATCH_INIT_C
+#   define S_MP_SCRATCH_SIZE_C
 #   define S_MP_SUB_C
 #endif
 
 #if defined(S_MP_SQR_TOOM_C)
 #   define MP_ADD_C
 #   define MP_CLAMP_C
-#   define MP_CLEAR_C
 #   define MP_DIV_2_C
-#   define MP_INIT_C
-#   define MP_INIT_SIZE_C
 #   define MP_LSHD_C
 #   define MP_MUL_2_C
-#   define MP_MUL_C
 #   define MP_SUB_C
 #   define S_MP_COPY_DIGS_C
+#   define S_MP_MUL_PARALLEL_C
+#   define S_MP_SCRATCH_CLEAR_C
+#   define S_MP_SCRATCH_GET_C
+#   define S_MP_SCRATCH_INIT_C
+#   define S_MP_SCRATCH_SIZE_C
+#endif
+
+#if defined(S_MP_SQR_TOOM4_C)
+#   define MP_ADD_C
+#   define MP_CLEAR_MULTI_C
+#   define MP_INIT_MULTI_C
+#   define MP_MUL_2D_C
+#   define MP_MUL_2_C
+#   define MP_MUL_C
+#   define MP_SUB_C
+#   define S_MP_TOOM4_INTERPOLATE_C
+#   define S_MP_TOOM_SPLIT_C
 #endif
 
 #if defined(S_MP_SUB_C)
@@ -1279,6 +2128,29 @@
 #   define S_MP_ZERO_DIGS_C
 #endif
 
+#if defined(S_MP_TO_WORDS_C)
+#endif
+
+#if defined(S_MP_TOOM4_INTERPOLATE_C)
+#   define MP_ADD_C
+#   define MP_CLEAR_C
+#   define MP_DIV_2D_C
+#   define MP_DIV_2_C
+#   define MP_DIV_D_C
+#   define MP_INIT_C
+#   define MP_LSHD_C
+#   define MP_MUL_2D_C
+#   define MP_MUL_D_C
+#   define MP_SUB_C
+#   define S_MP_DIV_3_C
+#endif
+
+#if defined(S_MP_TOOM_SPLIT_C)
+#   define MP_CLAMP_C
+#   define MP_GROW_C
+#   define S_MP_COPY_DIGS_C
+#endif
+
 #if defined(S_MP_ZERO_BUF_C)
 #endif
 
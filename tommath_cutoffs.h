@@ -11,3 +11,10 @@
 #define MP_DEFAULT_SQR_KARATSUBA_CUTOFF 120
 #define MP_DEFAULT_MUL_TOOM_CUTOFF      350
 #define MP_DEFAULT_SQR_TOOM_CUTOFF      400
+#define MP_DEFAULT_MUL_TOOM4_CUTOFF     1200
+#define MP_DEFAULT_SQR_TOOM4_CUTOFF     1000
+#define MP_DEFAULT_MUL_FFT_CUTOFF       7500
+#define MP_DEFAULT_SQR_FFT_CUTOFF       7000
+#define MP_DEFAULT_MUL_PARALLEL_CUTOFF  1000
+#define MP_DEFAULT_DIV_NEWTON_CUTOFF    100
+#define MP_DEFAULT_REDUCE_MUL_CUTOFF    800
@@ -7,6 +7,9 @@
 #include "tommath.h"
 #include "tommath_class.h"
 #include <limits.h>
+#ifdef MP_USE_PTHREADS
+#include <pthread.h>
+#endif
 
 /*
  * Private symbols
@@ -86,8 +89,21 @@ do {                                                    \
 #  define MP_SQR_KARATSUBA_CUTOFF MP_DEFAULT_SQR_KARATSUBA_CUTOFF
 #  define MP_MUL_TOOM_CUTOFF      MP_DEFAULT_MUL_TOOM_CUTOFF
 #  define MP_SQR_TOOM_CUTOFF      MP_DEFAULT_SQR_TOOM_CUTOFF
+#  define MP_MUL_TOOM4_CUTOFF     MP_DEFAULT_MUL_TOOM4_CUTOFF
+#  define MP_SQR_TOOM4_CUTOFF     MP_DEFAULT_SQR_TOOM4_CUTOFF
+#  define MP_MUL_FFT_CUTOFF       MP_DEFAULT_MUL_FFT_CUTOFF
+#  define MP_SQR_FFT_CUTOFF       MP_DEFAULT_SQR_FFT_CUTOFF
+#  define MP_MUL_PARALLEL_CUTOFF  MP_DEFAULT_MUL_PARALLEL_CUTOFF
+#  define MP_DIV_NEWTON_CUTOFF    MP_DEFAULT_DIV_NEWTON_CUTOFF
+#  define MP_REDUCE_MUL_CUTOFF    MP_DEFAULT_REDUCE_MUL_CUTOFF
 #endif
 
+/* Mulders' short products pay off once the full product of 0.7 of the
+ * digits is well into Karatsuba
+ */
+#define MP_MUL_LOW_CUTOFF  (2 * MP_MUL_KARATSUBA_CUTOFF)
+#define MP_MUL_HIGH_CUTOFF (2 * MP_MUL_KARATSUBA_CUTOFF)
+
 /* define heap macros */
 #ifndef MP_MALLOC
 /* default to libc stuff */
@@ -130,8 +146,21 @@ extern void MP_FREE(void *mem, size_t size);
 
 #define MP_SIZEOF_BITS(type)    ((size_t)CHAR_BIT * sizeof(type))
 
+#ifdef MP_64BIT_FULL
+/* The column sums of the comba kernels carry into a third digit with every product, see MP_COMBA_ADD */
+#define MP_COMBA_BLOCK          INT_MAX
+#else
+/* The number of products that fit into the mp_word, the comba kernels sum longer columns
+ * than MP_COMBA_BLOCK products in blocks, see MP_COMBA_FOLD */
 #define MP_MAX_COMBA            (int)(1uL << (MP_SIZEOF_BITS(mp_word) - (2u * (size_t)MP_DIGIT_BIT)))
-#define MP_WARRAY               (int)(1uL << ((MP_SIZEOF_BITS(mp_word) - (2u * (size_t)MP_DIGIT_BIT)) + 1u))
+#define MP_COMBA_BLOCK          ((MP_MAX_COMBA / 2) - 1)
+#endif
+
+/* Digits of the product the comba kernels keep on the stack if the destination is also a source */
+#define MP_COMBA_STACK          128
+
+/* Maximum of a->used + b->used for s_mp_mul_fft, the transform length is limited to 2^24 32-bit coefficients */
+#define MP_FFT_MAX_DIGIT_COUNT  (int)((((1uL << 24) - 1uL) * 32uL) / (unsigned long)MP_DIGIT_BIT)
 
 #if defined(MP_16BIT)
 typedef uint32_t mp_word;
@@ -146,6 +175,80 @@ typedef uint64_t mp_word;
 
 MP_STATIC_ASSERT(correct_word_size, sizeof(mp_word) == (2u * sizeof(mp_digit)))
 
+/* Column accumulator of the comba kernels: a mp_word "W" and an overflow digit "C"
+ * worth B**2 each.
+ *
+ * With full-radix digits a single product can fill the mp_word, so the carries
+ * out of it are counted in "C".
+ *
+ * With nail bits MP_MAX_COMBA products fit into the mp_word and "C" stays zero
+ * for columns of up to MP_COMBA_BLOCK products.  Longer ones are summed by
+ * s_mp_comba_column() in blocks of that size with MP_COMBA_FOLD after each, it
+ * moves the bits above B**2 into "C" (carry-save).  So the products stay at one
+ * add each, whatever the length of the column.
+ */
+#ifdef MP_64BIT_FULL
+#   define MP_COMBA_ADD(W, C, x)  do { mp_word t_ = (x); (W) += t_; (C) += (mp_digit)((W) < t_); } while (0)
+#   define MP_COMBA_FOLD(W, C)    do { } while (0)
+#   define MP_COMBA_DBL(W, C)     do { (C) = ((C) << 1) | (mp_digit)((W) >> ((2 * MP_DIGIT_BIT) - 1)); (W) <<= 1; } while (0)
+#   define MP_COMBA_SHIFT(W, C)   do { (W) = ((W) >> MP_DIGIT_BIT) | ((mp_word)(C) << MP_DIGIT_BIT); (C) = 0; } while (0)
+#else
+#   define MP_COMBA_ADD(W, C, x)  do { (W) += (x); (void)(C); } while (0)
+#   define MP_COMBA_FOLD(W, C)    do {                                              \
+      (C) += (mp_digit)((W) >> (2 * MP_DIGIT_BIT));                                 \
+      (W) &= ((mp_word)1 << (2 * MP_DIGIT_BIT)) - 1u;                               \
+   } while (0)
+#   define MP_COMBA_DBL(W, C)     do { (W) += (W); (C) += (C); } while (0)
+#   define MP_COMBA_SHIFT(W, C)   do {                                              \
+      (W) >>= MP_DIGIT_BIT;                                                         \
+      if ((C) != 0u) {                                                              \
+         (W) += (mp_word)(C) << MP_DIGIT_BIT;                                       \
+         (C) = 0;                                                                   \
+      }                                                                             \
+   } while (0)
+#endif
+
+/* <q,r> = <u1,u0> / d for u1 < d and the normalized d >= B/2 with the reciprocal
+ * v = (B**2 - 1) / d - B of MP_DIV_2BY1_RECIP, no division needed.
+ *
+ * Algorithm 4 of: Moeller, Niels, and Torbjoern Granlund. "Improved division
+ * by invariant integers." IEEE Transactions on Computers 60.2 (2011)
+ */
+#define MP_DIV_2BY1_RECIP(d)  ((mp_digit)((((mp_word)MP_MASK << MP_DIGIT_BIT) | (mp_word)MP_MASK) / (mp_word)(d)) & MP_MASK)
+#define MP_DIV_2BY1(q, r, u1, u0, d, v)  do {                                      \
+      mp_word  t_ = ((mp_word)(v) * (mp_word)(u1)) + (((mp_word)(u1) << MP_DIGIT_BIT) | (mp_word)(u0)); \
+      mp_digit q_ = ((mp_digit)(t_ >> MP_DIGIT_BIT) + 1u) & MP_MASK,               \
+               r_ = (mp_digit)((u0) - (q_ * (d))) & MP_MASK;                        \
+      if (r_ > ((mp_digit)t_ & MP_MASK)) {                                          \
+         q_ = (q_ - 1u) & MP_MASK;                                                  \
+         r_ = (r_ + (d)) & MP_MASK;                                                 \
+      }                                                                             \
+      if (r_ >= (d)) {                                                              \
+         q_++;                                                                      \
+         r_ -= (d);                                                                 \
+      }                                                                             \
+      (q) = q_;                                                                     \
+      (r) = r_;                                                                     \
+   } while (0)
+
+/* The x86-64 BMI2/ADX kernels need full-radix digits and GCC compatible inline assembly.
+ * They are selected at runtime, s_mp_cpu_adx() is always false otherwise.
+ */
+#if defined(MP_64BIT_FULL) && defined(__x86_64__) && defined(__GNUC__) && !defined(MP_NO_ASM)
+#   define MP_ADX_ASM
+#endif
+
+/* The AVX-512 IFMA exponentiation needs GCC compatible target attributes on x86-64.
+ * It is selected at runtime for odd moduli of MP_IFMA_MIN_BITS to MP_IFMA_MAX_BITS bits,
+ * s_mp_cpu_ifma() is always false otherwise.
+ */
+#if defined(__x86_64__) && defined(__GNUC__) && !defined(MP_NO_ASM)
+#   define MP_IFMA_INTRIN
+#endif
+#define MP_IFMA_MIN_BITS 640
+#define MP_IFMA_MAX_BITS 8192
+#define MP_IFMA_LIMB_BITS 52
+
 /* default number of digits */
 #ifndef MP_DEFAULT_DIGIT_COUNT
 #   ifndef MP_LOW_MEM
@@ -192,6 +295,77 @@ MP_STATIC_ASSERT(min_prec_geq_uint64size,
 #define S_MP_WORD_TOO_SMALL_C
 #endif
 
+/* Scratch space of the recursive multiplications.
+ *
+ * The temporaries of Karatsuba and Toom-Cook are carved out of one allocation
+ * with s_mp_scratch_get() and given back in stack order by resetting "used".
+ * They must be big enough to never grow and must neither be cleared nor exchanged.
+ * The products that are not computed in place are computed in "t" and copied.
+ */
+typedef struct {
+   mp_digit *dp;
+   int used, alloc;
+   mp_int t;
+} mp_scratch;
+
+/* The arithmetic of a sliding window exponentiation, see s_mp_exptmod_window().
+ *
+ * The values are opaque to it.  M holds the odd powers of "size" bytes each,
+ * res the result and "one" the one to copy for an exponent of zero.  The
+ * callbacks get "ctx" and may work in place.
+ */
+typedef struct {
+   mp_err(*mul)(const void *ctx, const void *a, const void *b, void *c);
+   mp_err(*sqr)(const void *ctx, const void *a, void *c);
+   mp_err(*copy)(const void *ctx, const void *a, void *c);
+   const void *ctx, *one;
+   void *M, *res;
+   size_t size;
+} mp_window;
+
+#ifdef MP_USE_PTHREADS
+/* One product of s_mp_mul_parallel(), computed by whichever thread takes it first.
+ * With run it is run(arg) instead, see mp_exptmod_batch().
+ */
+typedef struct mp_mul_task {
+   const mp_int *a, *b;
+   mp_int c;
+   mp_err err;
+   void (*run)(void *arg);
+   void *arg;
+   int *pending;
+   struct mp_mul_task *next;
+} mp_mul_task;
+
+/* The worker threads of mp_mul_threads() and the queue of their tasks,
+ * everything but "threads" is guarded by "lock".
+ */
+typedef struct {
+   pthread_mutex_t lock;
+   pthread_cond_t work, done;
+   pthread_t *threads;
+   int workers;
+   bool stop;
+   mp_mul_task *queue;
+} mp_mul_pool;
+
+extern MP_PRIVATE mp_mul_pool s_mp_mul_pool;
+MP_PRIVATE void s_mp_mul_pool_run(mp_mul_task *task, int n);
+#  define MP_MUL_WORKERS s_mp_mul_pool.workers
+#else
+#  define MP_MUL_WORKERS 0
+#endif
+
+/* A generalized Mersenne modulus p = 2**bits - d of the registry s_mp_solinas_tab,
+ * d = sum(d[i] * 2**(32 * i)) with small coefficients, see s_mp_solinas_mul().
+ */
+#define MP_SOLINAS_D_WORDS   8
+#define MP_SOLINAS_MAX_WORDS 17
+typedef struct {
+   int bits;
+   int d[MP_SOLINAS_D_WORDS];
+} mp_solinas;
+
 /* random number source */
 extern MP_PRIVATE mp_err(*s_mp_rand_source)(void *out, size_t size);
 
@@ -200,29 +374,78 @@ MP_PRIVATE bool s_mp_get_bit(const mp_int *a, int b) MP_WUR;
 MP_PRIVATE int s_mp_log_2expt(const mp_int *a, mp_digit base) MP_WUR;
 
 MP_PRIVATE mp_err s_mp_add(const mp_int *a, const mp_int *b, mp_int *c) MP_WUR;
+MP_PRIVATE mp_digit s_mp_addmul_adx(mp_digit *r, const mp_digit *a, int n, mp_digit b);
+MP_PRIVATE mp_word s_mp_comba_column(const mp_digit *x, const mp_digit *y, int n, mp_digit *hi) MP_WUR;
+MP_PRIVATE bool s_mp_cpu_adx(void) MP_WUR;
+MP_PRIVATE bool s_mp_cpu_ifma(void) MP_WUR;
 MP_PRIVATE mp_err s_mp_div_3(const mp_int *a, mp_int *c, mp_digit *d) MP_WUR;
+MP_PRIVATE mp_digit s_mp_div_3by2(mp_digit u2, mp_digit u1, mp_digit u0, mp_digit d1, mp_digit d0, mp_digit v) MP_WUR;
+MP_PRIVATE mp_err s_mp_div_barrett(const mp_int *a, const mp_int *b, const mp_int *x, int p, mp_int *q, mp_int *r) MP_WUR;
+MP_PRIVATE mp_err s_mp_div_newton(const mp_int *a, const mp_int *b, mp_int *q, mp_int *r) MP_WUR;
+MP_PRIVATE mp_err s_mp_div_recip(const mp_int *b, int p, mp_int *x) MP_WUR;
 MP_PRIVATE mp_err s_mp_div_recursive(const mp_int *a, const mp_int *b, mp_int *q, mp_int *r) MP_WUR;
 MP_PRIVATE mp_err s_mp_div_school(const mp_int *a, const mp_int *b, mp_int *c, mp_int *d) MP_WUR;
 MP_PRIVATE mp_err s_mp_div_small(const mp_int *a, const mp_int *b, mp_int *c, mp_int *d) MP_WUR;
 MP_PRIVATE mp_err s_mp_exptmod(const mp_int *G, const mp_int *X, const mp_int *P, mp_int *Y, int redmode) MP_WUR;
 MP_PRIVATE mp_err s_mp_exptmod_fast(const mp_int *G, const mp_int *X, const mp_int *P, mp_int *Y, int redmode) MP_WUR;
+MP_PRIVATE mp_err s_mp_exptmod_ifma(const mp_int *G, const mp_int *X, const mp_int *P, const mp_int *rr, mp_int *Y) MP_WUR;
+MP_PRIVATE mp_err s_mp_exptmod_lazy(const mp_int *G, const mp_int *X, const mp_int *P, mp_int *Y) MP_WUR;
+MP_PRIVATE mp_err s_mp_exptmod_solinas(const mp_int *G, const mp_int *X, const mp_int *P, mp_int *Y, int form) MP_WUR;
+MP_PRIVATE mp_err s_mp_exptmod_window(const mp_window *w, const mp_int *X, int winsize) MP_WUR;
+MP_PRIVATE int s_mp_exptmod_winsize(int bits) MP_WUR;
+MP_PRIVATE mp_err s_mp_fixed_base_setup(mp_fixed_base_ctx *ctx, const mp_int *G, const mp_int *n, int bits) MP_WUR;
+MP_PRIVATE mp_err s_mp_from_words(const uint32_t *w, int n, mp_int *a) MP_WUR;
+MP_PRIVATE mp_err s_mp_ifma_rr(const mp_int *P, mp_int *rr) MP_WUR;
 MP_PRIVATE mp_err s_mp_invmod(const mp_int *a, const mp_int *b, mp_int *c) MP_WUR;
 MP_PRIVATE mp_err s_mp_invmod_odd(const mp_int *a, const mp_int *b, mp_int *c) MP_WUR;
+MP_PRIVATE mp_err s_mp_invmod_radix(const mp_int *b, int n, mp_int *x) MP_WUR;
+MP_PRIVATE mp_err s_mp_mod_d_multi(const mp_int *a, const mp_digit *b, int n, mp_digit *r) MP_WUR;
 
+MP_PRIVATE mp_err s_mp_mont_mul_comba(const mp_int *a, const mp_int *b, mp_int *c, const mp_int *n, mp_digit rho) MP_WUR;
+MP_PRIVATE void s_mp_mont_mul_lazy(const mp_digit *a, const mp_digit *b, mp_digit *c, const mp_digit *n, int nu, mp_digit rho, mp_digit *t);
+MP_PRIVATE mp_err s_mp_montgomery_reduce_adx(mp_int *x, const mp_int *n, mp_digit rho) MP_WUR;
 MP_PRIVATE mp_err s_mp_montgomery_reduce_comba(mp_int *x, const mp_int *n, mp_digit rho) MP_WUR;
+MP_PRIVATE mp_err s_mp_montgomery_reduce_mul(mp_int *x, const mp_int *n, const mp_int *ninv) MP_WUR;
 MP_PRIVATE mp_err s_mp_mul(const mp_int *a, const mp_int *b, mp_int *c, int digs) MP_WUR;
+MP_PRIVATE mp_err s_mp_mul_adx(const mp_int *a, const mp_int *b, mp_int *c, int digs) MP_WUR;
 MP_PRIVATE mp_err s_mp_mul_balance(const mp_int *a, const mp_int *b, mp_int *c) MP_WUR;
 MP_PRIVATE mp_err s_mp_mul_comba(const mp_int *a, const mp_int *b, mp_int *c, int digs) MP_WUR;
+MP_PRIVATE mp_err s_mp_mul_fft(const mp_int *a, const mp_int *b, mp_int *c) MP_WUR;
 MP_PRIVATE mp_err s_mp_mul_high(const mp_int *a, const mp_int *b, mp_int *c, int digs) MP_WUR;
 MP_PRIVATE mp_err s_mp_mul_high_comba(const mp_int *a, const mp_int *b, mp_int *c, int digs) MP_WUR;
-MP_PRIVATE mp_err s_mp_mul_karatsuba(const mp_int *a, const mp_int *b, mp_int *c) MP_WUR;
-MP_PRIVATE mp_err s_mp_mul_toom(const mp_int *a, const mp_int *b, mp_int *c) MP_WUR;
+MP_PRIVATE mp_err s_mp_mul_high_mulders(const mp_int *a, const mp_int *b, mp_int *c, int digs) MP_WUR;
+MP_PRIVATE mp_err s_mp_mul_karatsuba(const mp_int *a, const mp_int *b, mp_int *c, mp_scratch *s) MP_WUR;
+MP_PRIVATE mp_err s_mp_mul_low_mulders(const mp_int *a, const mp_int *b, mp_int *c, int digs) MP_WUR;
+MP_PRIVATE mp_err s_mp_mul_parallel(const mp_int *a[], const mp_int *b[], mp_int *c[], int n, mp_scratch *s) MP_WUR;
+MP_PRIVATE mp_err s_mp_mul_scratch(const mp_int *a, const mp_int *b, mp_int *c, mp_scratch *s) MP_WUR;
+MP_PRIVATE bool s_mp_mul_task_run(void);
+MP_PRIVATE mp_err s_mp_mul_toom(const mp_int *a, const mp_int *b, mp_int *c, mp_scratch *s) MP_WUR;
+MP_PRIVATE mp_err s_mp_mul_toom4(const mp_int *a, const mp_int *b, mp_int *c) MP_WUR;
+MP_PRIVATE mp_err s_mp_mul_toom32(const mp_int *a, const mp_int *b, mp_int *c) MP_WUR;
+MP_PRIVATE mp_err s_mp_mul_toom42(const mp_int *a, const mp_int *b, mp_int *c) MP_WUR;
+MP_PRIVATE mp_err s_mp_mul_toom53(const mp_int *a, const mp_int *b, mp_int *c) MP_WUR;
 MP_PRIVATE mp_err s_mp_prime_is_divisible(const mp_int *a, bool *result) MP_WUR;
 MP_PRIVATE mp_err s_mp_rand_platform(void *p, size_t n) MP_WUR;
+MP_PRIVATE mp_err s_mp_reduce(mp_int *x, const mp_int *m, const mp_int *mu, mp_int *q, mp_int *t) MP_WUR;
+MP_PRIVATE mp_err s_mp_reduce_2k(mp_int *a, const mp_int *n, mp_digit d, mp_int *q) MP_WUR;
+MP_PRIVATE mp_err s_mp_reduce_2k_l(mp_int *a, const mp_int *n, const mp_int *d, mp_int *q, mp_int *t) MP_WUR;
+MP_PRIVATE void s_mp_scratch_clear(mp_scratch *s);
+MP_PRIVATE mp_err s_mp_scratch_get(mp_scratch *s, mp_int *a, int size) MP_WUR;
+MP_PRIVATE mp_err s_mp_scratch_init(mp_scratch *s, int size) MP_WUR;
+MP_PRIVATE int s_mp_scratch_size(int na, int nb) MP_WUR;
+MP_PRIVATE bool s_mp_solinas_find(const mp_int *p, int *form) MP_WUR;
+MP_PRIVATE void s_mp_solinas_mul(const uint32_t *a, const uint32_t *b, uint32_t *c, int form);
+MP_PRIVATE mp_err s_mp_solinas_mulmod(const mp_int *a, const mp_int *b, const mp_int *p, mp_int *c, int form) MP_WUR;
 MP_PRIVATE mp_err s_mp_sqr(const mp_int *a, mp_int *b) MP_WUR;
+MP_PRIVATE mp_err s_mp_sqr_adx(const mp_int *a, mp_int *b) MP_WUR;
 MP_PRIVATE mp_err s_mp_sqr_comba(const mp_int *a, mp_int *b) MP_WUR;
-MP_PRIVATE mp_err s_mp_sqr_karatsuba(const mp_int *a, mp_int *b) MP_WUR;
-MP_PRIVATE mp_err s_mp_sqr_toom(const mp_int *a, mp_int *b) MP_WUR;
+MP_PRIVATE mp_err s_mp_sqr_fft(const mp_int *a, mp_int *b) MP_WUR;
+MP_PRIVATE mp_err s_mp_sqr_karatsuba(const mp_int *a, mp_int *b, mp_scratch *s) MP_WUR;
+MP_PRIVATE mp_err s_mp_sqr_toom(const mp_int *a, mp_int *b, mp_scratch *s) MP_WUR;
+MP_PRIVATE mp_err s_mp_sqr_toom4(const mp_int *a, mp_int *b) MP_WUR;
+MP_PRIVATE void s_mp_to_words(const mp_int *a, uint32_t *w, int n);
+MP_PRIVATE mp_err s_mp_toom4_interpolate(mp_int *w, int B, mp_int *c) MP_WUR;
+MP_PRIVATE mp_err s_mp_toom_split(const mp_int *a, int B, int k, mp_int *p) MP_WUR;
 MP_PRIVATE mp_err s_mp_sub(const mp_int *a, const mp_int *b, mp_int *c) MP_WUR;
 MP_PRIVATE void s_mp_copy_digs(mp_digit *d, const mp_digit *s, int digits);
 MP_PRIVATE void s_mp_zero_buf(void *mem, size_t size);
@@ -238,10 +461,14 @@ MP_PRIVATE mp_err s_mp_fp_log_d(const mp_int *a, mp_word *c) MP_WUR;
 extern MP_PRIVATE const char s_mp_radix_map[];
 extern MP_PRIVATE const uint8_t s_mp_radix_map_reverse[];
 extern MP_PRIVATE const mp_digit s_mp_prime_tab[];
+extern MP_PRIVATE const mp_solinas s_mp_solinas_tab[];
 
 /* number of primes */
 #define MP_PRIME_TAB_SIZE 256
 
+/* number of generalized Mersenne moduli */
+#define MP_SOLINAS_TAB_SIZE 8
+
 #define MP_GET_ENDIANNESS(x) \
    do{\
       int16_t n = 0x1;                                          \